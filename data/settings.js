@@ -43,7 +43,10 @@ let systemSettings = {
         poll_success_threshold: 6,
         uart_retry_count: 3,
         uart_retry_delay_ms: 50,
-        broadcast_expected: true
+        broadcast_expected: true,
+        refresh_fast_ms: 100,
+        refresh_normal_ms: 1000,
+        refresh_slow_ms: 10000
     },
     cvl: {
         enabled: true,
@@ -992,7 +995,10 @@ async function saveTinyBMSSettings() {
             poll_success_threshold: parseInt(document.getElementById('tinySuccessThreshold').value),
             uart_retry_count: parseInt(document.getElementById('tinyRetryCount').value),
             uart_retry_delay_ms: parseInt(document.getElementById('tinyRetryDelay').value),
-            broadcast_expected: document.getElementById('tinyBroadcastExpected').checked
+            broadcast_expected: document.getElementById('tinyBroadcastExpected').checked,
+            refresh_fast_ms: parseInt(document.getElementById('tinyRefreshFast').value),
+            refresh_normal_ms: parseInt(document.getElementById('tinyRefreshNormal').value),
+            refresh_slow_ms: parseInt(document.getElementById('tinyRefreshSlow').value)
         }
     };
 
@@ -9,12 +9,17 @@ public:
     virtual bool isReady() const = 0;
     virtual void publish(const tinybms::events::LiveDataUpdate& event) = 0;
     virtual void publish(const tinybms::events::MqttRegisterValue& event) = 0;
+    virtual void publish(const tinybms::events::RegisterCycleBatch& event) = 0;
     virtual void publish(const tinybms::events::AlarmRaised& event) = 0;
     virtual void publish(const tinybms::events::AlarmCleared& event) = 0;
     virtual void publish(const tinybms::events::WarningRaised& event) = 0;
     virtual void publish(const tinybms::events::StatusMessage& event) = 0;
     virtual void publish(const tinybms::events::CVLStateChanged& event) = 0;
     virtual bool latest(tinybms::events::LiveDataUpdate& event_out) const = 0;
+    // Run fn on the latest LiveDataUpdate in place (no 1.4 kB copy); keep fn short.
+    virtual bool borrowLatest(const tinybms::event::EventCallback<tinybms::events::LiveDataUpdate>& fn) const = 0;
+    // RegisterCycleBatch events lost by a full subscriber queue (monotonic until a stats reset).
+    virtual uint32_t droppedRegisterBatches() const = 0;
 };
 
 BridgeEventSink& defaultBridgeEventSink(tinybms::event::EventBusV2& bus);
@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <atomic>
 
 enum LogLevel {
     LOG_ERROR = 0,
@@ -63,12 +64,34 @@ public:
         uint8_t poll_failure_threshold = 3;
         uint8_t poll_success_threshold = 6;
         uint8_t uart_retry_count = 3;
-        uint32_t uart_retry_delay_ms = 50;
+        uint32_t uart_retry_delay_ms = 50;        // ceiling when adaptive
+        bool uart_adaptive_timeouts = true;       // RTT-derived timeout / retry delay
+        uint32_t uart_timeout_min_ms = 20;        // ceiling: hardware.uart.timeout_ms
+        uint32_t uart_retry_delay_min_ms = 5;
         bool broadcast_expected = true;
+        uint32_t refresh_fast_ms = 100;      // voltage, current, cells, SOC
+        uint32_t refresh_normal_ms = 1000;   // temperatures, status, limits
+        uint32_t refresh_slow_ms = 10000;    // cutoffs, capacity (identification: boot + on demand)
+
+        // Multi-pack bank: TinyBMS wired in parallel, each on its own UART,
+        // presented to Victron as one battery (hardware.uart is pack 0).
+        static constexpr size_t kMaxExtraPacks = 3;
+        struct ExtraPack {
+            int uart_port = 2;               // pack 0 uses the HAL default UART
+            int rx_pin = -1;
+            int tx_pin = -1;
+            float capacity_ah = 0.0f;        // weight when register 306 is not read
+        };
+        uint8_t extra_pack_count = 0;
+        ExtraPack extra_packs[kMaxExtraPacks];
+        float pack_capacity_ah = 0.0f;       // pack 0 weight when register 306 is not read
+        uint32_t pack_stale_ms = 5000;       // silent packs leave the combined view
     } tinybms;
 
     struct VictronConfig {
-        uint32_t pgn_update_interval_ms = 1000;
+        uint32_t pgn_update_interval_ms = 1000;        // 0x351, 0x355, 0x356, 0x35A
+        uint32_t pgn_energy_interval_ms = 5000;        // 0x378
+        uint32_t pgn_identity_interval_ms = 10000;     // 0x35E, 0x35F, 0x371, 0x379, 0x382
         uint32_t cvl_update_interval_ms = 20000;
         uint32_t keepalive_interval_ms = 1000;
         uint32_t keepalive_timeout_ms = 10000;
@@ -169,6 +192,13 @@ public:
 
     bool isLoaded() const { return loaded_; }
 
+    // Bumped on every load, save and in-memory edit: readers caching values
+    // derived from the configuration compare it instead of taking configMutex.
+    uint32_t version() const { return version_.load(std::memory_order_acquire); }
+
+    // Call with configMutex held after editing fields outside load()/save().
+    void markChanged() { version_.fetch_add(1, std::memory_order_acq_rel); }
+
 private:
     void loadWiFiConfig(const JsonDocument& doc);
     void loadHardwareConfig(const JsonDocument& doc);
@@ -197,4 +227,5 @@ private:
 private:
     String filename_;
     bool loaded_;
+    std::atomic<uint32_t> version_{0};
 };
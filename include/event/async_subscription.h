@@ -0,0 +1,196 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "event/event_registry.h"
+#include "event/inplace_function.h"
+
+namespace tinybms::event {
+
+/**
+ * @brief What an async subscription does when its queue is full.
+ */
+enum class QueuePolicy : uint8_t {
+    Block,          // publisher waits up to block_timeout_ms, then the event is dropped
+    DropOldest,     // the oldest queued event makes room
+    CoalesceLatest  // an event replaces the queued one with the same key; else drop oldest
+};
+
+struct AsyncSubscriptionOptions {
+    size_t capacity = 16;
+    QueuePolicy policy = QueuePolicy::DropOldest;
+    uint32_t block_timeout_ms = 20;
+};
+
+namespace detail {
+
+// Shared by the bus and its queues: dispatcher wake-up and counters.
+struct DispatchState {
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::atomic<uint32_t> depth{0};      // events queued across all async subscriptions
+    std::atomic<uint32_t> overruns{0};   // events dropped by a full queue
+    std::atomic<uint32_t> errors{0};     // callbacks that threw or were empty
+
+    void notify() {
+        { std::lock_guard<std::mutex> lock(mutex); }
+        ready.notify_one();
+    }
+};
+
+class AsyncQueueBase {
+public:
+    virtual ~AsyncQueueBase() = default;
+
+    // Dispatcher side: run the callback on the oldest queued event, if any.
+    virtual bool deliverOne() = 0;
+
+    // Discard pending events and refuse new ones (unsubscribe).
+    virtual void close() = 0;
+};
+
+/**
+ * @brief Bounded FIFO of one async subscriber, preallocated at subscribe time
+ *        so that push() never allocates.
+ */
+template <typename Event>
+class AsyncQueue final : public AsyncQueueBase {
+public:
+    using Callback = EventCallback<Event>;
+    using KeyFn = EventKeyFn<Event>;
+
+    AsyncQueue(Callback callback,
+               const AsyncSubscriptionOptions& options,
+               KeyFn key,
+               std::shared_ptr<DispatchState> state,
+               EventChannelStats* stats = nullptr)
+        : callback_(std::move(callback))
+        , key_(std::move(key))
+        , policy_(options.policy)
+        , block_timeout_ms_(options.block_timeout_ms)
+        , slots_(options.capacity > 0 ? options.capacity : 1)
+        , keys_(slots_.size(), 0)
+        , state_(std::move(state))
+        , stats_(stats) {}
+
+    // Publisher side.
+    void push(const Event& event) {
+        const uint32_t key = key_ ? key_(event) : 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (closed_) {
+            return;
+        }
+        if (policy_ == QueuePolicy::CoalesceLatest) {
+            for (size_t i = 0; i < count_; ++i) {
+                const size_t index = (head_ + i) % slots_.size();
+                if (keys_[index] == key) {
+                    slots_[index] = event;   // keeps its place in the queue
+                    return;
+                }
+            }
+        }
+        if (count_ == slots_.size()) {
+            if (policy_ == QueuePolicy::Block) {
+                const bool room = not_full_.wait_for(lock, std::chrono::milliseconds(block_timeout_ms_),
+                                                     [this]() { return closed_ || count_ < slots_.size(); });
+                if (!room || closed_) {
+                    countDrop();
+                    return;
+                }
+            } else {
+                head_ = (head_ + 1) % slots_.size();
+                count_--;
+                state_->depth.fetch_sub(1, std::memory_order_relaxed);
+                countDrop();
+            }
+        }
+        const size_t tail = (head_ + count_) % slots_.size();
+        slots_[tail] = event;
+        keys_[tail] = key;
+        count_++;
+        state_->depth.fetch_add(1, std::memory_order_relaxed);
+        lock.unlock();
+        state_->notify();
+    }
+
+    bool deliverOne() override {
+        Event event{};
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_ || count_ == 0) {
+                return false;
+            }
+            event = slots_[head_];
+            head_ = (head_ + 1) % slots_.size();
+            count_--;
+            state_->depth.fetch_sub(1, std::memory_order_relaxed);
+        }
+        not_full_.notify_one();
+
+        if (!callback_) {
+            state_->errors.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        const bool sampled = stats_ != nullptr && EventRegistry::instance().sampleCallback(*stats_);
+        const uint32_t started_us = sampled ? micros() : 0;
+        try {
+            callback_(event);
+        } catch (...) {
+            state_->errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (sampled) {
+            EventRegistry::instance().recordCallback(*stats_, micros() - started_us);
+        }
+        return true;
+    }
+
+    void close() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+            state_->depth.fetch_sub(static_cast<uint32_t>(count_), std::memory_order_relaxed);
+            count_ = 0;
+        }
+        not_full_.notify_all();
+    }
+
+    size_t depth() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return count_;
+    }
+
+private:
+    void countDrop() {
+        state_->overruns.fetch_add(1, std::memory_order_relaxed);
+        if (stats_ != nullptr) {
+            stats_->dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    Callback callback_;
+    KeyFn key_;
+    QueuePolicy policy_;
+    uint32_t block_timeout_ms_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::vector<Event> slots_;
+    std::vector<uint32_t> keys_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    bool closed_ = false;
+    std::shared_ptr<DispatchState> state_;
+    EventChannelStats* stats_;   // callback time and drops of the event type
+};
+
+} // namespace detail
+} // namespace tinybms::event
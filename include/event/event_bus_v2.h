@@ -2,23 +2,29 @@
 
 #include <Arduino.h>
 #include <atomic>
-#include <functional>
 #include <memory>
 #include <mutex>
-#include <optional>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "event/async_subscription.h"
+#include "event/event_filter.h"
+#include "event/event_registry.h"
 #include "event/event_subscriber.h"
+#include "event/inplace_function.h"
+#include "event/latest_slot.h"
 #include "event/event_types_v2.h"
 
 namespace tinybms::event {
 
 struct BusStatistics {
     uint32_t total_published = 0;
-    uint32_t total_delivered = 0;
+    uint32_t total_delivered = 0;       // synchronous calls and async enqueues
     size_t subscriber_count = 0;
+    uint32_t queue_overruns = 0;        // async events dropped by a full queue
+    uint32_t dispatch_errors = 0;       // async callbacks that threw or were empty
+    uint32_t current_queue_depth = 0;   // async events waiting for the dispatcher
 };
 
 namespace detail {
@@ -38,47 +44,173 @@ public:
     template <typename Event>
     void publish(Event event);
 
+    // The callback is stored inline (EventCallback): a lambda capturing more
+    // than kInplaceFunctionCapacity bytes does not compile.
     template <typename Event>
-    EventSubscriber subscribe(std::function<void(const Event&)> callback);
+    EventSubscriber subscribe(EventCallback<Event> callback);
+
+    /**
+     * @brief Subscribe to the events whose `eventKey()` is in `keys` only.
+     *
+     * The channel indexes the subscription by key: publishing an event with
+     * another key never visits it.
+     */
+    template <typename Event>
+    EventSubscriber subscribe(const KeyFilter& keys, EventCallback<Event> callback);
+
+    // Subscribe with a predicate, evaluated in publish() before the callback.
+    template <typename Event>
+    EventSubscriber subscribe(EventFilter<Event> filter, EventCallback<Event> callback);
+
+    /**
+     * @brief Subscribe with a bounded queue: publish() only enqueues and the
+     *        callback runs on the task calling dispatchPending().
+     * @param coalesce_key Key of CoalesceLatest (e.g. register address);
+     *        without it every event shares key 0.
+     */
+    template <typename Event>
+    EventSubscriber subscribeAsync(EventCallback<Event> callback,
+                                   AsyncSubscriptionOptions options = {},
+                                   EventKeyFn<Event> coalesce_key = nullptr);
 
+    // Async subscription to a key set: other keys are never enqueued.
+    template <typename Event>
+    EventSubscriber subscribeAsync(const KeyFilter& keys,
+                                   EventCallback<Event> callback,
+                                   AsyncSubscriptionOptions options = {},
+                                   EventKeyFn<Event> coalesce_key = nullptr);
+
+    /**
+     * @brief Dispatcher loop body: wait up to `wait_ms` for queued async
+     *        events, then deliver until every queue is empty.
+     * @return Number of callbacks run.
+     */
+    size_t dispatchPending(uint32_t wait_ms);
+
+    // Lock-free: readers never wait for the publisher (see LatestSlot).
     template <typename Event>
     bool getLatest(Event& out) const;
 
+    // Run fn(const Event&) on the cached latest event without copying it.
+    template <typename Event, typename Fn>
+    bool borrowLatest(Fn&& fn) const;
+
     template <typename Event>
     bool hasLatest() const;
 
+    /**
+     * @brief Events of this type dropped by a full async queue, all
+     *        subscriptions together. Producers whose events are deltas
+     *        (e.g. report-by-exception batches) watch it to resend state.
+     */
+    template <typename Event>
+    uint32_t droppedCount() const;
+
+    // True when at least one subscription (sync or async) exists for Event.
+    template <typename Event>
+    bool hasSubscribers() const;
+
     bool getLatestLiveData(TinyBMS_LiveData& out) const;
 
     void resetStats();
     BusStatistics statistics() const;
+
+    // Per event type counters and callback times (see EventRegistry).
+    std::vector<EventTypeSnapshot> typeStatistics() const;
+
+    // Callbacks at or above this time raise a (throttled) StatusMessage warning.
+    void setSlowCallbackThresholdUs(uint32_t threshold_us);
+    uint32_t slowCallbackThresholdUs() const;
+
+    // Time one publish (every callback it runs) in `every`; 1 times them all, 0 none.
+    void setCallbackSampleEvery(uint32_t every);
+    uint32_t callbackSampleEvery() const;
     size_t subscriberCount() const { return subscriber_count_.load(std::memory_order_relaxed); }
 
 private:
     template <typename Event>
     struct Channel {
         struct Subscription {
-            std::function<void(const Event&)> callback;
+            EventCallback<Event> callback;
+            EventFilter<Event> filter;   // optional predicate
+            bool timed = true;           // false for the enqueue step of async subscriptions
+        };
+        struct KeyedSubscription {
+            uint32_t key;
+            std::shared_ptr<Subscription> subscription;
+        };
+        struct SubscriberList {
+            std::vector<std::shared_ptr<Subscription>> any_key;   // no KeyFilter
+            std::vector<KeyedSubscription> by_key;                 // sorted by key
+            bool empty() const { return any_key.empty() && by_key.empty(); }
         };
 
-        mutable std::mutex mutex;
-        std::vector<std::shared_ptr<Subscription>> subscribers;
-        std::optional<Event> latest;
+        Channel() : stats(EventRegistry::instance().add(EventTypeName<Event>::value)) {}
+
+        // Copy-on-write: publishers iterate the current immutable list without
+        // locking or copying it; (un)subscribe builds a new list and swaps it in.
+        // A replaced list is freed once no publisher is iterating (retired
+        // until then).
+        void replaceSubscribers(std::unique_ptr<const SubscriberList> next);   // mutex held
+
+        mutable std::mutex mutex;                   // serialises list updates
+        std::unique_ptr<const SubscriberList> owned_list;
+        std::vector<std::unique_ptr<const SubscriberList>> retired_lists;
+        std::atomic<const SubscriberList*> subscribers{nullptr};
+        std::atomic<uint32_t> publishing{0};        // publishers iterating a list
+
+        mutable std::mutex latest_mutex;            // serialises writers of `latest`
+        LatestSlot<Event> latest;                   // read lock-free
+
+        EventChannelStats& stats;                   // registered once per type
     };
 
     template <typename Event>
     Channel<Event>& channel() const;
 
     template <typename Event>
-    static void fillMetadata(Event& event, std::true_type);
+    std::shared_ptr<typename Channel<Event>::Subscription> addSubscription(EventCallback<Event> callback,
+                                                                           bool timed = true,
+                                                                           const KeyFilter* keys = nullptr,
+                                                                           EventFilter<Event> filter = nullptr);
+
+    template <typename Event>
+    EventSubscriber makeAsyncSubscription(const KeyFilter* keys,
+                                          EventCallback<Event> callback,
+                                          const AsyncSubscriptionOptions& options,
+                                          EventKeyFn<Event> coalesce_key);
+
+    // Runs one subscription's callback if its filter accepts the event.
+    template <typename Event>
+    bool deliver(Channel<Event>& ch,
+                 const typename Channel<Event>::Subscription& sub,
+                 const Event& event,
+                 bool sampled);
+
+    template <typename Event>
+    void removeSubscription(const std::shared_ptr<typename Channel<Event>::Subscription>& subscription);
+
+    // Publishes a StatusMessage per pending slow-callback report.
+    void reportSlowCallbacks();
 
     template <typename Event>
-    static void fillMetadata(Event&, std::false_type) {}
+    void fillMetadata(Event& event, std::true_type);
+
+    template <typename Event>
+    void fillMetadata(Event&, std::false_type) {}
 
 private:
     std::atomic<uint32_t> total_published_;
     std::atomic<uint32_t> total_delivered_;
     std::atomic<size_t> subscriber_count_;
     std::atomic<uint32_t> sequence_counter_;
+
+    std::shared_ptr<detail::DispatchState> dispatch_;
+    // Immutable snapshot, replaced on (un)subscribe: the dispatcher takes a
+    // reference instead of copying the list.
+    using AsyncQueueList = std::vector<std::shared_ptr<detail::AsyncQueueBase>>;
+    std::mutex async_mutex_;
+    std::shared_ptr<const AsyncQueueList> async_queues_;
 };
 
 extern EventBusV2 eventBus;
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
 
 namespace tinybms::event {
 
@@ -8,92 +11,294 @@ inline EventBusV2::EventBusV2()
     : total_published_(0)
     , total_delivered_(0)
     , subscriber_count_(0)
-    , sequence_counter_(0) {}
+    , sequence_counter_(0)
+    , dispatch_(std::make_shared<detail::DispatchState>()) {}
 
 template <typename Event>
 void EventBusV2::publish(Event event) {
     fillMetadata(event, detail::has_metadata<Event>{});
 
     auto& ch = channel<Event>();
-    std::vector<std::shared_ptr<typename Channel<Event>::Subscription>> subscribers;
     {
-        std::lock_guard<std::mutex> lock(ch.mutex);
-        ch.latest = event;
-        subscribers = ch.subscribers;
+        std::lock_guard<std::mutex> lock(ch.latest_mutex);
+        if (!ch.latest.store(event)) {
+            ch.stats.latest_skipped.fetch_add(1, std::memory_order_relaxed);
+        }
     }
 
     total_published_.fetch_add(1, std::memory_order_relaxed);
+    ch.stats.published.fetch_add(1, std::memory_order_relaxed);
     uint32_t delivered = 0;
+    const bool sampled = EventRegistry::instance().sampleCallback(ch.stats);
 
-    for (const auto& sub : subscribers) {
-        if (sub && sub->callback) {
-            sub->callback(event);
-            ++delivered;
+    // Announce the iteration before loading the list: a list replaced after
+    // this point is retired, not freed, until publishing drops back to zero.
+    ch.publishing.fetch_add(1, std::memory_order_seq_cst);
+    if (const auto* subscribers = ch.subscribers.load(std::memory_order_seq_cst)) {
+        for (const auto& sub : subscribers->any_key) {
+            if (sub && deliver(ch, *sub, event, sampled)) {
+                ++delivered;
+            }
+        }
+        if constexpr (detail::has_event_key<Event>::value) {
+            if (!subscribers->by_key.empty()) {
+                const uint32_t key = event.eventKey();
+                auto it = std::lower_bound(subscribers->by_key.begin(), subscribers->by_key.end(), key,
+                                           [](const auto& entry, uint32_t k) { return entry.key < k; });
+                for (; it != subscribers->by_key.end() && it->key == key; ++it) {
+                    if (deliver(ch, *it->subscription, event, sampled)) {
+                        ++delivered;
+                    }
+                }
+            }
         }
     }
+    ch.publishing.fetch_sub(1, std::memory_order_release);
 
     if (delivered > 0) {
         total_delivered_.fetch_add(delivered, std::memory_order_relaxed);
+        ch.stats.delivered.fetch_add(delivered, std::memory_order_relaxed);
+    }
+
+    // Never from a StatusMessage publish: the report is itself one.
+    if constexpr (!std::is_same_v<Event, tinybms::events::StatusMessage>) {
+        reportSlowCallbacks();
+    }
+}
+
+template <typename Event>
+EventSubscriber EventBusV2::subscribe(EventCallback<Event> callback) {
+    auto subscription = addSubscription<Event>(std::move(callback));
+    return EventSubscriber([this, subscription]() { removeSubscription<Event>(subscription); });
+}
+
+template <typename Event>
+bool EventBusV2::deliver(Channel<Event>& ch,
+                         const typename Channel<Event>::Subscription& sub,
+                         const Event& event,
+                         bool sampled) {
+    if (!sub.callback || (sub.filter && !sub.filter(event))) {
+        return false;
     }
+    if (sampled && sub.timed) {
+        const uint32_t started_us = micros();
+        sub.callback(event);
+        EventRegistry::instance().recordCallback(ch.stats, micros() - started_us);
+    } else {
+        sub.callback(event);
+    }
+    return true;
+}
+
+template <typename Event>
+EventSubscriber EventBusV2::subscribe(const KeyFilter& keys, EventCallback<Event> callback) {
+    static_assert(detail::has_event_key<Event>::value, "KeyFilter needs an event with eventKey()");
+    auto subscription = addSubscription<Event>(std::move(callback), true, &keys);
+    return EventSubscriber([this, subscription]() { removeSubscription<Event>(subscription); });
+}
+
+template <typename Event>
+EventSubscriber EventBusV2::subscribe(EventFilter<Event> filter, EventCallback<Event> callback) {
+    auto subscription = addSubscription<Event>(std::move(callback), true, nullptr, std::move(filter));
+    return EventSubscriber([this, subscription]() { removeSubscription<Event>(subscription); });
 }
 
 template <typename Event>
-EventSubscriber EventBusV2::subscribe(std::function<void(const Event&)> callback) {
+EventSubscriber EventBusV2::subscribeAsync(EventCallback<Event> callback,
+                                           AsyncSubscriptionOptions options,
+                                           EventKeyFn<Event> coalesce_key) {
+    return makeAsyncSubscription<Event>(nullptr, std::move(callback), options, std::move(coalesce_key));
+}
+
+template <typename Event>
+EventSubscriber EventBusV2::subscribeAsync(const KeyFilter& keys,
+                                           EventCallback<Event> callback,
+                                           AsyncSubscriptionOptions options,
+                                           EventKeyFn<Event> coalesce_key) {
+    static_assert(detail::has_event_key<Event>::value, "KeyFilter needs an event with eventKey()");
+    return makeAsyncSubscription<Event>(&keys, std::move(callback), options, std::move(coalesce_key));
+}
+
+template <typename Event>
+EventSubscriber EventBusV2::makeAsyncSubscription(const KeyFilter* keys,
+                                                  EventCallback<Event> callback,
+                                                  const AsyncSubscriptionOptions& options,
+                                                  EventKeyFn<Event> coalesce_key) {
+    auto queue = std::make_shared<detail::AsyncQueue<Event>>(std::move(callback), options,
+                                                             std::move(coalesce_key), dispatch_,
+                                                             &channel<Event>().stats);
+    {
+        std::lock_guard<std::mutex> lock(async_mutex_);
+        auto next = async_queues_ ? std::make_shared<AsyncQueueList>(*async_queues_) : std::make_shared<AsyncQueueList>();
+        next->push_back(queue);
+        async_queues_ = std::move(next);
+    }
+
+    // The synchronous subscription only enqueues on the publisher's task;
+    // the callback is timed when the dispatcher runs it.
+    auto subscription = addSubscription<Event>([queue](const Event& event) { queue->push(event); }, false, keys);
+
+    return EventSubscriber([this, subscription, queue]() {
+        removeSubscription<Event>(subscription);
+        queue->close();
+        std::lock_guard<std::mutex> lock(async_mutex_);
+        if (async_queues_) {
+            auto next = std::make_shared<AsyncQueueList>(*async_queues_);
+            next->erase(std::remove(next->begin(), next->end(), queue), next->end());
+            async_queues_ = std::move(next);
+        }
+    });
+}
+
+template <typename Event>
+std::shared_ptr<typename EventBusV2::Channel<Event>::Subscription>
+EventBusV2::addSubscription(EventCallback<Event> callback,
+                            bool timed,
+                            const KeyFilter* keys,
+                            EventFilter<Event> filter) {
     auto& ch = channel<Event>();
     auto subscription = std::make_shared<typename Channel<Event>::Subscription>();
     subscription->callback = std::move(callback);
+    subscription->filter = std::move(filter);
+    subscription->timed = timed;
 
     {
         std::lock_guard<std::mutex> lock(ch.mutex);
-        ch.subscribers.push_back(subscription);
+        auto next = ch.owned_list ? std::make_unique<typename Channel<Event>::SubscriberList>(*ch.owned_list)
+                                  : std::make_unique<typename Channel<Event>::SubscriberList>();
+        if (keys != nullptr) {
+            // Same-key subscribers keep their subscription order.
+            for (uint32_t key : *keys) {
+                auto it = std::upper_bound(next->by_key.begin(), next->by_key.end(), key,
+                                           [](uint32_t k, const auto& entry) { return k < entry.key; });
+                next->by_key.insert(it, {key, subscription});
+            }
+        } else {
+            next->any_key.push_back(subscription);
+        }
+        ch.replaceSubscribers(std::move(next));
     }
 
     subscriber_count_.fetch_add(1, std::memory_order_relaxed);
+    ch.stats.subscribers.fetch_add(1, std::memory_order_relaxed);
+    return subscription;
+}
 
-    auto* channel_ptr = &ch;
-    return EventSubscriber([this, channel_ptr, subscription]() {
-        bool removed = false;
-        {
-            std::lock_guard<std::mutex> lock(channel_ptr->mutex);
-            auto& subs = channel_ptr->subscribers;
-            auto it = std::remove(subs.begin(), subs.end(), subscription);
-            if (it != subs.end()) {
-                subs.erase(it, subs.end());
-                removed = true;
+template <typename Event>
+void EventBusV2::removeSubscription(const std::shared_ptr<typename Channel<Event>::Subscription>& subscription) {
+    auto& ch = channel<Event>();
+    bool removed = false;
+    {
+        std::lock_guard<std::mutex> lock(ch.mutex);
+        const auto* current = ch.owned_list.get();
+        if (current != nullptr) {
+            auto next = std::make_unique<typename Channel<Event>::SubscriberList>();
+            next->any_key.reserve(current->any_key.size());
+            std::copy_if(current->any_key.begin(), current->any_key.end(), std::back_inserter(next->any_key),
+                         [&subscription](const auto& sub) { return sub != subscription; });
+            next->by_key.reserve(current->by_key.size());
+            std::copy_if(current->by_key.begin(), current->by_key.end(), std::back_inserter(next->by_key),
+                         [&subscription](const auto& entry) { return entry.subscription != subscription; });
+            removed = next->any_key.size() != current->any_key.size() ||
+                      next->by_key.size() != current->by_key.size();
+            if (removed) {
+                ch.replaceSubscribers(std::move(next));
             }
         }
+    }
+
+    if (removed) {
+        subscriber_count_.fetch_sub(1, std::memory_order_relaxed);
+        ch.stats.subscribers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+inline size_t EventBusV2::dispatchPending(uint32_t wait_ms) {
+    {
+        std::unique_lock<std::mutex> lock(dispatch_->mutex);
+        dispatch_->ready.wait_for(lock, std::chrono::milliseconds(wait_ms), [this]() {
+            return dispatch_->depth.load(std::memory_order_relaxed) > 0;
+        });
+    }
+
+    std::shared_ptr<const AsyncQueueList> queues;
+    {
+        std::lock_guard<std::mutex> lock(async_mutex_);
+        queues = async_queues_;
+    }
+    if (!queues) {
+        return 0;
+    }
 
-        if (removed) {
-            subscriber_count_.fetch_sub(1, std::memory_order_relaxed);
+    // Round-robin, one event per queue per pass, so a busy subscriber does
+    // not starve the others.
+    size_t delivered = 0;
+    for (bool progress = true; progress;) {
+        progress = false;
+        for (const auto& queue : *queues) {
+            if (queue->deliverOne()) {
+                ++delivered;
+                progress = true;
+            }
         }
-    });
+    }
+    reportSlowCallbacks();
+    return delivered;
+}
+
+inline void EventBusV2::reportSlowCallbacks() {
+    SlowCallbackReport report;
+    while (EventRegistry::instance().takeSlowReport(report)) {
+        tinybms::events::StatusMessage status{};
+        status.metadata.source = tinybms::events::EventSource::EventBus;
+        status.level = tinybms::events::StatusLevel::Warning;
+        std::snprintf(status.message, sizeof(status.message), "Slow %s subscriber: %lu us",
+                      report.name, static_cast<unsigned long>(report.elapsed_us));
+        publish(status);
+    }
 }
 
 template <typename Event>
-bool EventBusV2::getLatest(Event& out) const {
-    auto& ch = channel<Event>();
-    std::lock_guard<std::mutex> lock(ch.mutex);
-    if (!ch.latest.has_value()) {
-        return false;
+void EventBusV2::Channel<Event>::replaceSubscribers(std::unique_ptr<const SubscriberList> next) {
+    subscribers.store(next && !next->empty() ? next.get() : nullptr, std::memory_order_seq_cst);
+    if (owned_list) {
+        retired_lists.push_back(std::move(owned_list));
+    }
+    owned_list = std::move(next);
+    // No publisher iterating now means none can still hold a retired list.
+    if (publishing.load(std::memory_order_seq_cst) == 0) {
+        retired_lists.clear();
     }
-    out = *ch.latest;
-    return true;
+}
+
+template <typename Event>
+bool EventBusV2::getLatest(Event& out) const {
+    return channel<Event>().latest.load(out);
+}
+
+template <typename Event, typename Fn>
+bool EventBusV2::borrowLatest(Fn&& fn) const {
+    return channel<Event>().latest.borrow(std::forward<Fn>(fn));
 }
 
 template <typename Event>
 bool EventBusV2::hasLatest() const {
-    auto& ch = channel<Event>();
-    std::lock_guard<std::mutex> lock(ch.mutex);
-    return ch.latest.has_value();
+    return channel<Event>().latest.hasValue();
+}
+
+template <typename Event>
+uint32_t EventBusV2::droppedCount() const {
+    return channel<Event>().stats.dropped.load(std::memory_order_relaxed);
+}
+
+template <typename Event>
+bool EventBusV2::hasSubscribers() const {
+    return channel<Event>().subscribers.load(std::memory_order_acquire) != nullptr;
 }
 
 inline bool EventBusV2::getLatestLiveData(TinyBMS_LiveData& out) const {
-    tinybms::events::LiveDataUpdate event{};
-    if (!getLatest<tinybms::events::LiveDataUpdate>(event)) {
-        return false;
-    }
-    out = event.data;
-    return true;
+    return borrowLatest<tinybms::events::LiveDataUpdate>(
+        [&out](const tinybms::events::LiveDataUpdate& event) { out = event.data; });
 }
 
 template <typename Event>
@@ -111,6 +316,29 @@ void EventBusV2::fillMetadata(Event& event, std::true_type) {
 inline void EventBusV2::resetStats() {
     total_published_.store(0, std::memory_order_relaxed);
     total_delivered_.store(0, std::memory_order_relaxed);
+    dispatch_->overruns.store(0, std::memory_order_relaxed);
+    dispatch_->errors.store(0, std::memory_order_relaxed);
+    EventRegistry::instance().resetCounters();
+}
+
+inline std::vector<EventTypeSnapshot> EventBusV2::typeStatistics() const {
+    return EventRegistry::instance().snapshot();
+}
+
+inline void EventBusV2::setSlowCallbackThresholdUs(uint32_t threshold_us) {
+    EventRegistry::instance().setSlowThresholdUs(threshold_us);
+}
+
+inline uint32_t EventBusV2::slowCallbackThresholdUs() const {
+    return EventRegistry::instance().slowThresholdUs();
+}
+
+inline void EventBusV2::setCallbackSampleEvery(uint32_t every) {
+    EventRegistry::instance().setCallbackSampleEvery(every);
+}
+
+inline uint32_t EventBusV2::callbackSampleEvery() const {
+    return EventRegistry::instance().callbackSampleEvery();
 }
 
 inline BusStatistics EventBusV2::statistics() const {
@@ -118,10 +346,11 @@ inline BusStatistics EventBusV2::statistics() const {
     stats.total_published = total_published_.load(std::memory_order_relaxed);
     stats.total_delivered = total_delivered_.load(std::memory_order_relaxed);
     stats.subscriber_count = subscriber_count_.load(std::memory_order_relaxed);
+    stats.queue_overruns = dispatch_->overruns.load(std::memory_order_relaxed);
+    stats.dispatch_errors = dispatch_->errors.load(std::memory_order_relaxed);
+    stats.current_queue_depth = dispatch_->depth.load(std::memory_order_relaxed);
     return stats;
 }
 
-inline void EventBusV2::fillMetadata(Event&, std::false_type) {}
-
 } // namespace tinybms::event
 
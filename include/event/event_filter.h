@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tinybms::event {
+
+namespace detail {
+
+// Events with a natural dispatch key (register address, alarm code) expose
+// `uint32_t eventKey() const`.
+template <typename T, typename = void>
+struct has_event_key : std::false_type {};
+
+template <typename T>
+struct has_event_key<T, std::void_t<decltype(std::declval<const T&>().eventKey())>> : std::true_type {};
+
+} // namespace detail
+
+/**
+ * @brief Set of event keys a subscription wants (e.g. register addresses).
+ *
+ * Kept sorted and unique; the channel indexes the subscription under each
+ * key, so publish() only visits subscribers of the published event's key.
+ */
+class KeyFilter {
+public:
+    KeyFilter() = default;
+
+    KeyFilter(std::initializer_list<uint32_t> keys) {
+        for (uint32_t key : keys) {
+            add(key);
+        }
+    }
+
+    void add(uint32_t key) {
+        auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+        if (it == keys_.end() || *it != key) {
+            keys_.insert(it, key);
+        }
+    }
+
+    bool contains(uint32_t key) const { return std::binary_search(keys_.begin(), keys_.end(), key); }
+    bool empty() const { return keys_.empty(); }
+    size_t size() const { return keys_.size(); }
+    std::vector<uint32_t>::const_iterator begin() const { return keys_.begin(); }
+    std::vector<uint32_t>::const_iterator end() const { return keys_.end(); }
+
+private:
+    std::vector<uint32_t> keys_;
+};
+
+} // namespace tinybms::event
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "event/event_bus_v2.h"
+#include "event/event_subscriber.h"
+#include "event/event_types_v2.h"
+#include "hal/interfaces/ihal_storage.h"
+
+namespace tinybms::event {
+
+enum class JournalEventType : uint8_t {
+    None = 0,
+    AlarmRaised = 1,
+    AlarmCleared = 2,
+    WarningRaised = 3,
+    CVLStateChanged = 4,
+    ConfigChanged = 5,
+    StatusMessage = 6
+};
+
+const char* journalEventTypeName(JournalEventType type);
+
+/**
+ * @brief One journal entry as stored on flash (64 bytes, little endian).
+ *
+ * `timestamp_ms` is journal time: uptime accumulated across reboots, so it
+ * only grows. `crc` covers every preceding byte of the record.
+ */
+struct JournalRecord {
+    uint64_t timestamp_ms = 0;
+    uint32_t sequence = 0;        // assigned by the journal, continues across reboots
+    JournalEventType type = JournalEventType::None;
+    uint8_t level = 0;            // AlarmSeverity or StatusLevel
+    uint16_t code = 0;            // AlarmCode, or the new CVL state
+    float value = 0.0f;           // alarm value, or the new CVL voltage
+    char text[40] = {};           // message, or "path=value" for ConfigChanged
+    uint32_t crc = 0;
+};
+static_assert(sizeof(JournalRecord) == 64, "JournalRecord is a fixed on-flash layout");
+
+JournalRecord makeJournalRecord(const tinybms::events::AlarmRaised& event);
+JournalRecord makeJournalRecord(const tinybms::events::AlarmCleared& event);
+JournalRecord makeJournalRecord(const tinybms::events::WarningRaised& event);
+JournalRecord makeJournalRecord(const tinybms::events::CVLStateChanged& event);
+JournalRecord makeJournalRecord(const tinybms::events::ConfigChanged& event);
+JournalRecord makeJournalRecord(const tinybms::events::StatusMessage& event);
+
+struct EventJournalConfig {
+    std::string path_prefix = "/evj";        // segments "<prefix>0.bin"..., index "<prefix>.idx"
+    uint16_t records_per_segment = 64;       // 4 KB segments
+    uint8_t segment_count = 8;               // ring of segments, the oldest is overwritten
+    uint8_t batch_records = 8;               // flushIfDue() writes once this many are buffered
+    uint32_t flush_interval_ms = 5000;       // oldest buffered record waits at most this long
+    uint32_t alarm_repeat_ms = 60000;        // an active alarm/warning code is journaled again after this much silence
+};
+
+struct EventJournalStats {
+    uint32_t appended = 0;        // records accepted by append()
+    uint32_t written = 0;         // records appended to flash
+    uint32_t flushes = 0;         // append writes (one per batch and segment)
+    uint32_t index_writes = 0;
+    uint32_t bytes_written = 0;
+    uint32_t write_errors = 0;
+    uint32_t dropped = 0;         // buffered records lost to a write error
+    uint32_t suppressed = 0;      // repeats of an active alarm or warning, not journaled
+    uint32_t repaired = 0;        // torn or stale records discarded at recovery
+    uint32_t segments_read = 0;   // segment files read by query()
+    uint32_t stored = 0;          // records currently on flash
+    uint32_t pending = 0;         // records buffered in RAM
+    uint32_t first_sequence = 0;  // oldest stored record (0 when empty)
+    uint32_t next_sequence = 1;
+    uint64_t now_ms = 0;          // journal time of the last append
+};
+
+/**
+ * @brief Append-only binary journal of alarms, CVL state changes,
+ *        configuration changes and status messages on IHalStorage.
+ *
+ * Records go to a ring of fixed-size segment files. A small index file holds
+ * each segment's first sequence and time range; it is rewritten only when a
+ * segment fills up, and query() skips the segments outside the requested
+ * time range. append() only buffers: flushIfDue(), called from the dispatcher
+ * loop, writes once batch_records records are buffered or the oldest is
+ * flush_interval_ms old, so no bus callback waits on flash.
+ *
+ * begin() recovers after a crash: the active segment is rescanned and cut
+ * after its last record with a valid CRC and sequence; a missing or corrupt
+ * index is rebuilt from the segments.
+ *
+ * Events reach the journal through async Event Bus subscriptions, so flash
+ * writes happen on the dispatcher task, never on the publisher's. The bus's
+ * own slow-subscriber StatusMessages (source EventBus) are not journaled.
+ * Only alarm transitions are: publishers re-raise active alarms every poll
+ * cycle, so an AlarmRaised or WarningRaised whose code is already active is
+ * skipped until its AlarmCleared, or until the code has not been raised for
+ * alarm_repeat_ms.
+ */
+class EventJournal {
+public:
+    explicit EventJournal(EventBusV2& bus, EventJournalConfig config = {});
+    ~EventJournal();
+
+    EventJournal(const EventJournal&) = delete;
+    EventJournal& operator=(const EventJournal&) = delete;
+
+    /**
+     * @brief Recover the journal from `storage` and subscribe to the bus.
+     * @return false (and stays inactive) when the index cannot be written.
+     */
+    bool begin(hal::IHalStorage& storage, uint32_t now_ms);
+
+    // Flush buffered records and unsubscribe.
+    void end();
+    bool isActive() const;
+
+    // Buffer one record (no flash write); assigns its sequence and timestamp.
+    bool append(const JournalRecord& record, uint32_t now_ms);
+
+    void flush();
+
+    // Flush when batch_records are buffered or the oldest is flush_interval_ms old.
+    bool flushIfDue(uint32_t now_ms);
+
+    /**
+     * @brief Records with from_ms <= timestamp_ms <= to_ms, oldest first.
+     *
+     * Keeps the newest `max_records` when more match. Buffered records are
+     * included. Only the segments whose time range overlaps are read.
+     */
+    size_t query(uint64_t from_ms, uint64_t to_ms, size_t max_records, std::vector<JournalRecord>& out);
+
+    EventJournalStats stats() const;
+    const EventJournalConfig& config() const { return config_; }
+
+private:
+    struct ActiveAlarm {
+        JournalEventType type = JournalEventType::None;
+        uint16_t code = 0;
+        uint32_t last_raised_ms = 0;
+    };
+
+    struct Segment {
+        uint32_t first_sequence = 0;
+        uint16_t count = 0;
+        uint64_t first_ms = 0;
+        uint64_t last_ms = 0;
+    };
+
+    std::string segmentPath(size_t slot) const;
+    std::string indexPath() const;
+
+    void recoverLocked();
+    bool loadIndexLocked();
+    void writeIndexLocked();
+    bool isTransition(const JournalRecord& record, uint32_t now_ms);
+    Segment scanSegmentLocked(size_t slot, uint32_t expected_first, bool any_first);
+    void rollOverLocked();
+    void flushLocked();
+    void readSegmentLocked(size_t slot, std::vector<JournalRecord>& out);
+
+    template <typename Event>
+    void subscribeEvent(const AsyncSubscriptionOptions& options);
+
+    EventBusV2& bus_;
+    EventJournalConfig config_;
+    mutable std::mutex mutex_;
+    hal::IHalStorage* storage_ = nullptr;
+    std::vector<Segment> segments_;
+    size_t active_ = 0;
+    std::vector<JournalRecord> pending_;
+    uint32_t pending_since_ms_ = 0;
+    uint32_t next_sequence_ = 1;
+    std::vector<ActiveAlarm> active_alarms_;
+
+    // Journal time = time_base_ms_ + uptime since begin() (millis() wraps counted).
+    uint64_t time_base_ms_ = 0;
+    uint32_t begin_uptime_ms_ = 0;
+    uint32_t last_since_ms_ = 0;
+    uint64_t uptime_wraps_ = 0;
+    uint64_t last_time_ms_ = 0;
+
+    EventJournalStats stats_{};
+    std::vector<EventSubscriber> subscriptions_;
+};
+
+} // namespace tinybms::event
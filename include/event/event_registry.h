@@ -0,0 +1,168 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace tinybms::event {
+
+// Name of an event type: its `kEventName` member, or "unnamed".
+template <typename Event, typename = void>
+struct EventTypeName {
+    static constexpr const char* value = "unnamed";
+};
+
+template <typename Event>
+struct EventTypeName<Event, std::void_t<decltype(Event::kEventName)>> {
+    static constexpr const char* value = Event::kEventName;
+};
+
+/**
+ * @brief Callback execution time in power-of-two microsecond buckets.
+ *
+ * Bucket 0 holds 0 us, bucket i (1..kBucketCount-2) holds [2^(i-1), 2^i) us
+ * and the last bucket everything from 2^(kBucketCount-2) us (~262 ms) up.
+ * Lock-free: every publishing task records into it, one atomic increment
+ * per callback (plus a compare-exchange on a new maximum).
+ */
+class CallbackTimeHistogram {
+public:
+    static constexpr size_t kBucketCount = 20;
+
+    void record(uint32_t elapsed_us);
+    void reset();
+
+    uint32_t count() const;   // sum of the buckets
+    uint32_t maxUs() const { return max_us_.load(std::memory_order_relaxed); }
+    uint32_t bucket(size_t index) const { return buckets_[index].load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Upper bound of the bucket holding the percentile (0-100), capped
+     *        by the largest recorded value; 0 when empty.
+     */
+    uint32_t percentileUs(float percentile) const;
+
+    static size_t bucketIndex(uint32_t elapsed_us);
+    static uint32_t bucketUpperUs(size_t index);   // exclusive; UINT32_MAX for the last bucket
+
+private:
+    std::array<std::atomic<uint32_t>, kBucketCount> buckets_{};
+    std::atomic<uint32_t> max_us_{0};
+};
+
+/**
+ * @brief Counters of one event type, owned by the registry and updated by
+ *        its EventBusV2 channel.
+ */
+struct EventChannelStats {
+    EventChannelStats(const char* type_name, uint16_t type_id) : name(type_name), id(type_id) {}
+
+    const char* const name;
+    const uint16_t id;
+    std::atomic<uint32_t> published{0};
+    std::atomic<uint32_t> delivered{0};        // synchronous calls and async enqueues
+    std::atomic<uint32_t> subscribers{0};
+    std::atomic<uint32_t> slow_callbacks{0};   // callbacks above the slow threshold
+    std::atomic<uint32_t> dropped{0};          // async events dropped by a full queue
+    std::atomic<uint32_t> latest_skipped{0};   // latest-value updates skipped (readers pinned it)
+    CallbackTimeHistogram callback_time;       // sampled sync callbacks and async deliveries
+    std::atomic<uint32_t> sample_countdown{0}; // publishes/deliveries left before the next timed one
+
+    // Slow-subscriber reporting, at most once per kSlowReportIntervalMs.
+    std::atomic<bool> slow_pending{false};
+    std::atomic<uint32_t> slow_elapsed_us{0};
+    std::atomic<uint32_t> slow_reported_ms{0};
+    std::atomic<bool> slow_ever_reported{false};
+};
+
+struct EventTypeSnapshot {
+    const char* name = "";
+    uint16_t id = 0;
+    uint32_t published = 0;
+    uint32_t delivered = 0;
+    uint32_t subscribers = 0;
+    uint32_t slow_callbacks = 0;
+    uint32_t dropped = 0;
+    uint32_t latest_skipped = 0;
+    uint32_t callback_count = 0;
+    uint32_t callback_p50_us = 0;
+    uint32_t callback_p99_us = 0;
+    uint32_t callback_max_us = 0;
+    std::array<uint32_t, CallbackTimeHistogram::kBucketCount> callback_buckets{};
+};
+
+struct SlowCallbackReport {
+    const char* name = "";
+    uint32_t elapsed_us = 0;
+};
+
+/**
+ * @brief Process-wide list of event types seen by EventBusV2.
+ *
+ * Each Channel<Event> registers once, on first use; ids follow registration
+ * order. Entries are never removed, so references stay valid.
+ */
+class EventRegistry {
+public:
+    static constexpr uint32_t kDefaultSlowCallbackUs = 10000;
+    static constexpr uint32_t kSlowReportIntervalMs = 10000;
+    static constexpr uint32_t kDefaultCallbackSampleEvery = 16;
+
+    static EventRegistry& instance();
+
+    EventChannelStats& add(const char* name);
+
+    /**
+     * @brief Whether the next publish (or async delivery) of the channel is
+     *        timed: one in callbackSampleEvery(), never when it is 0.
+     *
+     * Relaxed load/store rather than a read-modify-write: concurrent
+     * publishers may skew the sampling a little, never block each other.
+     */
+    bool sampleCallback(EventChannelStats& stats) {
+        const uint32_t every = sample_every_.load(std::memory_order_relaxed);
+        if (every == 0) {
+            return false;
+        }
+        const uint32_t left = stats.sample_countdown.load(std::memory_order_relaxed);
+        if (left > 0 && left < every) {
+            stats.sample_countdown.store(left - 1, std::memory_order_relaxed);
+            return false;
+        }
+        stats.sample_countdown.store(every - 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Time of one callback run; flags the channel for a report when slow.
+    void recordCallback(EventChannelStats& stats, uint32_t elapsed_us);
+
+    /**
+     * @brief Take one pending slow-callback report.
+     * @return false (cheaply) when none is pending.
+     */
+    bool takeSlowReport(SlowCallbackReport& out);
+
+    void setSlowThresholdUs(uint32_t threshold_us) { slow_threshold_us_.store(threshold_us, std::memory_order_relaxed); }
+    uint32_t slowThresholdUs() const { return slow_threshold_us_.load(std::memory_order_relaxed); }
+
+    // 1 times every callback, 0 none (no histogram, no slow-subscriber report).
+    void setCallbackSampleEvery(uint32_t every) { sample_every_.store(every, std::memory_order_relaxed); }
+    uint32_t callbackSampleEvery() const { return sample_every_.load(std::memory_order_relaxed); }
+
+    std::vector<EventTypeSnapshot> snapshot() const;
+    void resetCounters();   // keeps subscriber counts
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<EventChannelStats>> channels_;
+    std::atomic<uint32_t> slow_threshold_us_{kDefaultSlowCallbackUs};
+    std::atomic<uint32_t> slow_pending_{0};
+    std::atomic<uint32_t> sample_every_{kDefaultCallbackSampleEvery};
+};
+
+} // namespace tinybms::event
@@ -1,13 +1,16 @@
 #pragma once
 
-#include <functional>
+#include "event/inplace_function.h"
 
 namespace tinybms::event {
 
 class EventSubscriber {
 public:
+    // Room for `this` plus two shared_ptr captures (async subscriptions).
+    using UnsubscribeFn = InplaceFunction<void(), 6 * sizeof(void*)>;
+
     EventSubscriber() = default;
-    explicit EventSubscriber(std::function<void()> unsubscribe);
+    explicit EventSubscriber(UnsubscribeFn unsubscribe);
     EventSubscriber(EventSubscriber&& other) noexcept;
     EventSubscriber& operator=(EventSubscriber&& other) noexcept;
     ~EventSubscriber();
@@ -19,7 +22,7 @@ public:
     bool isActive() const { return unsubscribe_ != nullptr; }
 
 private:
-    std::function<void()> unsubscribe_{};
+    UnsubscribeFn unsubscribe_{};
 };
 
 } // namespace tinybms::event
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include <cstddef>
 #include <cstdint>
 
 #include "shared_data.h"
@@ -17,7 +18,8 @@ enum class EventSource : uint32_t {
     ConfigManager = 6,
     Watchdog = 7,
     Logger = 8,
-    System = 9
+    System = 9,
+    EventBus = 10   // reports raised by the bus itself (slow subscribers)
 };
 
 enum class AlarmSeverity : uint8_t {
@@ -128,7 +130,7 @@ struct MqttRegisterEvent {
     uint8_t raw_word_count = 0;
     int32_t raw_value = 0;
     bool has_text = false;
-    char text_value[64] = {};
+    char text_value[TINY_REGISTER_TEXT_CAPACITY + 1] = {};   // decoded register text
     uint16_t raw_words[TINY_REGISTER_MAX_WORDS] = {};
     uint32_t timestamp_ms = 0;
 };
@@ -140,41 +142,86 @@ struct EventMetadata {
 };
 
 struct LiveDataUpdate {
+    static constexpr const char* kEventName = "LiveDataUpdate";
     EventMetadata metadata{};
     TinyBMS_LiveData data{};
 };
 
 struct MqttRegisterValue {
+    static constexpr const char* kEventName = "MqttRegisterValue";
     EventMetadata metadata{};
     MqttRegisterEvent payload{};
+    uint32_t eventKey() const { return payload.address; }   // KeyFilter: register address
+};
+
+// Register values reported in one UART poll cycle, published once after
+// LiveDataUpdate with a single sequence number. Subscribers iterate the
+// entries in place; RegisterValueAdapter republishes them one by one as
+// MqttRegisterValue for single-register subscribers.
+constexpr size_t kRegisterCycleCapacity = TINY_LIVEDATA_MAX_REGISTERS;
+
+struct RegisterCycleBatch {
+    static constexpr const char* kEventName = "RegisterCycleBatch";
+    EventMetadata metadata{};
+    uint16_t count = 0;
+    uint16_t dropped = 0;   // values reported past kRegisterCycleCapacity
+    MqttRegisterEvent values[kRegisterCycleCapacity] = {};
+
+    void clear() {
+        count = 0;
+        dropped = 0;
+    }
+
+    // Next free entry, or nullptr (counted in `dropped`) when the batch is full.
+    MqttRegisterEvent* append() {
+        if (count >= kRegisterCycleCapacity) {
+            dropped++;
+            return nullptr;
+        }
+        return &values[count++];
+    }
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+    const MqttRegisterEvent* begin() const { return values; }
+    const MqttRegisterEvent* end() const { return values + count; }
 };
 
 struct AlarmRaised {
+    static constexpr const char* kEventName = "AlarmRaised";
     EventMetadata metadata{};
     AlarmEvent alarm{};
+    uint32_t eventKey() const { return alarm.alarm_code; }   // KeyFilter: AlarmCode
 };
 
 struct AlarmCleared {
+    static constexpr const char* kEventName = "AlarmCleared";
     EventMetadata metadata{};
     AlarmEvent alarm{};
+    uint32_t eventKey() const { return alarm.alarm_code; }   // KeyFilter: AlarmCode
 };
 
 struct WarningRaised {
+    static constexpr const char* kEventName = "WarningRaised";
     EventMetadata metadata{};
     AlarmEvent alarm{};
+    uint32_t eventKey() const { return alarm.alarm_code; }   // KeyFilter: AlarmCode
 };
 
 struct ConfigChanged {
+    static constexpr const char* kEventName = "ConfigChanged";
     EventMetadata metadata{};
     ConfigChangeEvent change{};
 };
 
 struct CVLStateChanged {
+    static constexpr const char* kEventName = "CVLStateChanged";
     EventMetadata metadata{};
     CVL_StateChange state{};
 };
 
 struct StatusMessage {
+    static constexpr const char* kEventName = "StatusMessage";
     EventMetadata metadata{};
     StatusLevel level = StatusLevel::Info;
     char message[64] = {};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace tinybms::event {
+
+// Default capture budget: four pointers (e.g. `this` plus a shared_ptr).
+constexpr size_t kInplaceFunctionCapacity = 4 * sizeof(void*);
+
+template <typename Signature, size_t Capacity = kInplaceFunctionCapacity>
+class InplaceFunction;
+
+/**
+ * @brief Move-only callable stored inside the object, never on the heap.
+ *
+ * The callable (typically a lambda and its captures) is constructed in a
+ * fixed `Capacity`-byte buffer and called through one function pointer. A
+ * callable that does not fit is a compile error instead of a hidden
+ * allocation: capture a pointer to the larger state instead. Calling an empty
+ * InplaceFunction throws std::bad_function_call, like std::function.
+ */
+template <typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    template <typename F,
+              typename Fn = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<Fn, InplaceFunction> &&
+                                          std::is_invocable_r_v<R, Fn&, Args...>>>
+    InplaceFunction(F&& callable) {
+        static_assert(sizeof(Fn) <= Capacity,
+                      "callable does not fit in InplaceFunction: capture a pointer instead");
+        static_assert(alignof(Fn) <= kAlignment, "callable is over-aligned for InplaceFunction");
+        static_assert(std::is_nothrow_move_constructible_v<Fn>,
+                      "InplaceFunction needs a nothrow-movable callable");
+        ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(callable));
+        ops_ = &kOps<Fn>;
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept { moveFrom(other); }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ~InplaceFunction() { reset(); }
+
+    R operator()(Args... args) const {
+        if (ops_ == nullptr) {
+            throw std::bad_function_call();
+        }
+        return ops_->invoke(storage_, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    friend bool operator==(const InplaceFunction& fn, std::nullptr_t) noexcept { return !fn; }
+    friend bool operator!=(const InplaceFunction& fn, std::nullptr_t) noexcept { return static_cast<bool>(fn); }
+
+private:
+    static constexpr size_t kAlignment = alignof(std::max_align_t);
+
+    struct Ops {
+        R (*invoke)(void* callable, Args&&... args);
+        void (*move)(void* to, void* from) noexcept;   // move-constructs, then destroys `from`
+        void (*destroy)(void* callable) noexcept;
+    };
+
+    template <typename Fn>
+    static R invokeAs(void* callable, Args&&... args) {
+        return (*static_cast<Fn*>(callable))(std::forward<Args>(args)...);
+    }
+
+    template <typename Fn>
+    static void moveAs(void* to, void* from) noexcept {
+        ::new (to) Fn(std::move(*static_cast<Fn*>(from)));
+        static_cast<Fn*>(from)->~Fn();
+    }
+
+    template <typename Fn>
+    static void destroyAs(void* callable) noexcept {
+        static_cast<Fn*>(callable)->~Fn();
+    }
+
+    template <typename Fn>
+    static constexpr Ops kOps{&invokeAs<Fn>, &moveAs<Fn>, &destroyAs<Fn>};
+
+    void moveFrom(InplaceFunction& other) noexcept {
+        if (other.ops_ != nullptr) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    void reset() noexcept {
+        if (ops_ != nullptr) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    alignas(kAlignment) mutable unsigned char storage_[Capacity];
+    const Ops* ops_ = nullptr;
+};
+
+// Event bus callback types.
+template <typename Event>
+using EventCallback = InplaceFunction<void(const Event&)>;
+
+template <typename Event>
+using EventKeyFn = InplaceFunction<uint32_t(const Event&)>;
+
+template <typename Event>
+using EventFilter = InplaceFunction<bool(const Event&)>;
+
+} // namespace tinybms::event
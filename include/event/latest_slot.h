@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+namespace tinybms::event {
+
+/**
+ * @brief Latest value of one event type, read without locks.
+ *
+ * The value lives in one of `Buffers` copies; an atomic index names the
+ * current one and each copy counts the readers using it. Readers pin the
+ * current copy (increment, then re-check the index) and never block. The
+ * writer fills a copy that is neither current nor pinned, then publishes its
+ * index, so a reader always sees a complete value. With three copies the
+ * writer only waits when readers still pin both older values. It never
+ * sleeps: after a few yields it skips the update (counted in skippedStores())
+ * and the slot keeps the previous value until the next store(). Readers that
+ * run often should borrow() rather than load() a large event: a short pin
+ * keeps the spare copies free.
+ *
+ * Writers must be serialised by the caller (EventBusV2 holds the channel mutex).
+ */
+template <typename Event, size_t Buffers = 3>
+class LatestSlot {
+    static_assert(Buffers >= 2 && Buffers < 0xFF, "LatestSlot needs 2..254 buffers");
+
+public:
+    /**
+     * @return false when readers pinned every spare copy for the whole
+     *         (bounded) wait: the update was skipped.
+     */
+    bool store(const Event& event) {
+        const uint8_t current = current_.load(std::memory_order_relaxed);
+        for (uint32_t attempt = 0; attempt <= kYieldAttempts; ++attempt) {
+            for (uint8_t i = 0; i < Buffers; ++i) {
+                if (i != current && buffers_[i].readers.load(std::memory_order_seq_cst) == 0) {
+                    buffers_[i].value = event;
+                    current_.store(i, std::memory_order_seq_cst);
+                    return true;
+                }
+            }
+            if (attempt < kYieldAttempts) {
+                std::this_thread::yield();
+            }
+        }
+        skipped_stores_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * @brief Copy the latest value into `out`.
+     * @return false when nothing was stored yet.
+     */
+    bool load(Event& out) const {
+        return borrow([&out](const Event& value) { out = value; });
+    }
+
+    /**
+     * @brief Run `fn(const Event&)` on the latest value in place.
+     *
+     * The value cannot change while `fn` runs; keep `fn` short and never
+     * publish the same event type from it.
+     * @return false (and `fn` not called) when nothing was stored yet.
+     */
+    template <typename Fn>
+    bool borrow(Fn&& fn) const {
+        const uint8_t index = pin();
+        if (index == kEmpty) {
+            return false;
+        }
+        std::forward<Fn>(fn)(buffers_[index].value);
+        buffers_[index].readers.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    bool hasValue() const { return current_.load(std::memory_order_acquire) != kEmpty; }
+
+    // Updates skipped because readers held every spare copy.
+    uint32_t skippedStores() const { return skipped_stores_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr uint8_t kEmpty = 0xFF;
+    static constexpr uint32_t kYieldAttempts = 16;
+
+    struct Buffer {
+        Event value{};
+        mutable std::atomic<uint32_t> readers{0};
+    };
+
+    uint8_t pin() const {
+        for (;;) {
+            const uint8_t index = current_.load(std::memory_order_acquire);
+            if (index == kEmpty) {
+                return kEmpty;
+            }
+            buffers_[index].readers.fetch_add(1, std::memory_order_seq_cst);
+            // Still current: the writer will not touch this copy until we release it.
+            if (current_.load(std::memory_order_seq_cst) == index) {
+                return index;
+            }
+            buffers_[index].readers.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    std::array<Buffer, Buffers> buffers_{};
+    std::atomic<uint8_t> current_{kEmpty};
+    std::atomic<uint32_t> skipped_stores_{0};
+};
+
+} // namespace tinybms::event
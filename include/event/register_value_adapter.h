@@ -0,0 +1,32 @@
+#pragma once
+
+#include "event/event_bus_v2.h"
+#include "event/event_subscriber.h"
+#include "event/event_types_v2.h"
+
+namespace tinybms::event {
+
+/**
+ * @brief Compatibility adapter: republishes each RegisterCycleBatch entry as
+ *        an individual MqttRegisterValue.
+ *
+ * Only does work while something subscribes to MqttRegisterValue; consumers
+ * that iterate the batch directly pay nothing for it.
+ */
+class RegisterValueAdapter {
+public:
+    explicit RegisterValueAdapter(EventBusV2& bus);
+
+    bool begin();
+    void end();
+    bool isActive() const { return subscription_.isActive(); }
+
+    // Publish the entries of `batch` (exposed for tests).
+    size_t split(const tinybms::events::RegisterCycleBatch& batch);
+
+private:
+    EventBusV2& bus_;
+    EventSubscriber subscription_;
+};
+
+} // namespace tinybms::event
@@ -12,6 +12,7 @@ struct UartConfig {
     uint32_t baudrate = 115200;
     uint32_t timeout_ms = 1000;
     bool use_dma = false;
+    int port = -1;               // hardware UART number, -1 = driver default
 };
 
 struct CanFilterConfig {
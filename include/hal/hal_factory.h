@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "hal/hal_config.h"
 #include "hal/interfaces/ihal_can.h"
 #include "hal/interfaces/ihal_gpio.h"
@@ -21,6 +22,12 @@ public:
     virtual std::unique_ptr<IHalGpio> createGpio() = 0;
     virtual std::unique_ptr<IHalTimer> createTimer() = 0;
     virtual std::unique_ptr<IHalWatchdog> createWatchdog() = 0;
+
+    /**
+     * @brief Hardware UART numbers createUart() can drive, the default port
+     *        (UartConfig::port == -1) first. Empty: the default port only.
+     */
+    virtual std::vector<int> uartPorts() const { return {}; }
 };
 
 void setFactory(std::unique_ptr<HalFactory> factory);
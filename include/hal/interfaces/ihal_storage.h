@@ -24,6 +24,7 @@ public:
     virtual ~IHalStorage() = default;
 
     virtual Status mount(const StorageConfig& config) = 0;
+    virtual StorageType type() const = 0;   // backend selected by the last mount()
     virtual bool exists(const std::string& path) = 0;
     virtual std::unique_ptr<IHalStorageFile> open(const std::string& path, StorageOpenMode mode) = 0;
     virtual bool remove(const std::string& path) = 0;
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "hal/interfaces/ihal_uart.h"
+#include "uart/tinybms_uart_trace.h"
+
+namespace hal {
+
+struct ReplayUartStats {
+    uint32_t tx_matched = 0;
+    uint32_t tx_mismatched = 0;        // written bytes differ from the trace
+    uint32_t tx_beyond_trace = 0;      // writes after the last recorded TX
+    uint32_t rx_bytes_delivered = 0;
+    uint32_t rx_bytes_discarded = 0;   // RX left unread when the next TX was written
+    uint32_t read_timeouts = 0;
+};
+
+/**
+ * @brief Host-side IHalUart that plays a recorded UART trace back.
+ *
+ * Time is virtual: readBytes() jumps to the next recorded RX arrival when it
+ * falls within the read timeout, otherwise it consumes the whole timeout and
+ * returns 0, so a replay is deterministic and runs as fast as the host
+ * allows. Delays taken by the code under test must be reported via advance().
+ *
+ * Each write() is matched with the next recorded TX; the RX that followed it
+ * in the trace arrives with the recorded gaps divided by `speed` (speed 0
+ * delivers it immediately). RX recorded before the first TX (broadcasts)
+ * arrives relative to the start of the replay.
+ */
+class ReplayUart : public IHalUart {
+public:
+    explicit ReplayUart(std::vector<tinybms::UartTraceEvent> events, float speed = 1.0f);
+
+    Status initialize(const UartConfig& config) override;
+    void setTimeout(uint32_t timeout_ms) override { timeout_ms_ = timeout_ms; }
+    uint32_t getTimeout() const override { return timeout_ms_; }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    void flush() override {}
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    int available() override;
+    int read() override;
+
+    void advance(uint32_t delay_ms) { now_us_ += static_cast<uint64_t>(delay_ms) * 1000U; }
+    uint32_t nowMs() const { return static_cast<uint32_t>(now_us_ / 1000U); }
+    uint32_t nowUs() const { return static_cast<uint32_t>(now_us_); }
+    bool finished() const { return next_ >= events_.size() && rx_pending_.empty(); }
+    const ReplayUartStats& stats() const { return stats_; }
+
+private:
+    uint64_t arrivalUs(const tinybms::UartTraceEvent& event) const;
+    void releaseArrived();
+
+    std::vector<tinybms::UartTraceEvent> events_;
+    float speed_;
+    size_t next_ = 0;
+    uint64_t now_us_ = 0;
+    uint64_t anchor_us_ = 0;           // virtual time of anchor_trace_ms_
+    uint32_t anchor_trace_ms_ = 0;
+    uint32_t timeout_ms_ = 100;
+    std::deque<uint8_t> rx_pending_;
+    ReplayUartStats stats_{};
+};
+
+} // namespace hal
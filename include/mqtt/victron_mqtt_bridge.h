@@ -31,7 +31,8 @@ private:
 #ifdef ARDUINO
     static void onMqttEvent(void* handler_args, esp_event_base_t base, int32_t event_id, void* event_data);
 #endif
-    void handleRegisterEvent(const tinybms::events::MqttRegisterValue& event);
+    void handleRegisterBatch(const tinybms::events::RegisterCycleBatch& batch);
+    void handleRegisterEvent(const tinybms::events::MqttRegisterEvent& payload);
     void handleAlarmEvent(const tinybms::events::AlarmRaised& event);
     void handleAlarmCleared(const tinybms::events::AlarmCleared& event);
     void handleWarningEvent(const tinybms::events::WarningRaised& event);
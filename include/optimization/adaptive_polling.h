@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace optimization {
@@ -14,6 +15,24 @@ struct AdaptivePollingConfig {
     uint32_t latency_slack_ms = 15;
     uint8_t failure_threshold = 3;
     uint8_t success_threshold = 6;
+    // Response timeout and retry delay derived from the RTT estimate.
+    bool adaptive_timeouts = true;
+    uint32_t response_timeout_min_ms = 20;
+    uint32_t response_timeout_max_ms = 1000;
+    uint32_t retry_delay_min_ms = 5;
+    uint32_t retry_delay_max_ms = 50;
+    uint32_t byte_time_us = 87;    // one byte on the wire (10 bits at 115200 baud)
+};
+
+/**
+ * @brief Smoothed round-trip estimate for one command (Jacobson/Karels).
+ */
+struct RttEstimate {
+    uint8_t command = 0;
+    uint32_t samples = 0;
+    uint32_t srtt_us = 0;
+    uint32_t rttvar_us = 0;
+    uint8_t backoff = 0;           // consecutive timeouts, doubles the timeout
 };
 
 class AdaptivePoller {
@@ -34,10 +53,40 @@ public:
     void recordFailure(uint32_t latency_ms);
     void recordTimeout();
 
+    /**
+     * @brief Feed the RTT estimator of a command with its turnaround (request
+     *        written -> first response byte), which does not depend on the
+     *        response length. Only first attempts should be sampled (Karn): a
+     *        retry's answer may belong to the request before.
+     */
+    void recordRtt(uint8_t command, uint32_t turnaround_us);
+    /**
+     * @brief An attempt of this command timed out: back the timeout off
+     *        (x2 per consecutive timeout, up to x8) until the next sample.
+     */
+    void recordRttTimeout(uint8_t command);
+
+    /**
+     * @brief SRTT + 4 * RTTVAR plus the transfer time of `response_bytes`,
+     *        backed off and clamped to the configured bounds; the ceiling
+     *        while the command has no sample yet.
+     */
+    uint32_t responseTimeoutMs(uint8_t command, size_t response_bytes = 0) const;
+    /**
+     * @brief 4 * RTTVAR (a straggler lands within the spread), clamped; the
+     *        ceiling while the command has no sample yet.
+     */
+    uint32_t retryDelayMs(uint8_t command) const;
+
+    static constexpr size_t kRttSlots = 4;
+    const RttEstimate* rttEstimate(uint8_t command) const;
+    const RttEstimate* rttEstimates() const { return rtt_; }
+
 private:
     void clampInterval();
     void backoff(uint32_t latency_ms);
     void recover(uint32_t latency_ms);
+    RttEstimate* rttSlot(uint8_t command);
 
     AdaptivePollingConfig config_{};
     uint32_t interval_ms_ = 100;
@@ -47,6 +96,7 @@ private:
     uint32_t latency_samples_ = 0;
     uint32_t failure_streak_ = 0;
     uint32_t success_streak_ = 0;
+    RttEstimate rtt_[kRttSlots]{};
 };
 
 }  // namespace optimization
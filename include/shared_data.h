@@ -8,6 +8,9 @@
 
 #include <Arduino.h>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
 
 #include "tiny_read_mapping.h"
 
@@ -15,13 +18,55 @@ constexpr size_t TINY_LIVEDATA_MAX_REGISTERS = 32;
 
 constexpr size_t TINY_REGISTER_MAX_WORDS = 8;
 
+// Deux caractères par mot : le plus long registre chaîne tient sans troncature.
+constexpr size_t TINY_REGISTER_TEXT_CAPACITY = TINY_REGISTER_MAX_WORDS * 2;
+
+/**
+ * @struct TinyRegisterText
+ * @brief Texte d'un registre chaîne stocké en ligne (pas d'allocation, copiable par memcpy)
+ *
+ * Remplace l'ancien `String text_value` des snapshots. `c_str()`, `length()` et la
+ * conversion implicite vers `String` gardent les lecteurs historiques compilables.
+ */
+struct TinyRegisterText {
+    char chars[TINY_REGISTER_TEXT_CAPACITY + 1];
+    uint8_t size;
+
+    void clear() {
+        size = 0;
+        chars[0] = '\0';
+    }
+
+    // Tronque au-delà de TINY_REGISTER_TEXT_CAPACITY caractères.
+    void assign(const char* text, size_t length) {
+        size = static_cast<uint8_t>(std::min(length, TINY_REGISTER_TEXT_CAPACITY));
+        if (size > 0) {
+            std::memcpy(chars, text, size);
+        }
+        chars[size] = '\0';
+    }
+
+    bool append(char c) {
+        if (size >= TINY_REGISTER_TEXT_CAPACITY) {
+            return false;
+        }
+        chars[size++] = c;
+        chars[size] = '\0';
+        return true;
+    }
+
+    const char* c_str() const { return chars; }
+    size_t length() const { return size; }
+    operator String() const { return String(chars); }
+};
+
 struct TinyRegisterSnapshot {
     int32_t raw_value;
     uint16_t address;
     uint8_t raw_word_count;
     uint8_t type;
     bool has_text;
-    String text_value;
+    TinyRegisterText text_value;
     uint16_t raw_words[TINY_REGISTER_MAX_WORDS];
 };
 
@@ -38,6 +83,10 @@ struct TinyRegisterSnapshot {
  * garantir la stabilité de l'API historique. Les nouveaux champs TinyBMS doivent être
  * exposés via `register_snapshots` ou des helpers dédiés plutôt qu'en modifiant le
  * layout existant.
+ *
+ * Layout v2 : le texte des registres chaîne est stocké en ligne (`TinyRegisterText`),
+ * la structure est trivialement copiable. `getLatest()`, les copies de `LiveDataUpdate`
+ * et `publish()` par valeur se réduisent à un memcpy, sans allocation.
  */
 struct TinyBMS_LiveData {
     float voltage;               // V
@@ -88,7 +137,7 @@ struct TinyBMS_LiveData {
                         TinyRegisterValueType type,
                         int32_t raw_value,
                         uint8_t raw_words,
-                        const String* text_value,
+                        const TinyRegisterText* text_value,
                         const uint16_t* words_buffer) {
         if (register_count >= TINY_LIVEDATA_MAX_REGISTERS) {
             return false;
@@ -103,7 +152,7 @@ struct TinyBMS_LiveData {
         if (snap.has_text) {
             snap.text_value = *text_value;
         } else {
-            snap.text_value = String();
+            snap.text_value.clear();
         }
 
         if (words_buffer && raw_words > 0) {
@@ -122,6 +171,21 @@ struct TinyBMS_LiveData {
         return true;
     }
 
+    // Compatibilité : texte fourni sous forme de String (tronqué à TINY_REGISTER_TEXT_CAPACITY).
+    bool appendSnapshot(uint16_t address,
+                        TinyRegisterValueType type,
+                        int32_t raw_value,
+                        uint8_t raw_words,
+                        const String* text_value,
+                        const uint16_t* words_buffer) {
+        TinyRegisterText text;
+        text.clear();
+        if (text_value != nullptr) {
+            text.assign(text_value->c_str(), text_value->length());
+        }
+        return appendSnapshot(address, type, raw_value, raw_words, &text, words_buffer);
+    }
+
     const TinyRegisterSnapshot* findSnapshot(uint16_t address) const {
         for (uint16_t i = 0; i < register_count; ++i) {
             if (register_snapshots[i].address == address) {
@@ -212,7 +276,7 @@ struct TinyBMS_LiveData {
     void applyBinding(const TinyRegisterRuntimeBinding& binding,
                       int32_t raw_value,
                       float scaled_value,
-                      const String* text_value,
+                      const TinyRegisterText* text_value,
                       const uint16_t* words_buffer) {
         applyField(binding.live_field, scaled_value, raw_value);
 
@@ -233,6 +297,11 @@ struct TinyBMS_LiveData {
     }
 };
 
+static_assert(std::is_trivially_copyable<TinyRegisterSnapshot>::value,
+              "TinyRegisterSnapshot must stay memcpy-able");
+static_assert(std::is_trivially_copyable<TinyBMS_LiveData>::value,
+              "TinyBMS_LiveData must stay memcpy-able");
+
 // ====================================================================================
 // OUTILS DE LOG (FACULTATIFS)
 // ====================================================================================
@@ -30,6 +30,14 @@ enum class TinyRegisterDataSlice : uint8_t {
     HighByte
 };
 
+// Polling cadence of a binding (periods in ConfigManager::TinyBMSConfig).
+enum class TinyRegisterRefreshClass : uint8_t {
+    Fast = 0,   // live measurements: every cycle
+    Normal,     // temperatures, status, limits
+    Slow,       // cutoffs and settings that only change on reconfiguration
+    Once        // identification strings: at boot and on demand
+};
+
 enum class TinyLiveDataField : uint8_t {
     None = 0,
     Voltage,
@@ -62,6 +70,11 @@ struct TinyRegisterMetadata {
     String unit;
     String comment;
     String raw_key;
+    // Report-by-exception of register events ("report_deadband": 0.05 or
+    // "2%", "report_heartbeat_ms"); see tinybms::ReportPolicy.
+    float report_deadband = 0.0f;
+    bool report_deadband_percent = false;
+    uint32_t report_heartbeat_ms = 60000;
 };
 
 struct TinyRegisterRuntimeBinding {
@@ -76,6 +89,7 @@ struct TinyRegisterRuntimeBinding {
     const char* fallback_unit = nullptr;
     const TinyRegisterMetadata* metadata = nullptr;
     TinyRegisterDataSlice data_slice = TinyRegisterDataSlice::FullWord;
+    TinyRegisterRefreshClass refresh_class = TinyRegisterRefreshClass::Normal;
 };
 
 bool initializeTinyReadMapping(fs::FS& fs, const char* path, Logger* logger = nullptr);
@@ -88,5 +102,9 @@ const TinyRegisterMetadata* findTinyRegisterMetadata(uint16_t address);
 const std::vector<TinyRegisterRuntimeBinding>& getTinyRegisterBindings();
 const TinyRegisterRuntimeBinding* findTinyRegisterBinding(uint16_t address);
 
+// Incremented each time the mapping is (re)loaded; consumers cache derived
+// data (e.g. the UART read plan) and rebuild it when the value changes.
+uint32_t getTinyReadMappingVersion();
+
 String tinyRegisterTypeToString(TinyRegisterValueType type);
 
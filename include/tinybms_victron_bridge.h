@@ -6,12 +6,29 @@
 #pragma once
 
 #include <Arduino.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "shared_data.h"
 #include "bridge_event_sink.h"
 #include "cvl_types.h"
 #include "hal/interfaces/ihal_uart.h"
 #include "optimization/adaptive_polling.h"
 #include "optimization/ring_buffer.h"
+#include "uart/tinybms_broadcast.h"
+#include "uart/tinybms_decode_plan.h"
+#include "uart/tinybms_latency_histogram.h"
+#include "uart/tinybms_link_tracker.h"
+#include "uart/tinybms_pack_aggregator.h"
+#include "uart/tinybms_pack_poller.h"
+#include "uart/tinybms_poll_scheduler.h"
+#include "uart/tinybms_register_store.h"
+#include "uart/tinybms_transaction_queue.h"
+#include "uart/tinybms_uart_trace.h"
+#include "victron_pgn_cache.h"
+#include "victron_pgn_scheduler.h"
 
 class HardwareSerial;
 class WatchdogManager;
@@ -33,6 +50,15 @@ struct TinyBMS_Config {
     float    low_temp_charge_cutoff_c = 0.0f;
 };
 
+struct UartRttStats {
+    uint8_t command = 0;
+    uint32_t samples = 0;
+    uint32_t srtt_us = 0;
+    uint32_t rttvar_us = 0;
+    uint32_t timeout_ms = 0;
+    uint32_t retry_delay_ms = 0;
+};
+
 struct BridgeStats {
     uint32_t can_tx_count = 0;
     uint32_t can_rx_count = 0;
@@ -45,6 +71,18 @@ struct BridgeStats {
     uint32_t uart_timeouts = 0;
     uint32_t uart_crc_errors = 0;
     uint32_t uart_retry_count = 0;
+    uint32_t uart_garbage_bytes = 0;
+    uint32_t uart_resync_count = 0;
+    uint32_t uart_partial_frames = 0;
+    uint32_t uart_cycle_bytes_last = 0;
+    uint32_t uart_events_reported = 0;       // register values published (RegisterCycleBatch entries)
+    uint32_t uart_events_suppressed = 0;     // unchanged within deadband
+    uint32_t uart_wakeups_sent = 0;
+    uint32_t uart_wakeups_skipped = 0;
+    uint32_t uart_wakeup_skip_failures = 0;
+    uint32_t uart_wakeup_saved_ms = 0;
+    uint32_t uart_sleep_threshold_ms = 0;
+    UartRttStats uart_rtt[optimization::AdaptivePoller::kRttSlots]{};
     uint32_t uart_latency_last_ms = 0;
     uint32_t uart_latency_max_ms = 0;
     float    uart_latency_avg_ms = 0.0f;
@@ -65,6 +103,20 @@ namespace mqtt {
 class Publisher;
 } // namespace mqtt
 
+class TinyBMS_Victron_Bridge;
+
+/**
+ * @brief Additional TinyBMS of a multi-pack bank: its own UART, poll loop
+ *        (TinyBMS_Victron_Bridge::packPollTask) and wake-up tracking.
+ */
+struct TinyPackLink {
+    TinyBMS_Victron_Bridge* bridge = nullptr;
+    size_t index = 0;                                // PackAggregator slot, pack 0 = tiny_uart_
+    std::unique_ptr<hal::IHalUart> uart;
+    std::unique_ptr<tinybms::PackPoller> poller;
+    tinybms::LinkTracker link;
+};
+
 class TinyBMS_Victron_Bridge {
 public:
     TinyBMS_Victron_Bridge();
@@ -78,12 +130,36 @@ public:
     BridgeEventSink& eventSink() const;
 
     static void uartTask(void *pvParameters);
+    static void uartWorkerTask(void *pvParameters);
+    static void packPollTask(void *pvParameters);    // one per TinyPackLink
     static void canTask(void *pvParameters);
     static void cvlTask(void *pvParameters);
 
-    bool readTinyRegisters(uint16_t start_addr, uint16_t count, uint16_t* output);
-    bool readTinyRegisters(const uint16_t* addresses, size_t count, uint16_t* output);
-    bool writeTinyRegisters(const uint16_t* addresses, const uint16_t* values, size_t count);
+    using TinyTransactionCallable = std::function<tinybms::TransactionResult(
+        hal::IHalUart&, const tinybms::TransactionOptions&, const tinybms::DelayConfig&)>;
+
+    // Blocking helpers: queued on the UART worker, the caller waits for the result.
+    bool readTinyRegisters(uint16_t start_addr, uint16_t count, uint16_t* output,
+                           tinybms::TransactionPriority priority = tinybms::TransactionPriority::ConfigRead);
+    bool readTinyRegisters(const uint16_t* addresses, size_t count, uint16_t* output,
+                           tinybms::TransactionPriority priority = tinybms::TransactionPriority::ConfigRead);
+    bool writeTinyRegisters(const uint16_t* addresses, const uint16_t* values, size_t count,
+                            tinybms::TransactionPriority priority = tinybms::TransactionPriority::ConfigWrite);
+
+    /**
+     * @brief Queue a TinyBMS transaction without waiting for it.
+     *
+     * `callable` runs on the UART worker with exclusive access to the link;
+     * buffers it captures must stay valid until `on_complete` fires.
+     * `deadline_ms` is an absolute millis() value (0 = none).
+     */
+    tinybms::TransactionTicket submitTinyTransaction(tinybms::TransactionPriority priority,
+                                                     uint32_t deadline_ms,
+                                                     size_t register_words,
+                                                     TinyTransactionCallable callable,
+                                                     tinybms::TransactionCompletion on_complete = nullptr,
+                                                     const char* context_label = "async transaction");
+    void requestTinyRegisterRefresh(uint16_t address);
 
     bool sendVictronPGN(uint16_t pgn_id, const uint8_t* data, uint8_t dlc);
 
@@ -105,8 +181,30 @@ public:
 
 public:
     hal::IHalUart* tiny_uart_;
-    optimization::AdaptivePoller uart_poller_;
+    optimization::AdaptivePoller uart_poller_;                 // guarded by uart_poller_mutex_
+    std::mutex uart_poller_mutex_;
     optimization::ByteRingBuffer uart_rx_buffer_;
+    tinybms::PollScheduler uart_scheduler_;
+    std::vector<uint16_t> uart_read_buffer_;
+    tinybms::RegisterStore uart_register_cache_;   // last raw word per polled address
+    tinybms::DecodePlan uart_decode_plan_;         // bindings compiled against uart_register_cache_
+    tinybms::ReportFilter uart_report_filter_;     // report-by-exception of register events
+    tinybms::events::RegisterCycleBatch uart_cycle_batch_;   // register events of the current poll cycle
+    bool uart_events_ready_ = false;
+    uint32_t uart_batch_drops_seen_ = 0;           // droppedRegisterBatches() at the last cycle
+    uint8_t packs_fresh_mask_ = 0;                 // packs merged at the last combine (uartTask)
+    tinybms::TransactionQueue uart_queue_;
+    std::atomic<bool> uart_worker_running_{false};
+    tinybms::BroadcastListener uart_broadcast_;          // guarded by uart_broadcast_mutex_
+    std::mutex uart_broadcast_mutex_;
+    std::atomic<bool> uart_broadcast_enabled_{false};    // TinyBMSConfig::broadcast_expected
+    tinybms::LinkTracker uart_link_;                     // wake-up pulse decisions (UART worker)
+    tinybms::UartTraceRecorder uart_trace_;              // optional TX/RX capture to storage
+    tinybms::UartLatencyStats uart_latency_;             // per command/outcome attempt latency
+    tinybms::PackAggregator packs_;                      // combined view of a multi-pack bank
+    std::vector<std::unique_ptr<TinyPackLink>> extra_packs_;
+    tinybms::PgnScheduler can_pgn_scheduler_;            // per-PGN periods and phases (CAN task)
+    tinybms::PgnPayloadCache can_pgn_cache_;             // identity payloads, rebuilt when an input changes
 
     TinyBMS_Config   config_{};
     BridgeStats      stats{};
@@ -123,14 +221,18 @@ public:
     uint32_t last_keepalive_tx_ms_= 0;
     uint32_t last_keepalive_rx_ms_= 0;
 
-    uint32_t uart_poll_interval_ms_  = 100;
+    std::atomic<uint32_t> uart_poll_interval_ms_{100};   // adapted by the UART worker, read by the poll tasks
     uint32_t pgn_update_interval_ms_ = 1000;
+    uint32_t pgn_energy_interval_ms_ = 5000;
+    uint32_t pgn_identity_interval_ms_ = 10000;
     uint32_t cvl_update_interval_ms_ = 20000;
     uint32_t keepalive_interval_ms_  = 1000;
     uint32_t keepalive_timeout_ms_   = 10000;
 
 private:
     void updateEnergyCounters(uint32_t now_ms, const TinyBMS_LiveData& live);
+    void configurePgnSchedule(uint32_t now_ms);
+    void sendScheduledPgn(size_t index, const TinyBMS_LiveData& live);
 
     uint32_t last_energy_update_ms_ = 0;
 };
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "uart/tinybms_frame_parser.h"
+#include "uart/tinybms_register_store.h"
+
+namespace tinybms {
+
+/**
+ * @brief One register word recovered from an unsolicited TinyBMS frame.
+ */
+struct RegisterWord {
+    uint16_t address = 0;
+    uint16_t value = 0;
+};
+
+constexpr size_t kBroadcastMaxWords = 32;
+
+/**
+ * @brief Frame layouts of the live-data commands the TinyBMS emits on its own
+ *        when a broadcast interval is configured (register 342).
+ */
+const FrameParser::FrameLayout* broadcastFrameLayouts(size_t& count);
+
+/**
+ * @brief Translate a broadcast frame into the register words the poll path
+ *        would have read (same addresses, same scaling as tiny_read_mapping).
+ * @return Number of words written to `out` (0 for unknown or malformed frames).
+ */
+size_t decodeBroadcastFrame(const FrameView& frame, RegisterWord* out, size_t capacity);
+
+struct BroadcastStats {
+    uint32_t frames = 0;           // broadcast frames decoded
+    uint32_t words = 0;            // register words recovered
+    uint32_t ignored_frames = 0;   // valid frames that carry no live data (ACK/NACK, ...)
+    uint32_t last_frame_ms = 0;
+};
+
+/**
+ * @brief Receive-only decoder for the unsolicited TinyBMS stream.
+ *
+ * Bytes are pushed as they arrive; decoded words are queued until the poll
+ * task merges them into its register cache. Each frame type tracks its own
+ * arrival period so coveredAddresses() only reports registers whose broadcast
+ * is still current, everything else falls back to active polling.
+ *
+ * Not thread-safe: the owner serialises feed() and takeUpdates().
+ */
+class BroadcastListener {
+public:
+    BroadcastListener();
+
+    void reset();
+
+    void feed(const uint8_t* data, size_t length, uint32_t now_ms);
+
+    /**
+     * @brief Merge the words decoded since the last call into `registers`
+     *        (words outside its layout are dropped).
+     * @return Refresh-class mask of the bindings touched (0 if nothing new).
+     */
+    uint8_t takeUpdates(RegisterStore& registers);
+
+    /**
+     * @brief Sorted addresses whose broadcast has not gone stale at `now_ms`.
+     */
+    std::vector<uint16_t> coveredAddresses(uint32_t now_ms) const;
+
+    /**
+     * @brief True while at least one frame type is still being received.
+     */
+    bool active(uint32_t now_ms) const;
+
+    const BroadcastStats& stats() const { return stats_; }
+    const FrameParserStats& parserStats() const { return parser_.stats(); }
+
+private:
+    struct Source {
+        uint8_t command = 0;
+        bool seen = false;
+        uint32_t last_ms = 0;
+        uint32_t period_ms = 0;    // smoothed inter-arrival time, 0 until the second frame
+        std::array<uint16_t, kBroadcastMaxWords> addresses{};
+        uint8_t address_count = 0;
+    };
+
+    void handleFrame(uint32_t now_ms);
+    bool isCurrent(const Source& source, uint32_t now_ms) const;
+
+    FrameParser parser_;
+    FrameParser::Expectation expectation_{};
+    std::vector<Source> sources_;
+    std::vector<RegisterWord> pending_;
+    BroadcastStats stats_{};
+};
+
+} // namespace tinybms
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Slice width used by tinybms::crc::update() when no explicit mode is given.
+ * 1 = one 512-byte table (default), 4/8 = slice-by-N (2 KiB / 4 KiB of flash).
+ */
+#ifndef TINYBMS_CRC16_SLICE_BY
+#define TINYBMS_CRC16_SLICE_BY 1
+#endif
+
+namespace tinybms::crc {
+
+constexpr uint16_t kModbusPolynomial = 0xA001;   // reflected 0x8005
+constexpr uint16_t kModbusInitialState = 0xFFFF;
+
+enum class Crc16Mode : uint8_t {
+    Bytewise = 1,
+    SliceBy4 = 4,
+    SliceBy8 = 8
+};
+
+namespace detail {
+
+constexpr std::array<uint16_t, 256> makeModbusTable() {
+    std::array<uint16_t, 256> table{};
+    for (uint16_t i = 0; i < 256; ++i) {
+        uint16_t crc = i;
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x0001) ? static_cast<uint16_t>((crc >> 1) ^ kModbusPolynomial)
+                                 : static_cast<uint16_t>(crc >> 1);
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+} // namespace detail
+
+inline constexpr std::array<uint16_t, 256> kModbusTable = detail::makeModbusTable();
+
+constexpr Crc16Mode kDefaultMode = static_cast<Crc16Mode>(TINYBMS_CRC16_SLICE_BY);
+
+/**
+ * @brief Fold a single byte into a running CRC state.
+ *
+ * Inline so that byte-at-a-time receive loops (frame parser, ISR-fed buffers)
+ * pay one table lookup per byte.
+ */
+inline uint16_t updateByte(uint16_t state, uint8_t byte) {
+    return static_cast<uint16_t>((state >> 8) ^ kModbusTable[(state ^ byte) & 0xFFu]);
+}
+
+/**
+ * @brief Incremental CRC16/MODBUS update.
+ *
+ * `update(update(s, a, n), b, m)` equals `update(s, ab, n + m)`, so a CRC can
+ * be accumulated chunk by chunk while bytes arrive. Start from
+ * kModbusInitialState; the resulting state is the CRC (no final XOR).
+ */
+uint16_t update(uint16_t state, const uint8_t* data, size_t length, Crc16Mode mode);
+
+inline uint16_t update(uint16_t state, const uint8_t* data, size_t length) {
+    return update(state, data, length, kDefaultMode);
+}
+
+inline uint16_t compute(const uint8_t* data, size_t length) {
+    return update(kModbusInitialState, data, length);
+}
+
+/**
+ * @brief Reference bit-by-bit implementation (tests and benchmarks only).
+ */
+uint16_t computeBitwise(const uint8_t* data, size_t length);
+
+} // namespace tinybms::crc
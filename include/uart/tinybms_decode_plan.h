@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "event/event_types_v2.h"
+#include "shared_data.h"
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_register_store.h"
+#include "uart/tinybms_report_filter.h"
+
+namespace tinybms {
+
+// How the raw value is extracted from the binding's words.
+enum class DecodeKind : uint8_t {
+    None = 0,       // String registers: raw value 0
+    Uint16,
+    Int16,
+    LowByte,
+    SignedLowByte,
+    HighByte,
+    SignedHighByte,
+    Uint32          // low word first
+};
+
+// Text attached to the snapshot / MQTT event.
+enum class DecodeTextKind : uint8_t {
+    None = 0,
+    Chars,          // String registers
+    Version         // register 501: "major.minor"
+};
+
+// How the decoded value lands in TinyBMS_LiveData.
+enum class LiveFieldWrite : uint8_t {
+    None = 0,
+    Scaled,             // float member = scaled value
+    ScaledWithRaw,      // float member = scaled, uint16 member = raw (SOC/SOH)
+    Raw,                // uint16 member = raw
+    SignedRaw,          // int16 member = raw
+    SignedRawTenths,    // int16 member = raw * 10
+    PackTemperatures    // pack_temp_min = raw * 10, pack_temp_max = high byte * 10
+};
+
+/**
+ * @brief Precomputed destination of a TinyLiveDataField.
+ */
+struct LiveFieldDestination {
+    LiveFieldWrite write = LiveFieldWrite::None;
+    float TinyBMS_LiveData::*scaled = nullptr;
+    uint16_t TinyBMS_LiveData::*raw = nullptr;
+    int16_t TinyBMS_LiveData::*signed_raw = nullptr;
+};
+
+/**
+ * @brief Destination table entry for `field` (None for unknown fields).
+ */
+const LiveFieldDestination& liveFieldDestination(TinyLiveDataField field);
+
+/**
+ * @brief One binding resolved against a RegisterStore layout.
+ */
+struct DecodeStep {
+    uint16_t slot = 0;              // first word in RegisterStore::words()
+    uint8_t slot_count = 0;         // words that must be valid (register_count)
+    uint8_t word_count = 0;         // words copied (<= TINY_REGISTER_MAX_WORDS)
+    DecodeKind kind = DecodeKind::Uint16;
+    DecodeTextKind text = DecodeTextKind::None;
+    float scale = 1.0f;
+    LiveFieldDestination destination{};
+    uint16_t snapshot_address = 0;  // metadata address (snapshot)
+    uint16_t event_address = 0;     // metadata address, else register address (MQTT)
+    TinyRegisterValueType value_type = TinyRegisterValueType::Unknown;
+    uint8_t refresh_bit = 0;        // refreshClassBit() of the binding
+    ReportPolicy report{};          // MQTT event deadband / heartbeat
+};
+
+/**
+ * @brief Register bindings compiled into a flat list of decode steps.
+ *
+ * Compiling resolves once what decodeAndApplyBinding() re-derives for every
+ * binding on every cycle: the source slot in the register store, the value
+ * extraction, the text kind and the LiveData destination. apply() is then a
+ * single loop over the steps reading the store's word array. Steps follow the
+ * binding order, so snapshots and events come out as with the map decoder.
+ *
+ * The plan is tied to the store layout it was compiled against; call
+ * ensureCompiled() before apply() whenever the layout may have changed.
+ */
+class DecodePlan {
+public:
+    /**
+     * @brief Compile `bindings` against the layout of `store`. Bindings with
+     *        no words or not covered by the store are left out.
+     */
+    void compile(const std::vector<TinyRegisterRuntimeBinding>& bindings, const RegisterStore& store);
+
+    /**
+     * @brief Recompile when `store` changed layout since the last compile.
+     * @return true when the plan was rebuilt.
+     */
+    bool ensureCompiled(const std::vector<TinyRegisterRuntimeBinding>& bindings, const RegisterStore& store);
+
+    /**
+     * @brief Decode every step whose words are all valid into `live`.
+     *
+     * Steps whose refresh class is in `event_class_mask` also append an MQTT
+     * register event to `events` (when not null), unless `filter` finds the
+     * value unchanged within the step's report policy.
+     * @return Number of steps decoded.
+     */
+    size_t apply(const RegisterStore& store,
+                 TinyBMS_LiveData& live,
+                 uint32_t timestamp_ms,
+                 uint8_t event_class_mask = 0,
+                 std::vector<events::MqttRegisterEvent>* events = nullptr,
+                 ReportFilter* filter = nullptr) const;
+
+    /**
+     * @brief Same, appending the MQTT register events to a cycle batch.
+     *
+     * Events past the batch capacity are counted in `batch->dropped`.
+     */
+    size_t apply(const RegisterStore& store,
+                 TinyBMS_LiveData& live,
+                 uint32_t timestamp_ms,
+                 uint8_t event_class_mask,
+                 events::RegisterCycleBatch* batch,
+                 ReportFilter* filter = nullptr) const;
+
+    const std::vector<DecodeStep>& steps() const { return steps_; }
+    size_t size() const { return steps_.size(); }
+    uint32_t generation() const { return generation_; }   // bumped by every compile()
+
+private:
+    std::vector<DecodeStep> steps_;
+    uint32_t layout_generation_ = 0;
+    uint32_t generation_ = 0;
+};
+
+} // namespace tinybms
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace optimization {
+class ByteRingBuffer;
+}
+
+namespace tinybms {
+
+/**
+ * @brief Zero-copy view of a validated frame (preamble included, CRC excluded).
+ *
+ * The pointer refers to the parser's internal buffer and stays valid until the
+ * next call to FrameParser::reset() or FrameParser::feed().
+ */
+struct FrameView {
+    const uint8_t* data = nullptr;
+    size_t length = 0;
+};
+
+struct FrameParserStats {
+    uint32_t frames_ok = 0;
+    uint32_t garbage_bytes = 0;
+    uint32_t resync_count = 0;
+    uint32_t crc_errors = 0;
+    uint32_t partial_frames = 0;
+};
+
+/**
+ * @brief Incremental state machine for TinyBMS response frames.
+ *
+ * Bytes can be pushed as they arrive (any chunking). The parser hunts for the
+ * 0xAA preamble, validates the header against the expected response, folds
+ * every byte into the CRC on the fly and, when a header or CRC check fails,
+ * rescans the bytes it already holds for the next preamble instead of
+ * dropping the whole attempt.
+ *
+ * Accepted frames:
+ *  - `AA <cmd> <PL> <PL bytes> CRC` when `<cmd>` is the expected command;
+ *  - `AA 01 <status> CRC` (ACK) and `AA 81 <status> CRC` (legacy NACK);
+ *  - `AA 00 <cmd> <error> CRC` (Rev D NACK);
+ *  - any command listed in `Expectation::extra_layouts` (unsolicited frames).
+ */
+class FrameParser {
+public:
+    static constexpr size_t kMaxFrameSize = 256;
+    static constexpr uint8_t kPreamble = 0xAA;
+    static constexpr uint8_t kNoCommand = 0x00;
+
+    /**
+     * @brief Shape of an additional command accepted by the parser.
+     */
+    struct FrameLayout {
+        uint8_t command = kNoCommand;
+        uint8_t body_length = 0;        // fixed body size; 0 = `<PL> <PL bytes>`
+    };
+
+    struct Expectation {
+        uint8_t command = kNoCommand;   // length-prefixed reply command (0x07, 0x09); kNoCommand = ACK/NACK only
+        uint16_t payload_length = 0;    // expected PL byte; 0 = accept any length that fits
+        const FrameLayout* extra_layouts = nullptr;   // e.g. broadcast frames, not owned
+        size_t extra_layout_count = 0;
+    };
+
+    FrameParser() = default;
+
+    void reset(const Expectation& expectation);
+
+    /**
+     * @brief Push bytes into the state machine.
+     * @return Number of bytes consumed. Parsing stops right after a complete
+     *         frame, so any trailing bytes are left to the caller.
+     */
+    size_t feed(const uint8_t* data, size_t length);
+    size_t feed(optimization::ByteRingBuffer& buffer);
+
+    bool frameReady() const { return state_ == State::Complete; }
+    FrameView frame() const;
+
+    /**
+     * @brief Release the completed frame and keep parsing the same stream.
+     *
+     * Unlike reset(), bytes already buffered for rescanning are kept, so a
+     * continuous (unsolicited) stream can be parsed frame after frame.
+     */
+    void consumeFrame();
+
+    /**
+     * @brief Minimum number of bytes still required to complete a frame.
+     *
+     * Reading at most this many bytes never over-reads past the end of the
+     * frame, which keeps blocking `readBytes()` calls frame-aligned.
+     */
+    size_t bytesNeeded() const;
+
+    /**
+     * @brief True when bytes of an incomplete frame are buffered.
+     */
+    bool hasPartialFrame() const;
+
+    /**
+     * @brief Drop an incomplete frame (e.g. on timeout) and count it.
+     * @return true if a partial frame was discarded.
+     */
+    bool abandonPartialFrame();
+
+    const FrameParserStats& stats() const { return stats_; }
+    void resetStats() { stats_ = FrameParserStats{}; }
+
+private:
+    enum class State : uint8_t {
+        WaitPreamble,
+        Command,
+        Header,
+        Body,
+        CrcLow,
+        CrcHigh,
+        Complete
+    };
+
+    void process(uint8_t byte);
+    void startFrame();
+    void append(uint8_t byte);
+    void resync();
+    void drainReplay();
+    bool acceptCommand(uint8_t command);
+    size_t expectedTotalLength() const;
+
+    Expectation expectation_{};
+    State state_ = State::WaitPreamble;
+    std::array<uint8_t, kMaxFrameSize> buffer_{};
+    size_t length_ = 0;
+    size_t body_remaining_ = 0;
+    size_t header_length_ = 0;     // bytes before the body (AA, cmd, PL/...)
+    size_t body_length_ = 0;
+    bool body_length_known_ = false;
+    bool check_payload_length_ = false;
+    uint16_t crc_state_ = 0;
+    uint8_t crc_low_ = 0;
+    std::array<uint8_t, kMaxFrameSize> replay_{};   // bytes to rescan after a resync
+    size_t replay_pos_ = 0;
+    size_t replay_len_ = 0;
+    FrameParserStats stats_{};
+};
+
+} // namespace tinybms
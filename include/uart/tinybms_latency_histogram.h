@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "uart/tinybms_uart_client.h"
+
+namespace tinybms {
+
+/**
+ * @brief Log-bucketed latency histogram in microseconds.
+ *
+ * Each power of two from 128 us to 2^21 us (~2.1 s) is split into four
+ * linear sub-buckets (<= 25 % relative error); bucket 0 holds everything
+ * below 128 us and the last bucket everything above the range.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint8_t kMinShift = 7;
+    static constexpr uint8_t kOctaves = 14;
+    static constexpr uint8_t kSubBuckets = 4;
+    static constexpr size_t kBucketCount = 1 + kOctaves * kSubBuckets + 1;
+
+    void record(uint32_t value_us);
+    void reset();
+
+    uint32_t count() const { return count_; }
+    uint32_t maxUs() const { return max_us_; }
+    /**
+     * @brief Upper bound of the bucket holding the given percentile (0-100),
+     *        capped by the largest recorded value; 0 when empty.
+     */
+    uint32_t percentileUs(float percentile) const;
+
+    const std::array<uint32_t, kBucketCount>& buckets() const { return buckets_; }
+    static size_t bucketIndex(uint32_t value_us);
+    static uint32_t bucketUpperUs(size_t index);
+
+private:
+    std::array<uint32_t, kBucketCount> buckets_{};
+    uint32_t count_ = 0;
+    uint32_t max_us_ = 0;
+};
+
+struct LatencySummary {
+    uint32_t count = 0;
+    uint32_t p50_us = 0;
+    uint32_t p90_us = 0;
+    uint32_t p99_us = 0;
+    uint32_t max_us = 0;
+};
+
+LatencySummary summarize(const LatencyHistogram& histogram);
+
+/**
+ * @brief Per command (0x07/0x09/0x0B/0x0D) and per attempt outcome latency,
+ *        split into time-to-first-byte and byte-transfer time.
+ *
+ * Fed with AttemptTiming from the UART client; attempts that failed to
+ * write are counted but not timed. Thread-safe.
+ */
+class UartLatencyStats {
+public:
+    static constexpr size_t kCommandCount = 4;
+    static constexpr size_t kOutcomeCount = 4;   // Success, Timeout, CrcMismatch, ProtocolError
+
+    struct EntrySnapshot {
+        uint8_t command = 0;
+        AttemptStatus outcome = AttemptStatus::Success;
+        uint32_t attempts = 0;
+        LatencySummary first_byte{};
+        LatencySummary transfer{};
+    };
+
+    void record(const AttemptTiming& timing);
+    void reset();
+
+    /**
+     * @brief Summaries of every (command, outcome) pair seen at least once.
+     */
+    std::vector<EntrySnapshot> snapshot() const;
+    uint32_t untimedAttempts() const;
+
+private:
+    struct Entry {
+        uint32_t attempts = 0;
+        LatencyHistogram first_byte;
+        LatencyHistogram transfer;
+    };
+
+    mutable std::mutex mutex_;
+    std::array<std::array<Entry, kOutcomeCount>, kCommandCount> entries_{};
+    uint32_t untimed_attempts_ = 0;
+};
+
+const char* attemptStatusName(AttemptStatus status);
+
+} // namespace tinybms
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "uart/tinybms_uart_client.h"
+
+namespace tinybms {
+
+struct LinkTrackerConfig {
+    uint32_t initial_sleep_threshold_ms = 1000;   // idle time after which the BMS is assumed asleep
+    uint32_t min_sleep_threshold_ms = 20;
+    uint32_t failures_to_lower = 3;               // consecutive sleep failures before lowering
+    uint32_t probe_interval = 16;                 // pulsed wake-ups between pulse-free probes
+};
+
+struct LinkTrackerStats {
+    uint32_t wakeups_sent = 0;
+    uint32_t wakeups_skipped = 0;
+    uint32_t skip_failures = 0;        // skipped wake-up, first attempt timed out
+    uint32_t latency_saved_ms = 0;     // wake-up delays avoided
+    uint32_t sleep_threshold_ms = 0;
+};
+
+/**
+ * @brief Decides when a TinyBMS transaction needs the wake-up pulse.
+ *
+ * The BMS only drops the first frame after it went to sleep, so the pulse is
+ * sent when the link has been idle longer than the sleep threshold, after a
+ * failed transaction, or before anything was ever received. The threshold
+ * starts conservative and is lowered only after `failures_to_lower`
+ * consecutive pulse-free transactions whose very first attempt timed out but
+ * whose retry succeeded (the BMS was asleep): the new threshold is 3/4 of the
+ * longest of those idle gaps. A clean pulse-free wake-up breaks the streak.
+ *
+ * A lowered threshold recovers: every `probe_interval` pulsed wake-ups, one
+ * gap between the threshold and the initial value is tried without pulse,
+ * and a clean pulse-free wake-up raises the threshold to its idle gap plus
+ * 1/16 of the distance back to the initial value, when that is higher.
+ *
+ * Owned by the UART worker; sleepThresholdMs() may be read from any task.
+ */
+class LinkTracker {
+public:
+    explicit LinkTracker(const LinkTrackerConfig& config = {});
+
+    void configure(const LinkTrackerConfig& config);
+
+    /**
+     * @return false for a pulse-free probe above a lowered threshold too.
+     */
+    bool wakeupNeeded(uint32_t now_ms) const;
+
+    /**
+     * @brief Record traffic from the BMS outside a transaction (broadcasts).
+     */
+    void noteActivity(uint32_t now_ms);
+
+    /**
+     * @param wakeup_cost_ms Time the pulse would have cost (delay + frame).
+     */
+    void recordTransaction(uint32_t start_ms,
+                           uint32_t end_ms,
+                           bool wakeup_sent,
+                           uint32_t wakeup_cost_ms,
+                           const TransactionResult& result);
+
+    uint32_t sleepThresholdMs() const { return threshold_ms_.load(std::memory_order_relaxed); }
+    LinkTrackerStats stats() const;
+    void resetStats();
+
+private:
+    LinkTrackerConfig config_{};
+    std::atomic<uint32_t> threshold_ms_{0};
+    bool has_activity_ = false;
+    bool force_wakeup_ = true;
+    uint32_t last_activity_ms_ = 0;
+    uint32_t sleep_failures_ = 0;           // current streak of pulse-free sleep failures
+    uint32_t sleep_failure_gap_ms_ = 0;     // longest idle gap of that streak
+    uint32_t wakeups_since_probe_ = 0;
+    LinkTrackerStats stats_{};
+
+    void noteSleepFailure(uint32_t idle_ms);
+    void noteCleanWake(uint32_t idle_ms);
+};
+
+} // namespace tinybms
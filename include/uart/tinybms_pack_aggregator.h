@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "shared_data.h"
+
+namespace tinybms {
+
+struct PackStatus {
+    uint8_t index = 0;
+    bool present = false;           // at least one snapshot received
+    bool fresh = false;             // merged into the combined view
+    uint32_t age_ms = 0;
+    uint32_t updates = 0;
+    float capacity_ah = 0.0f;       // 0 = unknown (equal weight)
+    float voltage = 0.0f;
+    float current = 0.0f;
+    float soc_percent = 0.0f;
+    uint16_t min_cell_mv = 0;
+    uint16_t max_cell_mv = 0;
+    uint16_t max_charge_current = 0;     // 0.1 A
+    uint16_t max_discharge_current = 0;  // 0.1 A
+    uint16_t online_status = 0;
+};
+
+/**
+ * @brief Merges the live data of TinyBMS packs wired in parallel into the
+ *        single battery presented to the Victron system.
+ *
+ * Packs silent for longer than the stale delay are left out. The combined
+ * view sums the currents, keeps the extreme cells and temperatures across
+ * packs and weights SOC/SOH by capacity. Charge/discharge limits follow the
+ * weakest pack: parallel packs share current in proportion to capacity, so
+ * the total is min(limit_i * C_total / C_i). Register snapshots come from the
+ * lowest-index fresh pack, with the battery capacity (306) summed.
+ *
+ * Packs are updated from their own poll tasks; all methods are thread-safe.
+ */
+class PackAggregator {
+public:
+    static constexpr size_t kMaxPacks = 4;
+    static constexpr uint16_t kCapacityRegister = 306;
+    static constexpr uint16_t kFaultStatus = 0x9B;
+
+    explicit PackAggregator(size_t pack_count = 1, uint32_t stale_ms = 5000);
+
+    /**
+     * @brief Resize (clamped to 1..kMaxPacks) and forget every snapshot.
+     */
+    void configure(size_t pack_count, uint32_t stale_ms);
+    size_t packCount() const;
+    uint32_t staleMs() const;
+
+    /**
+     * @brief Capacity used to weight a pack whose snapshot lacks register 306.
+     */
+    void setFallbackCapacityAh(size_t pack, float capacity_ah);
+
+    void update(size_t pack, const TinyBMS_LiveData& live, uint32_t now_ms);
+
+    /**
+     * @brief Build the combined view from the fresh packs.
+     * @return Number of packs merged; `out` is left untouched when 0.
+     */
+    size_t combine(uint32_t now_ms, TinyBMS_LiveData& out) const;
+
+    std::vector<PackStatus> status(uint32_t now_ms) const;
+
+private:
+    struct Slot {
+        bool present = false;
+        uint32_t updated_ms = 0;
+        uint32_t updates = 0;
+        float fallback_capacity_ah = 0.0f;
+        TinyBMS_LiveData live{};
+    };
+
+    bool isFresh(const Slot& slot, uint32_t now_ms) const;
+    static float capacityAh(const Slot& slot);
+
+    mutable std::mutex mutex_;
+    std::array<Slot, kMaxPacks> slots_{};
+    size_t pack_count_ = 1;
+    uint32_t stale_ms_ = 5000;
+};
+
+} // namespace tinybms
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "hal/interfaces/ihal_uart.h"
+#include "shared_data.h"
+#include "uart/tinybms_decode_plan.h"
+#include "uart/tinybms_poll_scheduler.h"
+#include "uart/tinybms_read_planner.h"
+#include "uart/tinybms_register_store.h"
+#include "uart/tinybms_uart_client.h"
+
+namespace tinybms {
+
+/**
+ * @brief Run every operation of a read plan over one link and store the words
+ *        read straight into `register_values`; stops at the first failed
+ *        operation.
+ *
+ * `buffer` must hold at least plan.max_operation_words words.
+ */
+TransactionResult readPlanRegisters(hal::IHalUart& uart,
+                                    const ReadPlan& plan,
+                                    uint16_t* buffer,
+                                    RegisterStore& register_values,
+                                    const TransactionOptions& options,
+                                    const DelayConfig& delay);
+
+/**
+ * @brief Decode the register words found in `register_values` into a fresh
+ *        live data snapshot (no MQTT events).
+ */
+void decodeLiveData(const DecodePlan& plan,
+                    const RegisterStore& register_values,
+                    uint32_t now_ms,
+                    TinyBMS_LiveData& live);
+
+struct PackPollerStats {
+    uint32_t cycles = 0;            // plans executed
+    uint32_t failures = 0;
+    uint32_t last_cycle_bytes = 0;
+    TransactionResult last_result{};
+};
+
+/**
+ * @brief Poll loop state of one TinyBMS link: its own refresh scheduler,
+ *        register cache and read buffer.
+ *
+ * Used for the additional packs of a multi-pack bank; each runs on its own
+ * task and UART, so no transaction queue is involved.
+ */
+class PackPoller {
+public:
+    explicit PackPoller(hal::IHalUart& uart);
+
+    void setPeriods(const RefreshPeriods& periods) { scheduler_.setPeriods(periods); }
+    void setCostModel(const ReadPlanCostModel& model) { model_ = model; }
+    void requestFullRefresh() { scheduler_.requestFullRefresh(); }
+
+    /**
+     * @brief Read the refresh classes due at `now_ms` and decode the register
+     *        cache into `live`.
+     * @return true when `live` was refreshed; false when nothing was due or
+     *         the read failed (see stats().last_result).
+     */
+    bool poll(uint32_t now_ms,
+              uint32_t tolerance_ms,
+              const TransactionOptions& options,
+              const DelayConfig& delay,
+              TinyBMS_LiveData& live);
+
+    hal::IHalUart& uart() { return uart_; }
+    const PackPollerStats& stats() const { return stats_; }
+
+private:
+    hal::IHalUart& uart_;
+    PollScheduler scheduler_;
+    ReadPlanCostModel model_{};
+    std::vector<uint16_t> buffer_;
+    RegisterStore register_cache_;
+    DecodePlan decode_plan_;
+    PackPollerStats stats_{};
+};
+
+} // namespace tinybms
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_read_planner.h"
+
+namespace tinybms {
+
+/**
+ * @brief Refresh period of each polling class (see TinyRegisterRefreshClass).
+ *
+ * `Once` has no period: it is read at boot and whenever a refresh is requested.
+ */
+struct RefreshPeriods {
+    uint32_t fast_ms = 100;
+    uint32_t normal_ms = 1000;
+    uint32_t slow_ms = 10000;
+
+    bool operator==(const RefreshPeriods& other) const {
+        return fast_ms == other.fast_ms && normal_ms == other.normal_ms && slow_ms == other.slow_ms;
+    }
+    bool operator!=(const RefreshPeriods& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Decides which refresh classes are due each UART cycle and caches one
+ *        read plan per combination of due classes.
+ *
+ * Only the owner task calls dueMask()/planFor()/markRefreshed(); the
+ * requestRefresh() helpers may be called from any task.
+ */
+class PollScheduler {
+public:
+    static constexpr size_t kClassCount = 4;
+
+    PollScheduler();
+
+    void setPeriods(const RefreshPeriods& periods);
+    const RefreshPeriods& periods() const { return periods_; }
+
+    /**
+     * @brief Classes to read at `now_ms`.
+     * @param tolerance_ms A class is considered due up to this many ms early,
+     *        so a period equal to the poll interval is not skipped on jitter.
+     * @param requests Receives the pending requests this read consumes; hand
+     *        it back to markRefreshed().
+     */
+    uint8_t dueMask(uint32_t now_ms, uint32_t tolerance_ms, uint32_t& requests) const;
+    uint8_t dueMask(uint32_t now_ms, uint32_t tolerance_ms) const;
+
+    /**
+     * @brief Record a successful read of the classes in `mask`.
+     *
+     * Pending requests are cleared only if none arrived since dueMask()
+     * returned `requests`: a refresh requested while the read was in flight
+     * may follow a write the read missed, so it stays pending.
+     */
+    void markRefreshed(uint8_t mask, uint32_t now_ms, uint32_t requests);
+
+    void requestRefresh(TinyRegisterRefreshClass refresh_class);
+    void requestRefreshForAddress(uint16_t address);
+    void requestFullRefresh();
+
+    /**
+     * @brief Addresses currently delivered by another path (TinyBMS broadcast);
+     *        they are left out of every plan. Cached plans are dropped only
+     *        when the set actually changes.
+     */
+    void setExcludedAddresses(std::vector<uint16_t> addresses);
+    const std::vector<uint16_t>& excludedAddresses() const { return excluded_; }
+
+    /**
+     * @brief Plan covering the bindings of the classes in `mask`, rebuilt when
+     *        the mapping version, the cost model or the exclusions change.
+     */
+    const ReadPlan& planFor(uint8_t mask, const ReadPlanCostModel& model);
+
+    /**
+     * @brief Largest response (in words) among the cached plans.
+     */
+    uint16_t maxOperationWords() const { return max_operation_words_; }
+
+private:
+    RefreshPeriods periods_{};
+    std::array<uint32_t, kClassCount> last_refresh_ms_{};
+    void addRequests(uint8_t mask);
+
+    // Low byte: requested classes; upper bits: request counter.
+    std::atomic<uint32_t> pending_{kAllRefreshClasses};
+
+    std::array<ReadPlan, 1U << kClassCount> plans_{};
+    std::array<bool, 1U << kClassCount> plan_valid_{};
+    uint32_t plans_mapping_version_ = 0;
+    ReadPlanCostModel plans_cost_model_{};
+    uint16_t max_operation_words_ = 0;
+    std::vector<uint16_t> excluded_;
+};
+
+} // namespace tinybms
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+
+namespace tinybms {
+
+constexpr uint8_t refreshClassBit(TinyRegisterRefreshClass refresh_class) {
+    return static_cast<uint8_t>(1U << static_cast<uint8_t>(refresh_class));
+}
+
+constexpr uint8_t kAllRefreshClasses = 0x0F;
+
+/**
+ * @brief Link parameters used to price a polling cycle.
+ *
+ * Cost of a transaction = wire bytes (request + response) at the configured
+ * baud rate + a fixed per-transaction overhead (TinyBMS turnaround, wake-up
+ * pulse, inter-frame gap).
+ */
+struct ReadPlanCostModel {
+    uint32_t baud_rate = 115200;
+    uint8_t bits_per_byte = 10;                 // 8N1: start + 8 data + stop
+    uint32_t transaction_overhead_us = 2000;
+    uint8_t max_registers_per_read = 127;       // PL byte limit (2 * 127 = 254)
+
+    bool operator==(const ReadPlanCostModel& other) const {
+        return baud_rate == other.baud_rate &&
+               bits_per_byte == other.bits_per_byte &&
+               transaction_overhead_us == other.transaction_overhead_us &&
+               max_registers_per_read == other.max_registers_per_read;
+    }
+    bool operator!=(const ReadPlanCostModel& other) const { return !(*this == other); }
+};
+
+enum class ReadOperationKind : uint8_t {
+    Block,  // 0x07: contiguous range, gaps included
+    List    // 0x09: arbitrary addresses
+};
+
+struct ReadOperation {
+    ReadOperationKind kind = ReadOperationKind::Block;
+    uint16_t start_address = 0;         // Block only
+    uint16_t register_count = 0;        // words returned by the transaction
+    std::vector<uint16_t> addresses;    // List only
+};
+
+struct ReadPlan {
+    std::vector<uint16_t> addresses;        // sorted, unique registers required by the bindings
+    std::vector<ReadOperation> operations;
+    uint32_t wire_bytes = 0;                // request + response bytes per cycle
+    uint32_t estimated_cycle_us = 0;        // wire time + per-transaction overhead
+    uint16_t max_operation_words = 0;       // largest response, to size read buffers
+    uint32_t mapping_version = 0;           // getTinyReadMappingVersion() at build time
+    ReadPlanCostModel cost_model{};
+
+    bool empty() const { return operations.empty(); }
+};
+
+/**
+ * @brief Expand the bindings into the sorted set of register words to poll.
+ *
+ * Multi-word bindings contribute every word (`register_address` ..
+ * `register_address + register_count - 1`). Only bindings whose refresh
+ * class is in `refresh_class_mask` are kept.
+ */
+std::vector<uint16_t> collectPollAddresses(const std::vector<TinyRegisterRuntimeBinding>& bindings,
+                                           uint8_t refresh_class_mask = kAllRefreshClasses);
+
+/**
+ * @brief Choose the mix of 0x07 block reads and 0x09 list reads with the
+ *        lowest estimated cycle time.
+ *
+ * Dynamic programming over the sorted addresses: every prefix is closed either
+ * by a block read covering a run (gaps are read and discarded) or by appending
+ * the address to the shared list read. Lists larger than
+ * `max_registers_per_read` are split into several transactions.
+ */
+ReadPlan buildReadPlan(const std::vector<uint16_t>& addresses, const ReadPlanCostModel& model = {});
+
+/**
+ * @brief Plan built from the currently loaded bindings, tagged with the
+ *        mapping version so callers can detect when it must be rebuilt.
+ */
+ReadPlan buildReadPlanFromMapping(const ReadPlanCostModel& model = {},
+                                  uint8_t refresh_class_mask = kAllRefreshClasses);
+
+/**
+ * @brief Single 0x09 list read of every address (legacy polling strategy),
+ *        priced with the same model for comparisons.
+ */
+ReadPlan buildSingleListPlan(const std::vector<uint16_t>& addresses, const ReadPlanCostModel& model = {});
+
+uint32_t operationWireBytes(const ReadOperation& operation);
+
+} // namespace tinybms
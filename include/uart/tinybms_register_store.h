@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+
+namespace tinybms {
+
+/**
+ * @brief Last raw word of every polled TinyBMS register, in contiguous storage.
+ *
+ * The polled addresses are grouped into a few dense windows (32..52,
+ * 102..113, 305..319, 500..505 with the default mapping); each window owns a
+ * slice of one flat word array and a validity bit per slot. The layout is
+ * built once per mapping version, after which filling from a response buffer
+ * and looking words up never allocate: a lookup scans the handful of
+ * windows, then indexes the array.
+ *
+ * Words for addresses outside every window are dropped. Not thread-safe.
+ */
+class RegisterStore {
+public:
+    // Addresses closer than this share a window (the gap slots stay invalid).
+    static constexpr uint16_t kDefaultMaxGap = 16;
+    static constexpr size_t kNoSlot = static_cast<size_t>(-1);
+
+    RegisterStore() = default;
+
+    /**
+     * @brief Lay out windows over sorted, unique `addresses`.
+     *
+     * Words already stored for addresses still covered are kept.
+     */
+    void configure(const std::vector<uint16_t>& addresses, uint16_t max_gap = kDefaultMaxGap);
+
+    /**
+     * @brief Lay out windows over every word of `bindings` when
+     *        `mapping_version` differs from the current layout.
+     * @return true when the layout was rebuilt.
+     */
+    bool ensureLayout(const std::vector<TinyRegisterRuntimeBinding>& bindings, uint32_t mapping_version);
+
+    bool covers(uint16_t address) const { return slotOf(address) != kNoSlot; }
+
+    /**
+     * @brief Read the last word stored for `address`.
+     * @return false when the address is not covered or was never filled.
+     */
+    bool get(uint16_t address, uint16_t& value) const;
+
+    /**
+     * @return false when `address` is outside every window.
+     */
+    bool set(uint16_t address, uint16_t value);
+
+    /**
+     * @brief Store `count` consecutive words starting at `start_address`
+     *        (a 0x07 block response), skipping uncovered addresses.
+     * @return Number of words stored.
+     */
+    size_t setRange(uint16_t start_address, const uint16_t* words, size_t count);
+
+    /**
+     * @brief Forget every stored word, keeping the layout.
+     */
+    void invalidate();
+
+    /**
+     * @brief Slot of `address` in the flat word array (kNoSlot if uncovered).
+     *
+     * Slots stay valid until the next configure(); consumers that precompute
+     * them compare layoutGeneration().
+     */
+    size_t slotOf(uint16_t address) const;
+    bool slotsValid(size_t slot, size_t count) const;
+    const uint16_t* words() const { return values_.data(); }
+    uint32_t layoutGeneration() const { return layout_generation_; }
+
+    size_t windowCount() const { return windows_.size(); }
+    size_t slotCount() const { return values_.size(); }
+    size_t validCount() const;
+    uint32_t mappingVersion() const { return mapping_version_; }
+
+private:
+    struct Window {
+        uint16_t start = 0;     // first address
+        uint16_t count = 0;     // addresses covered
+        uint16_t offset = 0;    // first slot in values_
+    };
+
+    bool isValid(size_t slot) const { return (valid_[slot >> 5] >> (slot & 31U)) & 1U; }
+    void markValid(size_t slot) { valid_[slot >> 5] |= (1U << (slot & 31U)); }
+
+    std::vector<Window> windows_;
+    std::vector<uint16_t> values_;
+    std::vector<uint32_t> valid_;
+    uint32_t mapping_version_ = 0;
+    uint32_t layout_generation_ = 0;
+};
+
+} // namespace tinybms
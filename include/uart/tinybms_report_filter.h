@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+
+namespace tinybms {
+
+constexpr uint32_t kDefaultReportHeartbeatMs = 60000;
+
+/**
+ * @brief When a register value is worth publishing again.
+ *
+ * deadband  < 0: every refresh is reported.
+ * deadband == 0: any change of the raw words is reported.
+ * deadband  > 0: the scaled value must move by more than `deadband`
+ *                (engineering units, or percent of the last reported value
+ *                when `percent`) since the last report.
+ * Unchanged values are republished after `heartbeat_ms` (0 = never).
+ */
+struct ReportPolicy {
+    float deadband = 0.0f;
+    bool percent = false;
+    uint32_t heartbeat_ms = kDefaultReportHeartbeatMs;
+};
+
+/**
+ * @brief Policy of a binding: the report_* fields of its tiny_read mapping
+ *        entry, or the default (any change, 60 s heartbeat).
+ */
+ReportPolicy reportPolicyFor(const TinyRegisterRuntimeBinding& binding);
+
+struct ReportFilterStats {
+    uint32_t reported = 0;
+    uint32_t suppressed = 0;
+};
+
+/**
+ * @brief Report-by-exception state of the register events: last reported
+ *        value and time per decode step.
+ *
+ * Deadbands are measured from the last *reported* value, so a slow drift is
+ * still published once it exceeds the band. Not thread-safe.
+ */
+class ReportFilter {
+public:
+    /**
+     * @brief Size the state for `steps` entries of plan generation
+     *        `generation`; a different generation forgets everything.
+     */
+    void bind(uint32_t generation, size_t steps);
+
+    /**
+     * @brief Decide whether step `step` is reported for this refresh. The
+     *        state is unchanged until commit().
+     */
+    bool admit(size_t step,
+               const ReportPolicy& policy,
+               float scaled_value,
+               const uint16_t* words,
+               uint8_t word_count,
+               uint32_t now_ms);
+
+    /**
+     * @brief Remember an admitted value as the last reported one, once its
+     *        event was actually accepted (batch entry available).
+     */
+    void commit(size_t step, float scaled_value, const uint16_t* words, uint8_t word_count, uint32_t now_ms);
+
+    /**
+     * @brief Report every step again on its next refresh (e.g. after an MQTT
+     *        reconnection or a dropped batch).
+     */
+    void forceNext();
+
+    // Report step `step` again on its next refresh (its event was dropped).
+    void forceNext(size_t step);
+
+    const ReportFilterStats& stats() const { return stats_; }
+
+private:
+    struct State {
+        bool reported = false;
+        float scaled = 0.0f;
+        uint32_t words_hash = 0;
+        uint32_t reported_ms = 0;
+    };
+
+    std::vector<State> states_;
+    uint32_t generation_ = 0;
+    ReportFilterStats stats_{};
+};
+
+} // namespace tinybms
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "uart/tinybms_uart_client.h"
+
+namespace tinybms {
+
+/**
+ * @brief Priority classes served by the UART worker (lower value first).
+ *
+ * Configuration writes rank above reads so that a single user write is not
+ * stuck behind a full readAllRegisters() sweep.
+ */
+enum class TransactionPriority : uint8_t {
+    LivePoll = 0,
+    Alarm,
+    ConfigWrite,
+    ConfigRead
+};
+
+constexpr size_t kTransactionPriorityCount = 4;
+
+const char* transactionPriorityName(TransactionPriority priority);
+
+enum class TransactionOutcome : uint8_t {
+    Pending,
+    Running,
+    Completed,   // job ran; see TransactionResult::success
+    Cancelled,   // removed by the caller before it started
+    Expired,     // deadline passed while queued
+    Rejected     // queue for this priority was full
+};
+
+using TransactionCompletion = std::function<void(TransactionOutcome, const TransactionResult&)>;
+
+struct TransactionJob {
+    TransactionPriority priority = TransactionPriority::ConfigRead;
+    uint32_t deadline_ms = 0;                   // absolute millis(); 0 = no deadline
+    std::function<TransactionResult()> run;     // executed on the worker task
+    TransactionCompletion on_complete;          // optional, called on the finishing task
+};
+
+struct TransactionQueueStats {
+    uint32_t depth = 0;
+    uint32_t depth_max = 0;
+    uint32_t submitted = 0;
+    uint32_t completed = 0;
+    uint32_t failed = 0;        // completed with TransactionResult::success == false
+    uint32_t cancelled = 0;
+    uint32_t expired = 0;
+    uint32_t rejected = 0;
+    uint32_t wait_ms_last = 0;
+    uint32_t wait_ms_max = 0;
+    float wait_ms_avg = 0.0f;
+};
+
+class TransactionQueue;
+
+namespace detail {
+struct TransactionState {
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    TransactionOutcome outcome = TransactionOutcome::Pending;
+    TransactionResult result{};
+    TransactionJob job;
+    uint32_t enqueued_ms = 0;
+    TransactionQueue* owner = nullptr;
+};
+} // namespace detail
+
+/**
+ * @brief Caller-side handle of a queued transaction (future-like).
+ */
+class TransactionTicket {
+public:
+    TransactionTicket() = default;
+
+    bool valid() const { return state_ != nullptr; }
+
+    /**
+     * @brief Block until the transaction finished (any outcome).
+     * @return false on timeout; the transaction may still run afterwards.
+     */
+    bool wait(uint32_t timeout_ms) const;
+
+    /**
+     * @brief Remove the transaction from the queue.
+     * @return true if it will never run; false if it already started or finished.
+     */
+    bool cancel();
+
+    TransactionOutcome outcome() const;
+    TransactionResult result() const;
+
+private:
+    friend class TransactionQueue;
+    explicit TransactionTicket(std::shared_ptr<detail::TransactionState> state)
+        : state_(std::move(state)) {}
+
+    std::shared_ptr<detail::TransactionState> state_;
+};
+
+/**
+ * @brief Priority queue of UART transactions drained by a single worker.
+ *
+ * Callers submit() from any task and either wait on the returned ticket or
+ * rely on the completion callback. The worker calls runNext() in a loop; it
+ * always serves the highest non-empty priority (FIFO inside a priority) and
+ * drops jobs whose deadline already passed without touching the UART.
+ */
+class TransactionQueue {
+public:
+    explicit TransactionQueue(size_t max_depth_per_priority = 8);
+
+    TransactionTicket submit(TransactionJob job);
+
+    /**
+     * @brief Run at most one job, waiting up to `wait_ms` for one to arrive.
+     * @return true if a job was executed or dropped.
+     */
+    bool runNext(uint32_t wait_ms);
+
+    size_t depth(TransactionPriority priority) const;
+    TransactionQueueStats stats(TransactionPriority priority) const;
+    void resetStats();
+
+private:
+    friend class TransactionTicket;
+
+    using StatePtr = std::shared_ptr<detail::TransactionState>;
+
+    bool cancel(const StatePtr& state);
+    void finish(const StatePtr& state, TransactionOutcome outcome, const TransactionResult& result);
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::array<std::deque<StatePtr>, kTransactionPriorityCount> queues_;
+    std::array<TransactionQueueStats, kTransactionPriorityCount> stats_{};
+    std::array<uint32_t, kTransactionPriorityCount> wait_samples_{};
+    size_t max_depth_;
+};
+
+} // namespace tinybms
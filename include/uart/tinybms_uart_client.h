@@ -19,11 +19,6 @@ struct TransactionOptions {
     uint32_t wakeup_delay_ms = 5;
 };
 
-struct DelayConfig {
-    void (*delay_fn)(uint32_t delay_ms, void* context) = nullptr;
-    void* context = nullptr;
-};
-
 enum class AttemptStatus {
     Success,
     Timeout,
@@ -32,6 +27,38 @@ enum class AttemptStatus {
     ProtocolError
 };
 
+/**
+ * @brief Timing of one request/response attempt (wake-up pulse excluded).
+ *
+ * While timing, the first read asks for a single byte, so first_byte_us
+ * covers the BMS turnaround plus one byte time and transfer_us the rest.
+ */
+struct AttemptTiming {
+    uint8_t command = 0;
+    uint8_t attempt = 0;            // 0 = first attempt of the transaction
+    AttemptStatus status = AttemptStatus::ProtocolError;
+    bool received = false;          // at least one response byte arrived
+    uint32_t first_byte_us = 0;     // request written -> first response chunk
+    uint32_t transfer_us = 0;       // first -> last response chunk
+    uint32_t total_us = 0;          // request written -> attempt outcome
+};
+
+struct DelayConfig {
+    void (*delay_fn)(uint32_t delay_ms, void* context) = nullptr;
+    void* context = nullptr;
+    // Optional: with both set, every attempt is timed and reported.
+    uint32_t (*clock_us_fn)(void* context) = nullptr;
+    void (*attempt_fn)(const AttemptTiming& timing, void* context) = nullptr;
+    // Optional: per-command override of TransactionOptions::response_timeout_ms
+    // and retry_delay_ms (both passed in with the configured values);
+    // `response_bytes` is the length of the expected response frame.
+    void (*tune_fn)(uint8_t command,
+                    size_t response_bytes,
+                    uint32_t& response_timeout_ms,
+                    uint32_t& retry_delay_ms,
+                    void* context) = nullptr;
+};
+
 struct TransactionResult {
     bool success = false;
     AttemptStatus last_status = AttemptStatus::ProtocolError;
@@ -39,6 +66,10 @@ struct TransactionResult {
     uint32_t timeout_count = 0;
     uint32_t crc_error_count = 0;
     uint32_t write_error_count = 0;
+    uint32_t garbage_bytes = 0;        // bytes discarded while hunting for a frame
+    uint32_t resync_count = 0;         // candidate frames dropped on bad header/CRC
+    uint32_t partial_frame_count = 0;  // incomplete frames abandoned on timeout
+    bool first_attempt_timed_out = false;  // attempt 0 of the first request got no frame
 };
 
 TransactionResult readRegisterBlock(hal::IHalUart& uart,
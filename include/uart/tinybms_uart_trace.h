@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "hal/interfaces/ihal_storage.h"
+
+namespace tinybms {
+
+/**
+ * Binary UART trace, little endian:
+ *
+ *   header : "TBUT" + version (1 byte)
+ *   record : direction (1 byte, 0 = TX, 1 = RX)
+ *            varint delta_ms since the previous record (or the start)
+ *            varint length, then `length` bytes
+ *
+ * Consecutive chunks in the same direction and millisecond are merged into a
+ * single record, so a polled frame costs ~3 bytes of framing.
+ */
+constexpr uint8_t kUartTraceVersion = 1;
+
+// Captures may only be written under this prefix, never over other files.
+constexpr const char* kUartTraceDirectory = "/traces/";
+
+enum class UartTraceDirection : uint8_t {
+    Tx = 0,
+    Rx = 1
+};
+
+struct UartTraceEvent {
+    uint32_t timestamp_ms = 0;         // relative to the start of the capture
+    UartTraceDirection direction = UartTraceDirection::Tx;
+    std::vector<uint8_t> bytes;
+};
+
+struct UartTraceRecorderStats {
+    uint32_t events = 0;
+    uint32_t tx_bytes = 0;
+    uint32_t rx_bytes = 0;
+    uint32_t trace_bytes = 0;          // encoded size, header included
+    uint32_t write_errors = 0;
+    uint32_t dropped_bytes = 0;        // bytes not captured: RAM buffer full
+    bool truncated = false;            // stopped on max_trace_bytes
+};
+
+/**
+ * @brief Whether `path` is a capture file name: kUartTraceDirectory followed
+ *        by 1-23 characters among [A-Za-z0-9._-] (SPIFFS names are 31 long).
+ */
+bool isUartTracePath(const std::string& path);
+
+/**
+ * @brief Captures timestamped TX/RX byte streams into an IHalStorage file.
+ *
+ * record() only encodes into a RAM buffer of at most max_buffered_bytes;
+ * bytes that do not fit are dropped and counted, never written on the spot,
+ * since record() runs in the middle of the transaction being captured. The
+ * owner writes the buffer between transactions with flushIfDue() (once
+ * flush_threshold bytes are buffered), flush() or stop(). The capture stops
+ * by itself once the file would exceed max_trace_bytes. Thread-safe; record()
+ * is a no-op while stopped.
+ */
+class UartTraceRecorder {
+public:
+    explicit UartTraceRecorder(size_t flush_threshold = 512,
+                               size_t max_trace_bytes = 256 * 1024,
+                               size_t max_buffered_bytes = 4096);
+
+    /**
+     * @brief Truncate `path` and start recording. Stops a running capture first.
+     * @return false when `path` is not an isUartTracePath() name, when storage
+     *         is the NVS backend (it holds whole files in RAM) or on open failure.
+     */
+    bool start(hal::IHalStorage& storage, const std::string& path, uint32_t now_ms);
+    void stop();
+    bool active() const;
+
+    void record(UartTraceDirection direction, uint32_t now_ms, const uint8_t* data, size_t length);
+    void flush();
+
+    // Write the buffer once flush_threshold bytes are pending; between transactions only.
+    bool flushIfDue();
+
+    std::string path() const;
+    UartTraceRecorderStats stats() const;
+
+private:
+    void closeRecordLocked();
+    void flushLocked();
+
+    size_t flush_threshold_;
+    size_t max_trace_bytes_;
+    size_t max_buffered_bytes_;
+    mutable std::mutex mutex_;
+    std::atomic<bool> recording_{false};   // lock-free fast path for record()
+    std::unique_ptr<hal::IHalStorageFile> file_;
+    std::string path_;
+    std::vector<uint8_t> encoded_;
+    UartTraceEvent open_record_{};
+    bool record_open_ = false;
+    uint32_t last_record_ms_ = 0;
+    UartTraceRecorderStats stats_{};
+};
+
+/**
+ * @brief Encode a list of events (timestamps must be non-decreasing).
+ */
+std::vector<uint8_t> encodeUartTrace(const std::vector<UartTraceEvent>& events);
+
+/**
+ * @brief Decode a trace; returns false on a bad header or truncated record.
+ *        Timestamps are rebuilt relative to the start of the capture.
+ */
+bool decodeUartTrace(const uint8_t* data, size_t length, std::vector<UartTraceEvent>& events);
+
+bool loadUartTrace(hal::IHalStorage& storage, const std::string& path, std::vector<UartTraceEvent>& events);
+
+} // namespace tinybms
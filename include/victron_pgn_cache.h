@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace tinybms {
+
+/**
+ * @brief Exact inputs of one PGN builder, compared byte for byte (no hash,
+ *        so no false hit). A key that outgrows kCapacity never matches.
+ */
+class PgnCacheKey {
+public:
+    static constexpr size_t kCapacity = 64;
+
+    PgnCacheKey& add(uint32_t value);
+    PgnCacheKey& add(float value);      // bit pattern
+    PgnCacheKey& addText(const char* text, size_t length);   // length-prefixed
+
+    bool operator==(const PgnCacheKey& other) const;
+    bool operator!=(const PgnCacheKey& other) const { return !(*this == other); }
+
+    size_t size() const { return size_; }
+    bool overflowed() const { return overflowed_; }
+
+private:
+    void append(const void* data, size_t length);
+
+    uint8_t bytes_[kCapacity] = {};
+    uint8_t size_ = 0;
+    bool overflowed_ = false;
+};
+
+struct PgnCacheStats {
+    uint16_t pgn = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;   // payload rebuilt (first build or an input changed)
+
+    float hitRatio() const {
+        const uint32_t total = hits + misses;
+        return total == 0 ? 0.0f : static_cast<float>(hits) / static_cast<float>(total);
+    }
+};
+
+/**
+ * @brief Last 8-byte payload of each PGN, with the inputs it was built from.
+ *
+ * A builder computes its PgnCacheKey from the cheap inputs it reads (LiveData
+ * fields, config version, register text) and calls lookup(); only on a miss
+ * does it run the expensive path (config mutex, String resolution) and
+ * store() the result. Thread-safe: the CAN task builds, the web server reads
+ * snapshot().
+ */
+class PgnPayloadCache {
+public:
+    static constexpr size_t kPayloadSize = 8;
+
+    /**
+     * @brief Copy the cached payload of `pgn` into `out` when it was built
+     *        from `key`. Counts a hit or a miss.
+     */
+    bool lookup(uint16_t pgn, const PgnCacheKey& key, uint8_t* out);
+    void store(uint16_t pgn, const PgnCacheKey& key, const uint8_t* payload);
+
+    std::vector<PgnCacheStats> snapshot() const;
+    void resetStats();
+
+private:
+    struct Entry {
+        PgnCacheStats stats{};
+        bool valid = false;
+        PgnCacheKey key{};
+        uint8_t payload[kPayloadSize] = {};
+    };
+
+    Entry& entryFor(uint16_t pgn);
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;
+};
+
+} // namespace tinybms
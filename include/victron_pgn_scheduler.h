@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace tinybms {
+
+/**
+ * @brief One PGN and its transmit period.
+ */
+struct PgnSlot {
+    uint16_t pgn = 0;
+    uint32_t period_ms = 1000;
+};
+
+struct PgnScheduleStats {
+    uint16_t pgn = 0;
+    uint32_t period_ms = 0;
+    uint32_t phase_ms = 0;
+    uint32_t sent = 0;
+    uint32_t deadline_misses = 0;    // sends later than due + tolerance
+    uint32_t periods_skipped = 0;    // whole periods with no frame at all
+    uint32_t lateness_ms_last = 0;
+    uint32_t lateness_ms_max = 0;
+    uint32_t last_sent_ms = 0;
+};
+
+/**
+ * @brief Transmit schedule of the Victron PGNs: each PGN has its own period
+ *        and a phase offset, so frames are spread over time instead of being
+ *        sent back to back once per cycle.
+ *
+ * Phases are staggered on a grid of (shortest period / PGN count): with ten
+ * PGNs and a 1 s shortest period, one frame leaves every 100 ms. A PGN sent
+ * late stays on its phase grid; periods it missed entirely are skipped, not
+ * sent in a burst. Thread-safe: the CAN task drives it, the web server reads
+ * snapshot().
+ */
+class PgnScheduler {
+public:
+    /**
+     * @brief Replace the schedule; the first deadlines are `now_ms + phase`.
+     * @param miss_tolerance_ms A send up to this many ms after its due time
+     *        is on time (task loop and tick jitter).
+     */
+    void configure(const std::vector<PgnSlot>& slots, uint32_t now_ms, uint32_t miss_tolerance_ms);
+
+    /**
+     * @brief Restart every PGN on its phase from `start_ms`, without counting
+     *        misses (e.g. while no live data is available). Stats are kept.
+     */
+    void restart(uint32_t start_ms);
+
+    /**
+     * @brief Earliest-deadline PGN due at `now_ms`.
+     * @return false when nothing is due.
+     */
+    bool nextDue(uint32_t now_ms, size_t& index) const;
+
+    /**
+     * @brief Record the transmission of PGN `index` and move it to its next
+     *        deadline on the phase grid.
+     */
+    void markSent(size_t index, uint32_t now_ms);
+
+    size_t size() const;
+    uint16_t pgnAt(size_t index) const;
+    uint32_t missToleranceMs() const;
+
+    std::vector<PgnScheduleStats> snapshot() const;
+    void resetStats();
+
+private:
+    struct Entry {
+        PgnScheduleStats stats{};
+        uint32_t next_due_ms = 0;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;
+    uint32_t miss_tolerance_ms_ = 0;
+};
+
+} // namespace tinybms
@@ -28,8 +28,178 @@ $CXX "${CXXFLAGS[@]}" \
 $CXX "${CXXFLAGS[@]}" \
     "$ROOT_DIR/tests/native/test_uart_stub.cpp" \
     "$ROOT_DIR/src/uart/tinybms_uart_client.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_crc.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_frame_parser.cpp" \
+    "$ROOT_DIR/src/optimization/ring_buffer.cpp" \
     -o "$BUILD_DIR/test_uart_stub"
 
+# CRC16 engine golden vectors
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_crc.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_crc.cpp" \
+    -o "$BUILD_DIR/test_tinybms_crc"
+
+# Streaming frame parser (resync, partial frames, ring buffer input)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_frame_parser.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_frame_parser.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_crc.cpp" \
+    "$ROOT_DIR/src/optimization/ring_buffer.cpp" \
+    -o "$BUILD_DIR/test_tinybms_frame_parser"
+
+# Register read planner (block vs list reads derived from the mapping)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
+    -o "$BUILD_DIR/test_tinybms_read_planner"
+
+# CRC16 micro-benchmark (executed only with RUN_NATIVE_BENCHMARKS=1)
+$CXX "${CXXFLAGS[@]}" -O2 \
+    "$ROOT_DIR/tests/native/bench_tinybms_crc.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_crc.cpp" \
+    -o "$BUILD_DIR/bench_tinybms_crc"
+
+# Tiered refresh scheduler (due classes, on-demand refresh, plan cache)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_poll_scheduler.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_poll_scheduler.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
+    -o "$BUILD_DIR/test_tinybms_poll_scheduler"
+
+# Victron PGN transmit schedule (per-PGN periods, staggered phases, deadline misses)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_victron_pgn_scheduler.cpp" \
+    "$ROOT_DIR/src/victron_pgn_scheduler.cpp" \
+    -o "$BUILD_DIR/test_victron_pgn_scheduler"
+
+# Victron PGN payload cache (exact input keys, per-PGN hit ratio)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_victron_pgn_cache.cpp" \
+    "$ROOT_DIR/src/victron_pgn_cache.cpp" \
+    -o "$BUILD_DIR/test_victron_pgn_cache"
+
+# Prioritised UART transaction queue (ordering, deadlines, cancellation, worker thread)
+$CXX "${CXXFLAGS[@]}" -pthread \
+    "$ROOT_DIR/tests/native/test_tinybms_transaction_queue.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_transaction_queue.cpp" \
+    -o "$BUILD_DIR/test_tinybms_transaction_queue"
+
+# Passive broadcast ingestion (unsolicited frames, staleness, poll fallback)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_broadcast.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_broadcast.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_register_store.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_frame_parser.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_crc.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_poll_scheduler.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
+    "$ROOT_DIR/src/optimization/ring_buffer.cpp" \
+    -o "$BUILD_DIR/test_tinybms_broadcast"
+
+# Wake-up pulse link tracker (learned sleep threshold, skip counters)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_link_tracker.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_link_tracker.cpp" \
+    -o "$BUILD_DIR/test_tinybms_link_tracker"
+
+# UART trace recorder and deterministic replay
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_uart_trace.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_uart_trace.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_uart_client.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_crc.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_frame_parser.cpp" \
+    "$ROOT_DIR/src/optimization/ring_buffer.cpp" \
+    "$ROOT_DIR/src/hal/mock/replay_uart.cpp" \
+    "$ROOT_DIR/src/hal/mock/mock_storage.cpp" \
+    -o "$BUILD_DIR/test_tinybms_uart_trace"
+
+# Read planner benchmark (executed only with RUN_NATIVE_BENCHMARKS=1)
+$CXX "${CXXFLAGS[@]}" -O2 \
+    "$ROOT_DIR/tests/native/bench_tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
+    -o "$BUILD_DIR/bench_tinybms_read_planner"
+
+# Attempt latency histograms (first byte vs transfer, per command/outcome)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_latency_histogram.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_latency_histogram.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_uart_client.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_crc.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_frame_parser.cpp" \
+    "$ROOT_DIR/src/optimization/ring_buffer.cpp" \
+    "$ROOT_DIR/src/hal/mock/replay_uart.cpp" \
+    -o "$BUILD_DIR/test_tinybms_latency_histogram"
+
+# UART trace replay benchmark (executed only with RUN_NATIVE_BENCHMARKS=1;
+# TINYBMS_UART_TRACE=<trace.bin> replays a captured trace instead of a synthetic one)
+$CXX "${CXXFLAGS[@]}" -O2 \
+    "$ROOT_DIR/tests/native/bench_tinybms_replay.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_uart_trace.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_uart_client.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_crc.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_frame_parser.cpp" \
+    "$ROOT_DIR/src/optimization/ring_buffer.cpp" \
+    "$ROOT_DIR/src/hal/mock/replay_uart.cpp" \
+    -o "$BUILD_DIR/bench_tinybms_replay"
+
+# Optimization helpers (adaptive poller with RTT estimates, ring buffer, WebSocket throttle)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_optimization.cpp" \
+    "$ROOT_DIR/src/optimization/adaptive_polling.cpp" \
+    "$ROOT_DIR/src/optimization/ring_buffer.cpp" \
+    "$ROOT_DIR/src/optimization/websocket_throttle.cpp" \
+    -o "$BUILD_DIR/test_optimization"
+
+# Multi-pack bank: per-pack poll loops over simulated links and the combined view
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_pack_aggregator.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_pack_aggregator.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_pack_poller.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_register_store.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_decode_plan.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_report_filter.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_poll_scheduler.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_uart_client.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_crc.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_frame_parser.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_decoder.cpp" \
+    "$ROOT_DIR/src/optimization/ring_buffer.cpp" \
+    "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
+    -o "$BUILD_DIR/test_tinybms_pack_aggregator"
+
+# Event bus: publish/subscribe, async subscriptions, register cycle batches, per-type registry, lock-free latest value and borrow, multi-threaded contention run
+$CXX "${CXXFLAGS[@]}" -pthread \
+    "$ROOT_DIR/tests/unit/test_event_bus_v2.cpp" \
+    "$ROOT_DIR/src/event/event_bus_v2.cpp" \
+    "$ROOT_DIR/src/event/event_registry.cpp" \
+    "$ROOT_DIR/src/event/event_subscriber.cpp" \
+    "$ROOT_DIR/src/event/register_value_adapter.cpp" \
+    -o "$BUILD_DIR/test_event_bus_v2"
+
+# Event journal: batched appends, segment ring, time-range queries, crash recovery on the mock storage
+$CXX "${CXXFLAGS[@]}" -pthread \
+    "$ROOT_DIR/tests/native/test_event_journal.cpp" \
+    "$ROOT_DIR/src/event/event_journal.cpp" \
+    "$ROOT_DIR/src/event/event_bus_v2.cpp" \
+    "$ROOT_DIR/src/event/event_registry.cpp" \
+    "$ROOT_DIR/src/event/event_subscriber.cpp" \
+    "$ROOT_DIR/src/hal/mock/mock_storage.cpp" \
+    -o "$BUILD_DIR/test_event_journal"
+
+# Event bus publish benchmark: copy-on-write subscriber lists vs vector copy (executed only with RUN_NATIVE_BENCHMARKS=1)
+$CXX "${CXXFLAGS[@]}" -O2 -pthread \
+    "$ROOT_DIR/tests/native/bench_event_bus_publish.cpp" \
+    "$ROOT_DIR/src/event/event_bus_v2.cpp" \
+    "$ROOT_DIR/src/event/event_registry.cpp" \
+    "$ROOT_DIR/src/event/event_subscriber.cpp" \
+    -o "$BUILD_DIR/bench_event_bus_publish"
+
 # Tiny read mapping loader test
 $CXX "${CXXFLAGS[@]}" \
     "$ROOT_DIR/tests/native/test_tiny_read_mapping.cpp" \
@@ -40,11 +210,80 @@ $CXX "${CXXFLAGS[@]}" \
 $CXX "${CXXFLAGS[@]}" \
     "$ROOT_DIR/tests/native/test_tinybms_decoder.cpp" \
     "$ROOT_DIR/src/uart/tinybms_decoder.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_register_store.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
     "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
     -o "$BUILD_DIR/test_tinybms_decoder"
 
+# Flat register store (windows, validity bitmap, decoder equivalence with a map)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_register_store.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_register_store.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_decoder.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
+    -o "$BUILD_DIR/test_tinybms_register_store"
+
+# Precompiled decode plan (equivalence with the per-binding decoder, event filter, recompile)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_decode_plan.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_decode_plan.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_report_filter.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_register_store.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_decoder.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
+    -o "$BUILD_DIR/test_tinybms_decode_plan"
+
+# Report-by-exception of register events (deadbands, heartbeat, decode plan integration)
+$CXX "${CXXFLAGS[@]}" \
+    "$ROOT_DIR/tests/native/test_tinybms_report_filter.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_report_filter.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_decode_plan.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_register_store.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_decoder.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
+    -o "$BUILD_DIR/test_tinybms_report_filter"
+
+# Register store / decode plan benchmark: allocations and time per poll cycle (executed only with RUN_NATIVE_BENCHMARKS=1)
+$CXX "${CXXFLAGS[@]}" -O2 \
+    "$ROOT_DIR/tests/native/bench_tinybms_register_store.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_register_store.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_decode_plan.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_report_filter.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_decoder.cpp" \
+    "$ROOT_DIR/src/uart/tinybms_read_planner.cpp" \
+    "$ROOT_DIR/src/mappings/tiny_read_mapping.cpp" \
+    -o "$BUILD_DIR/bench_tinybms_register_store"
+
 "$BUILD_DIR/test_cvl_logic"
 "$BUILD_DIR/test_uart_stub"
+"$BUILD_DIR/test_tinybms_crc"
+"$BUILD_DIR/test_tinybms_frame_parser"
+"$BUILD_DIR/test_tinybms_read_planner"
+"$BUILD_DIR/test_tinybms_poll_scheduler"
+"$BUILD_DIR/test_victron_pgn_scheduler"
+"$BUILD_DIR/test_victron_pgn_cache"
+"$BUILD_DIR/test_tinybms_transaction_queue"
+"$BUILD_DIR/test_tinybms_broadcast"
+"$BUILD_DIR/test_tinybms_link_tracker"
+"$BUILD_DIR/test_tinybms_uart_trace"
+"$BUILD_DIR/test_tinybms_latency_histogram"
+"$BUILD_DIR/test_optimization"
+"$BUILD_DIR/test_tinybms_pack_aggregator"
+"$BUILD_DIR/test_event_bus_v2"
+"$BUILD_DIR/test_event_journal"
 "$BUILD_DIR/test_tiny_read_mapping"
 "$BUILD_DIR/test_tinybms_decoder"
+"$BUILD_DIR/test_tinybms_register_store"
+"$BUILD_DIR/test_tinybms_decode_plan"
+"$BUILD_DIR/test_tinybms_report_filter"
 
+if [[ "${RUN_NATIVE_BENCHMARKS:-0}" == "1" ]]; then
+    "$BUILD_DIR/bench_tinybms_crc"
+    "$BUILD_DIR/bench_tinybms_read_planner"
+    "$BUILD_DIR/bench_tinybms_replay" ${TINYBMS_UART_TRACE:+"$TINYBMS_UART_TRACE"}
+    "$BUILD_DIR/bench_tinybms_register_store"
+    "$BUILD_DIR/bench_event_bus_publish"
+fi
@@ -97,13 +97,16 @@ void copyAsciiPadded(uint8_t* dest, size_t length, const String& source, size_t
     }
 }
 
-String resolveManufacturerName(const TinyBMS_LiveData& live) {
+// The resolvers clear `config_read` when configMutex timed out and a default was used.
+String resolveManufacturerName(const TinyBMS_LiveData& live, bool& config_read) {
     String manufacturer = getRegisterString(live, 500);
     if (manufacturer.length() == 0) {
         manufacturer = "TinyBMS";
         if (xSemaphoreTake(configMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
             manufacturer = config.victron.manufacturer_name;
             xSemaphoreGive(configMutex);
+        } else {
+            config_read = false;
         }
     }
     if (manufacturer.length() == 0) {
@@ -112,11 +115,13 @@ String resolveManufacturerName(const TinyBMS_LiveData& live) {
     return manufacturer;
 }
 
-String resolveBatteryName(const TinyBMS_LiveData& live) {
+String resolveBatteryName(const TinyBMS_LiveData& live, bool& config_read) {
     String name;
     if (xSemaphoreTake(configMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
         name = config.victron.battery_name;
         xSemaphoreGive(configMutex);
+    } else {
+        config_read = false;
     }
     if (name.length() == 0) {
         name = getRegisterString(live, 502);
@@ -127,14 +132,32 @@ String resolveBatteryName(const TinyBMS_LiveData& live) {
     return name;
 }
 
-String resolveBatteryFamily(const TinyBMS_LiveData& live) {
+String resolveBatteryFamily(const TinyBMS_LiveData& live, bool& config_read) {
     String family = getRegisterString(live, 502);
     if (family.length() == 0) {
-        family = resolveBatteryName(live);
+        family = resolveBatteryName(live, config_read);
     }
     return family;
 }
 
+// Register text exactly as getRegisterString() sees it.
+void addRegisterText(tinybms::PgnCacheKey& key, const TinyBMS_LiveData& live, uint16_t address) {
+    const TinyRegisterSnapshot* snap = live.findSnapshot(address);
+    if (snap && snap->has_text) {
+        key.addText(snap->text_value.c_str(), snap->text_value.length());
+    } else {
+        key.addText("", 0);
+    }
+}
+
+// Inputs of the name PGNs: register text and the Victron names in the configuration.
+tinybms::PgnCacheKey nameKey(const TinyBMS_LiveData& live, uint16_t address) {
+    tinybms::PgnCacheKey key;
+    key.add(config.version());
+    addRegisterText(key, live, address);
+    return key;
+}
+
 uint32_t encodeEnergyWh(double energy_wh) {
     if (!(energy_wh > 0.0)) {
         return 0;
@@ -614,7 +637,15 @@ void TinyBMS_Victron_Bridge::buildPGN_0x35E(const TinyBMS_LiveData& live, uint8_
     if (applyVictronMapping(*this, live, VICTRON_PGN_MANUFACTURER, d)) {
         return;
     }
-    copyAsciiPadded(d, 8, resolveManufacturerName(live));
+    const tinybms::PgnCacheKey key = nameKey(live, 500);
+    if (can_pgn_cache_.lookup(VICTRON_PGN_MANUFACTURER, key, d)) {
+        return;
+    }
+    bool config_read = true;
+    copyAsciiPadded(d, 8, resolveManufacturerName(live, config_read));
+    if (config_read) {
+        can_pgn_cache_.store(VICTRON_PGN_MANUFACTURER, key, d);
+    }
 }
 
 void TinyBMS_Victron_Bridge::buildPGN_0x35F(const TinyBMS_LiveData& live, uint8_t* d){
@@ -622,7 +653,15 @@ void TinyBMS_Victron_Bridge::buildPGN_0x35F(const TinyBMS_LiveData& live, uint8_
     if (applyVictronMapping(*this, live, VICTRON_PGN_BATTERY_INFO, d)) {
         return;
     }
-    copyAsciiPadded(d, 8, resolveBatteryName(live));
+    const tinybms::PgnCacheKey key = nameKey(live, 502);
+    if (can_pgn_cache_.lookup(VICTRON_PGN_BATTERY_INFO, key, d)) {
+        return;
+    }
+    bool config_read = true;
+    copyAsciiPadded(d, 8, resolveBatteryName(live, config_read));
+    if (config_read) {
+        can_pgn_cache_.store(VICTRON_PGN_BATTERY_INFO, key, d);
+    }
 }
 
 void TinyBMS_Victron_Bridge::buildPGN_0x371(const TinyBMS_LiveData& live, uint8_t* d){
@@ -630,7 +669,15 @@ void TinyBMS_Victron_Bridge::buildPGN_0x371(const TinyBMS_LiveData& live, uint8_
     if (applyVictronMapping(*this, live, VICTRON_PGN_BMS_NAME_PART2, d)) {
         return;
     }
-    copyAsciiPadded(d, 8, resolveBatteryName(live), 8);
+    const tinybms::PgnCacheKey key = nameKey(live, 502);
+    if (can_pgn_cache_.lookup(VICTRON_PGN_BMS_NAME_PART2, key, d)) {
+        return;
+    }
+    bool config_read = true;
+    copyAsciiPadded(d, 8, resolveBatteryName(live, config_read), 8);
+    if (config_read) {
+        can_pgn_cache_.store(VICTRON_PGN_BMS_NAME_PART2, key, d);
+    }
 }
 
 void TinyBMS_Victron_Bridge::buildPGN_0x378(const TinyBMS_LiveData& live, uint8_t* d){
@@ -652,8 +699,16 @@ void TinyBMS_Victron_Bridge::buildPGN_0x379(const TinyBMS_LiveData& live, uint8_
         return;
     }
 
-    double capacity_ah = 0.0;
     const TinyRegisterSnapshot* cap_snapshot = live.findSnapshot(306);
+    tinybms::PgnCacheKey key;
+    key.add(static_cast<uint32_t>(cap_snapshot ? 1 : 0));
+    key.add(static_cast<uint32_t>(cap_snapshot ? cap_snapshot->raw_value : 0));
+    key.add(config_.battery_capacity_ah);
+    if (can_pgn_cache_.lookup(VICTRON_PGN_INSTALLED_CAP, key, d)) {
+        return;
+    }
+
+    double capacity_ah = 0.0;
     if (cap_snapshot) {
         capacity_ah = static_cast<double>(cap_snapshot->raw_value) * 0.01;
     }
@@ -669,6 +724,7 @@ void TinyBMS_Victron_Bridge::buildPGN_0x379(const TinyBMS_LiveData& live, uint8_
 
     uint16_t raw_capacity = static_cast<uint16_t>(capacity_ah + 0.5);
     put_u16_le(&d[0], raw_capacity);
+    can_pgn_cache_.store(VICTRON_PGN_INSTALLED_CAP, key, d);
 }
 
 void TinyBMS_Victron_Bridge::buildPGN_0x382(const TinyBMS_LiveData& live, uint8_t* d){
@@ -676,7 +732,71 @@ void TinyBMS_Victron_Bridge::buildPGN_0x382(const TinyBMS_LiveData& live, uint8_
     if (applyVictronMapping(*this, live, VICTRON_PGN_BATTERY_FAMILY, d)) {
         return;
     }
-    copyAsciiPadded(d, 8, resolveBatteryFamily(live));
+    const tinybms::PgnCacheKey key = nameKey(live, 502);
+    if (can_pgn_cache_.lookup(VICTRON_PGN_BATTERY_FAMILY, key, d)) {
+        return;
+    }
+    bool config_read = true;
+    copyAsciiPadded(d, 8, resolveBatteryFamily(live, config_read));
+    if (config_read) {
+        can_pgn_cache_.store(VICTRON_PGN_BATTERY_FAMILY, key, d);
+    }
+}
+
+namespace {
+
+enum class PgnRate : uint8_t { Dynamic, Energy, Identity };
+
+struct ScheduledPgn {
+    uint16_t pgn;
+    PgnRate rate;
+    void (TinyBMS_Victron_Bridge::*build)(const TinyBMS_LiveData&, uint8_t*);
+};
+
+// Order sets the phase offsets: dynamic frames first, identity frames last.
+constexpr ScheduledPgn kScheduledPgns[] = {
+    {VICTRON_PGN_VOLTAGE_CURRENT, PgnRate::Dynamic,  &TinyBMS_Victron_Bridge::buildPGN_0x356},
+    {VICTRON_PGN_SOC_SOH,         PgnRate::Dynamic,  &TinyBMS_Victron_Bridge::buildPGN_0x355},
+    {VICTRON_PGN_CVL_CCL_DCL,     PgnRate::Dynamic,  &TinyBMS_Victron_Bridge::buildPGN_0x351},
+    {VICTRON_PGN_ALARMS,          PgnRate::Dynamic,  &TinyBMS_Victron_Bridge::buildPGN_0x35A},
+    {VICTRON_PGN_ENERGY_COUNTERS, PgnRate::Energy,   &TinyBMS_Victron_Bridge::buildPGN_0x378},
+    {VICTRON_PGN_MANUFACTURER,    PgnRate::Identity, &TinyBMS_Victron_Bridge::buildPGN_0x35E},
+    {VICTRON_PGN_BATTERY_INFO,    PgnRate::Identity, &TinyBMS_Victron_Bridge::buildPGN_0x35F},
+    {VICTRON_PGN_BMS_NAME_PART2,  PgnRate::Identity, &TinyBMS_Victron_Bridge::buildPGN_0x371},
+    {VICTRON_PGN_INSTALLED_CAP,   PgnRate::Identity, &TinyBMS_Victron_Bridge::buildPGN_0x379},
+    {VICTRON_PGN_BATTERY_FAMILY,  PgnRate::Identity, &TinyBMS_Victron_Bridge::buildPGN_0x382},
+};
+
+// The CAN task runs every 10 ms; a frame sent later than this is a deadline miss.
+constexpr uint32_t kPgnMissToleranceMs = 50;
+
+} // namespace
+
+void TinyBMS_Victron_Bridge::configurePgnSchedule(uint32_t now_ms){
+    std::vector<tinybms::PgnSlot> slots;
+    slots.reserve(sizeof(kScheduledPgns) / sizeof(kScheduledPgns[0]));
+    for (const ScheduledPgn& entry : kScheduledPgns) {
+        tinybms::PgnSlot slot{};
+        slot.pgn = entry.pgn;
+        switch (entry.rate) {
+            case PgnRate::Dynamic:  slot.period_ms = pgn_update_interval_ms_; break;
+            case PgnRate::Energy:   slot.period_ms = pgn_energy_interval_ms_; break;
+            case PgnRate::Identity: slot.period_ms = pgn_identity_interval_ms_; break;
+        }
+        slots.push_back(slot);
+    }
+    can_pgn_scheduler_.configure(slots, now_ms, kPgnMissToleranceMs);
+}
+
+void TinyBMS_Victron_Bridge::sendScheduledPgn(size_t index, const TinyBMS_LiveData& live){
+    if (index >= sizeof(kScheduledPgns) / sizeof(kScheduledPgns[0])) {
+        return;
+    }
+    const ScheduledPgn& entry = kScheduledPgns[index];
+    uint8_t p[8];
+    memset(p, 0, 8);
+    (this->*entry.build)(live, p);
+    sendVictronPGN(entry.pgn, p, 8);
 }
 
 void TinyBMS_Victron_Bridge::canTask(void *pvParameters){
@@ -690,26 +810,9 @@ void TinyBMS_Victron_Bridge::canTask(void *pvParameters){
         bridge->keepAliveProcessRX(now);
 
         if (now - bridge->last_pgn_update_ms_ >= bridge->pgn_update_interval_ms_) {
-            LiveDataUpdate latest{};
-            TinyBMS_LiveData live{};
-            const bool have_live = event_sink.latest(latest);
-            if (have_live) {
-                live = latest.data;
-                bridge->updateEnergyCounters(now, live);
-
-                uint8_t p[8];
-
-                memset(p, 0, 8); bridge->buildPGN_0x356(live, p); bridge->sendVictronPGN(VICTRON_PGN_VOLTAGE_CURRENT, p, 8);
-                memset(p, 0, 8); bridge->buildPGN_0x355(live, p); bridge->sendVictronPGN(VICTRON_PGN_SOC_SOH, p, 8);
-                memset(p, 0, 8); bridge->buildPGN_0x351(live, p); bridge->sendVictronPGN(VICTRON_PGN_CVL_CCL_DCL, p, 8);
-                memset(p, 0, 8); bridge->buildPGN_0x35A(live, p); bridge->sendVictronPGN(VICTRON_PGN_ALARMS, p, 8);
-                memset(p, 0, 8); bridge->buildPGN_0x35E(live, p); bridge->sendVictronPGN(VICTRON_PGN_MANUFACTURER, p, 8);
-                memset(p, 0, 8); bridge->buildPGN_0x35F(live, p); bridge->sendVictronPGN(VICTRON_PGN_BATTERY_INFO, p, 8);
-                memset(p, 0, 8); bridge->buildPGN_0x371(live, p); bridge->sendVictronPGN(VICTRON_PGN_BMS_NAME_PART2, p, 8);
-                memset(p, 0, 8); bridge->buildPGN_0x378(live, p); bridge->sendVictronPGN(VICTRON_PGN_ENERGY_COUNTERS, p, 8);
-                memset(p, 0, 8); bridge->buildPGN_0x379(live, p); bridge->sendVictronPGN(VICTRON_PGN_INSTALLED_CAP, p, 8);
-                memset(p, 0, 8); bridge->buildPGN_0x382(live, p); bridge->sendVictronPGN(VICTRON_PGN_BATTERY_FAMILY, p, 8);
-            }
+            event_sink.borrowLatest([bridge, now](const LiveDataUpdate& latest) {
+                bridge->updateEnergyCounters(now, latest.data);
+            });
 
             bridge->keepAliveSend();
 
@@ -721,6 +824,22 @@ void TinyBMS_Victron_Bridge::canTask(void *pvParameters){
             }
         }
 
+        // Each PGN on its own period and phase (see configurePgnSchedule()).
+        size_t due_index = 0;
+        if (bridge->can_pgn_scheduler_.nextDue(now, due_index)) {
+            // Borrowed, not copied: the frames are built straight from the cached event.
+            const bool have_live = event_sink.borrowLatest([bridge, now, &due_index](const LiveDataUpdate& latest) {
+                do {
+                    bridge->sendScheduledPgn(due_index, latest.data);
+                    bridge->can_pgn_scheduler_.markSent(due_index, now);
+                } while (bridge->can_pgn_scheduler_.nextDue(now, due_index));
+            });
+            if (!have_live) {
+                // Nothing to report yet: start over once live data can arrive.
+                bridge->can_pgn_scheduler_.restart(now + bridge->pgn_update_interval_ms_);
+            }
+        }
+
         // Phase 1: Protect stats writes with statsMutex
         hal::CanStats driverStats = hal::HalManager::instance().can().getStats();
         if (xSemaphoreTake(statsMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
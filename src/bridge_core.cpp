@@ -14,6 +14,7 @@
 #include "watchdog_manager.h"
 #include "rtos_tasks.h"
 #include "rtos_config.h"
+#include "hal/hal_factory.h"
 #include "hal/hal_manager.h"
 #include "hal/interfaces/ihal_can.h"
 #include "hal/interfaces/ihal_uart.h"
@@ -38,7 +39,7 @@ TinyBMS_Victron_Bridge::TinyBMS_Victron_Bridge()
     stats = BridgeStats{};
     last_uart_poll_ms_ = last_pgn_update_ms_ = last_cvl_update_ms_ = 0;
     last_keepalive_tx_ms_ = last_keepalive_rx_ms_ = 0;
-    uart_poll_interval_ms_ = UART_POLL_INTERVAL_MS;
+    uart_poll_interval_ms_.store(UART_POLL_INTERVAL_MS);
     pgn_update_interval_ms_ = PGN_UPDATE_INTERVAL_MS;
     cvl_update_interval_ms_ = CVL_UPDATE_INTERVAL_MS;
     keepalive_interval_ms_ = 1000;
@@ -109,6 +110,62 @@ bool TinyBMS_Victron_Bridge::begin() {
         return false;
     }
 
+    // Additional packs of a multi-pack bank, each on its own UART. The bank
+    // cannot be larger than the UARTs the HAL backend can drive.
+    extra_packs_.clear();
+    const std::vector<int> uart_ports = hal::factory().uartPorts();
+    int primary_port = hal_uart_config.port;
+    if (primary_port < 0 && !uart_ports.empty()) {
+        primary_port = uart_ports.front();
+    }
+    std::vector<int> used_ports{primary_port};
+    const size_t port_capacity = uart_ports.empty() ? 0 : uart_ports.size() - 1;
+    size_t extra_count = std::min<size_t>(tinybms_cfg.extra_pack_count,
+                                          tinybms::PackAggregator::kMaxPacks - 1);
+    if (extra_count > port_capacity) {
+        BRIDGE_LOG(LOG_ERROR, String("Multi-pack bank: ") + extra_count + " extra pack(s) configured, only " +
+                                  port_capacity + " spare UART(s) available");
+        extra_count = port_capacity;
+    }
+    packs_.configure(1 + extra_count, std::max<uint32_t>(500, tinybms_cfg.pack_stale_ms));
+    packs_.setFallbackCapacityAh(0, tinybms_cfg.pack_capacity_ah);
+    for (size_t i = 0; i < extra_count; ++i) {
+        const auto& pack_cfg = tinybms_cfg.extra_packs[i];
+        packs_.setFallbackCapacityAh(i + 1, pack_cfg.capacity_ah);
+
+        // A port shared with pack 0 (or another pack) would reinitialise its link.
+        const bool supported = std::find(uart_ports.begin(), uart_ports.end(), pack_cfg.uart_port) != uart_ports.end();
+        const bool in_use = std::find(used_ports.begin(), used_ports.end(), pack_cfg.uart_port) != used_ports.end();
+        if (!supported || in_use) {
+            BRIDGE_LOG(LOG_ERROR, String("Pack ") + (i + 1) + " skipped: UART port " + pack_cfg.uart_port +
+                                      (in_use ? " already in use" : " not supported by the HAL"));
+            continue;
+        }
+        used_ports.push_back(pack_cfg.uart_port);
+
+        hal::UartConfig pack_uart_config = hal_uart_config;
+        pack_uart_config.port = pack_cfg.uart_port;
+        pack_uart_config.rx_pin = pack_cfg.rx_pin;
+        pack_uart_config.tx_pin = pack_cfg.tx_pin;
+
+        auto link = std::make_unique<TinyPackLink>();
+        link->bridge = this;
+        link->index = i + 1;
+        link->uart = hal::factory().createUart();
+        if (!link->uart || link->uart->initialize(pack_uart_config) != hal::Status::Ok) {
+            // Left out of the bank: the pack stays stale in /api/packs.
+            BRIDGE_LOG(LOG_ERROR, String("Pack ") + (i + 1) + " UART init failed (port " + pack_cfg.uart_port + ")");
+            continue;
+        }
+        link->uart->setTimeout(pack_uart_config.timeout_ms);
+        link->poller = std::make_unique<tinybms::PackPoller>(*link->uart);
+        extra_packs_.push_back(std::move(link));
+    }
+    if (extra_count > 0) {
+        BRIDGE_LOG(LOG_INFO, String("Multi-pack bank: ") + (1 + extra_count) + " packs, " +
+                                 extra_packs_.size() + " extra UART(s) ready");
+    }
+
     BRIDGE_LOG(LOG_INFO, "Initializing CAN via HAL...");
     hal::IHalCan& can_hal = hal_manager.can();
     if (can_hal.initialize(hal_can_config) != hal::Status::Ok) {
@@ -127,27 +184,44 @@ bool TinyBMS_Victron_Bridge::begin() {
     poll_cfg.latency_slack_ms = tinybms_cfg.poll_latency_slack_ms;
     poll_cfg.failure_threshold = std::max<uint8_t>(static_cast<uint8_t>(1), tinybms_cfg.poll_failure_threshold);
     poll_cfg.success_threshold = std::max<uint8_t>(static_cast<uint8_t>(1), tinybms_cfg.poll_success_threshold);
-    uart_poller_.configure(poll_cfg);
-    uart_poll_interval_ms_  = uart_poller_.currentInterval();
+    poll_cfg.adaptive_timeouts = tinybms_cfg.uart_adaptive_timeouts;
+    poll_cfg.response_timeout_min_ms = std::max<uint32_t>(5, tinybms_cfg.uart_timeout_min_ms);
+    poll_cfg.response_timeout_max_ms = std::max<uint32_t>(20, static_cast<uint32_t>(uart_cfg.timeout_ms));
+    poll_cfg.retry_delay_min_ms = tinybms_cfg.uart_retry_delay_min_ms;
+    poll_cfg.retry_delay_max_ms = tinybms_cfg.uart_retry_delay_ms;
+    if (uart_cfg.baudrate > 0) {
+        poll_cfg.byte_time_us = std::max<uint32_t>(1, 10000000U / static_cast<uint32_t>(uart_cfg.baudrate));
+    }
+    {
+        std::lock_guard<std::mutex> lock(uart_poller_mutex_);
+        uart_poller_.configure(poll_cfg);
+        uart_poll_interval_ms_.store(uart_poller_.currentInterval());
+    }
     pgn_update_interval_ms_ = std::max<uint32_t>(100, victron_cfg.pgn_update_interval_ms);
+    pgn_energy_interval_ms_ = std::max<uint32_t>(100, victron_cfg.pgn_energy_interval_ms);
+    pgn_identity_interval_ms_ = std::max<uint32_t>(100, victron_cfg.pgn_identity_interval_ms);
     cvl_update_interval_ms_ = std::max<uint32_t>(500, victron_cfg.cvl_update_interval_ms);
     keepalive_interval_ms_  = std::max<uint32_t>(200, victron_cfg.keepalive_interval_ms);
     keepalive_timeout_ms_   = std::max<uint32_t>(1000, victron_cfg.keepalive_timeout_ms);
 
+    configurePgnSchedule(millis());
+
     last_keepalive_rx_ms_ = millis();
     stats.victron_keepalive_ok = false;
     victron_keepalive_ok_ = false;
 
-    BRIDGE_LOG(LOG_INFO, String("Intervals: UART=") + uart_poll_interval_ms_ +
+    BRIDGE_LOG(LOG_INFO, String("Intervals: UART=") + uart_poll_interval_ms_.load() +
                              "ms (min=" + poll_cfg.min_interval_ms +
                              "ms max=" + poll_cfg.max_interval_ms +
                              "ms target=" + poll_cfg.latency_target_ms +
                              "ms), PGN=" + pgn_update_interval_ms_ +
+                             "/" + pgn_energy_interval_ms_ +
+                             "/" + pgn_identity_interval_ms_ +
                              "ms, CVL=" + cvl_update_interval_ms_ +
                              "ms, KA tx=" + keepalive_interval_ms_ +
                              "ms, KA timeout=" + keepalive_timeout_ms_ + "ms");
 
-    stats.uart_poll_interval_current_ms = uart_poll_interval_ms_;
+    stats.uart_poll_interval_current_ms = uart_poll_interval_ms_.load();
     stats.uart_latency_avg_ms = 0.0f;
     stats.uart_latency_last_ms = 0;
     stats.uart_latency_max_ms = 0;
@@ -188,6 +262,8 @@ bool Bridge_CreateTasks(TinyBMS_Victron_Bridge* bridge) {
     const uint32_t can_stack  = TASK_DEFAULT_STACK_SIZE;
     const uint32_t cvl_stack  = TASK_DEFAULT_STACK_SIZE;
 
+    BaseType_t ok0 = xTaskCreatePinnedToCore(TinyBMS_Victron_Bridge::uartWorkerTask, "UART_Worker",
+                      uart_stack, bridge, TASK_HIGH_PRIORITY, nullptr, 1);
     BaseType_t ok1 = xTaskCreatePinnedToCore(TinyBMS_Victron_Bridge::uartTask, "UART_Task",
                       uart_stack, bridge, TASK_HIGH_PRIORITY, nullptr, 1);
     BaseType_t ok2 = xTaskCreatePinnedToCore(TinyBMS_Victron_Bridge::canTask, "CAN_Task",
@@ -195,7 +271,14 @@ bool Bridge_CreateTasks(TinyBMS_Victron_Bridge* bridge) {
     BaseType_t ok3 = xTaskCreatePinnedToCore(TinyBMS_Victron_Bridge::cvlTask, "CVL_Task",
                       cvl_stack, bridge, TASK_NORMAL_PRIORITY, nullptr, 1);
 
-    return (ok1 == pdPASS && ok2 == pdPASS && ok3 == pdPASS);
+    bool packs_ok = true;
+    for (auto& link : bridge->extra_packs_) {
+        BaseType_t ok = xTaskCreatePinnedToCore(TinyBMS_Victron_Bridge::packPollTask, "UART_Pack",
+                          uart_stack, link.get(), TASK_HIGH_PRIORITY, nullptr, 1);
+        packs_ok = packs_ok && ok == pdPASS;
+    }
+
+    return (ok0 == pdPASS && ok1 == pdPASS && ok2 == pdPASS && ok3 == pdPASS && packs_ok);
 }
 
 TinyBMS_Config TinyBMS_Victron_Bridge::getConfig() const {
@@ -26,6 +26,12 @@ public:
         }
     }
 
+    void publish(const RegisterCycleBatch& event) override {
+        if (bus_) {
+            bus_->publish(event);
+        }
+    }
+
     void publish(const AlarmRaised& event) override {
         if (bus_) {
             bus_->publish(event);
@@ -60,6 +66,14 @@ public:
         return bus_ != nullptr && bus_->getLatest(event_out);
     }
 
+    bool borrowLatest(const tinybms::event::EventCallback<LiveDataUpdate>& fn) const override {
+        return bus_ != nullptr && bus_->borrowLatest<LiveDataUpdate>(fn);
+    }
+
+    uint32_t droppedRegisterBatches() const override {
+        return bus_ != nullptr ? bus_->droppedCount<RegisterCycleBatch>() : 0;
+    }
+
 private:
     EventBusV2* bus_;
 };
@@ -6,8 +6,9 @@
 #include <algorithm>
 #include <array>
 #include <functional>
-#include <map>
+#include <mutex>
 #include <vector>
+#include <cstdio>
 #include <cstring>
 #include "bridge_uart.h"
 #include "logger.h"
@@ -16,6 +17,11 @@
 #include "rtos_config.h"
 #include "uart/tinybms_uart_client.h"
 #include "uart/tinybms_decoder.h"
+#include "uart/tinybms_latency_histogram.h"
+#include "uart/tinybms_link_tracker.h"
+#include "uart/tinybms_pack_poller.h"
+#include "uart/tinybms_read_planner.h"
+#include "uart/tinybms_uart_trace.h"
 #include "tiny_read_mapping.h"
 #include "mqtt/publisher.h"
 #include "event/event_types_v2.h"
@@ -28,8 +34,7 @@ using tinybms::events::AlarmRaised;
 using tinybms::events::AlarmSeverity;
 using tinybms::events::EventSource;
 using tinybms::events::LiveDataUpdate;
-using tinybms::events::MqttRegisterValue;
-using tinybms::events::MqttRegisterEvent;
+using tinybms::events::RegisterCycleBatch;
 using tinybms::events::WarningRaised;
 
 extern Logger logger;
@@ -45,8 +50,10 @@ extern SemaphoreHandle_t statsMutex;
 namespace {
 class RingBufferedHalUart : public hal::IHalUart {
 public:
-    RingBufferedHalUart(hal::IHalUart& upstream, optimization::ByteRingBuffer& buffer)
-        : upstream_(upstream), buffer_(buffer) {}
+    RingBufferedHalUart(hal::IHalUart& upstream,
+                        optimization::ByteRingBuffer& buffer,
+                        tinybms::UartTraceRecorder& trace)
+        : upstream_(upstream), buffer_(buffer), trace_(trace) {}
 
     hal::Status initialize(const hal::UartConfig& config) override {
         return upstream_.initialize(config);
@@ -61,6 +68,7 @@ public:
     }
 
     size_t write(const uint8_t* buffer, size_t size) override {
+        trace_.record(tinybms::UartTraceDirection::Tx, millis(), buffer, size);
         return upstream_.write(buffer, size);
     }
 
@@ -72,6 +80,7 @@ public:
         size_t read = upstream_.readBytes(buffer, length);
         if (read > 0) {
             buffer_.push(buffer, read);
+            trace_.record(tinybms::UartTraceDirection::Rx, millis(), buffer, read);
         }
         return read;
     }
@@ -85,6 +94,7 @@ public:
         if (value >= 0) {
             uint8_t byte = static_cast<uint8_t>(value & 0xFF);
             buffer_.push(&byte, 1);
+            trace_.record(tinybms::UartTraceDirection::Rx, millis(), &byte, 1);
         }
         return value;
     }
@@ -92,34 +102,58 @@ public:
 private:
     hal::IHalUart& upstream_;
     optimization::ByteRingBuffer& buffer_;
+    tinybms::UartTraceRecorder& trace_;
 };
 
-constexpr std::array<uint16_t, 39> kTinyReadAddresses = {
-    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029,
-    0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033,
-    0x0034, 0x0066, 0x0067, 0x0071, 0x0072, 0x0131, 0x0132, 0x0133, 0x013B, 0x013C,
-    0x013D, 0x013E, 0x013F, 0x01F4, 0x01F5, 0x01F6, 0x01F7, 0x01F8, 0x01F9
-};
+constexpr uint32_t kTinyWakeupDelayMs = 10;
+// Estimated TinyBMS response turnaround, used only to price read plans.
+constexpr uint32_t kTinyTurnaroundUs = 2000;
+
+// How long a blocking caller waits for its queued job before cancelling it.
+constexpr uint32_t kTinyQueueWaitMs = 2000;
+// Worker idle wait while listening for broadcasts (bounds broadcast latency).
+constexpr uint32_t kTinyBroadcastIdleWaitMs = 10;
 
-constexpr size_t kTinyReadAddressCount = kTinyReadAddresses.size();
+/**
+ * @brief DelayConfig::tune_fn of the TinyBMS links (context: the bridge).
+ *        Configured values stay the ceiling; the RTT estimate only tightens them.
+ */
+void tuneFromRttEstimate(uint8_t command,
+                         size_t response_bytes,
+                         uint32_t& timeout_ms,
+                         uint32_t& retry_delay_ms,
+                         void* context) {
+    auto* self = static_cast<TinyBMS_Victron_Bridge*>(context);
+    std::lock_guard<std::mutex> lock(self->uart_poller_mutex_);
+    timeout_ms = std::min(timeout_ms, self->uart_poller_.responseTimeoutMs(command, response_bytes));
+    retry_delay_ms = std::min(retry_delay_ms, self->uart_poller_.retryDelayMs(command));
+}
 
+/**
+ * @brief Body of one TinyBMS transaction; runs on the UART worker (or inline
+ *        before the worker is started) and owns the link for its duration.
+ */
 template <typename Callable>
-bool executeTinyTransaction(TinyBMS_Victron_Bridge& bridge,
-                            size_t register_words,
-                            bool update_poller,
-                            Callable&& callable,
-                            const char* context_label) {
+tinybms::TransactionResult runTinyTransaction(TinyBMS_Victron_Bridge& bridge,
+                                              size_t register_words,
+                                              bool update_poller,
+                                              Callable& callable,
+                                              const char* context_label) {
+    tinybms::TransactionResult result{};
     if (bridge.tiny_uart_ == nullptr) {
         BRIDGE_LOG(LOG_ERROR, "UART HAL not available");
-        return false;
+        return result;
     }
 
+    // Only contended during begin()/HAL reconfiguration now that a single
+    // worker serialises every transaction.
     const TickType_t mutex_timeout = pdMS_TO_TICKS(100);
     if (xSemaphoreTake(uartMutex, mutex_timeout) != pdTRUE) {
         BRIDGE_LOG(LOG_ERROR, String("UART mutex unavailable for ") + context_label);
         bridge.stats.uart_errors++;
         bridge.stats.uart_timeouts++;
-        return false;
+        result.last_status = tinybms::AttemptStatus::Timeout;
+        return result;
     }
 
     tinybms::TransactionOptions options{};
@@ -128,7 +162,7 @@ bool executeTinyTransaction(TinyBMS_Victron_Bridge& bridge,
     options.response_timeout_ms = 100;
     options.include_start_byte = true;
     options.send_wakeup_pulse = true;
-    options.wakeup_delay_ms = 10;
+    options.wakeup_delay_ms = kTinyWakeupDelayMs;
 
     if (xSemaphoreTake(configMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
         options.attempt_count = std::max<uint8_t>(static_cast<uint8_t>(1), config.tinybms.uart_retry_count);
@@ -141,46 +175,98 @@ bool executeTinyTransaction(TinyBMS_Victron_Bridge& bridge,
         BRIDGE_LOG(LOG_WARN, "Using default UART retry configuration (config mutex unavailable)");
     }
 
+    // Only pulse when the BMS may have gone to sleep (broadcast frames count
+    // as activity, see ingestBroadcastBytes()).
+    const uint32_t start_ms = millis();
+    const bool send_wakeup = bridge.uart_link_.wakeupNeeded(start_ms);
+    options.send_wakeup_pulse = send_wakeup;
+
     auto delay_adapter = [](uint32_t delay_ms, void*) {
         if (delay_ms > 0) {
             vTaskDelay(pdMS_TO_TICKS(delay_ms));
         }
     };
 
-    tinybms::DelayConfig delay_config{delay_adapter, nullptr};
-    const uint32_t start_ms = millis();
-    bridge.uart_rx_buffer_.clear();
-    RingBufferedHalUart buffered_uart(*bridge.tiny_uart_, bridge.uart_rx_buffer_);
-    tinybms::TransactionResult result = callable(buffered_uart, options, delay_config);
-
-    const uint32_t elapsed_ms = millis() - start_ms;
+    auto clock_adapter = [](void*) -> uint32_t {
+        return micros();
+    };
+    auto attempt_adapter = [](const tinybms::AttemptTiming& timing, void* context) {
+        auto* self = static_cast<TinyBMS_Victron_Bridge*>(context);
+        self->uart_latency_.record(timing);
+        std::lock_guard<std::mutex> lock(self->uart_poller_mutex_);
+        if (timing.status == tinybms::AttemptStatus::Success && timing.attempt == 0) {
+            self->uart_poller_.recordRtt(timing.command, timing.first_byte_us);
+        } else if (timing.status == tinybms::AttemptStatus::Timeout) {
+            self->uart_poller_.recordRttTimeout(timing.command);
+        }
+    };
 
-    if (update_poller) {
-        if (result.success) {
-            bridge.uart_poller_.recordSuccess(elapsed_ms, static_cast<uint32_t>(register_words) * 2U);
-        } else {
-            if (result.last_status == tinybms::AttemptStatus::Timeout) {
-                bridge.uart_poller_.recordTimeout();
+    tinybms::DelayConfig delay_config{delay_adapter, &bridge, clock_adapter, attempt_adapter, tuneFromRttEstimate};
+    bridge.uart_rx_buffer_.clear();
+    RingBufferedHalUart buffered_uart(*bridge.tiny_uart_, bridge.uart_rx_buffer_, bridge.uart_trace_);
+    result = callable(buffered_uart, options, delay_config);
+
+    const uint32_t end_ms = millis();
+    const uint32_t elapsed_ms = end_ms - start_ms;
+    bridge.uart_link_.recordTransaction(start_ms, end_ms, send_wakeup, options.wakeup_delay_ms, result);
+    const tinybms::LinkTrackerStats link_stats = bridge.uart_link_.stats();
+
+    // Snapshot of the poller for the stats, taken under its own lock.
+    std::array<UartRttStats, optimization::AdaptivePoller::kRttSlots> rtt_stats{};
+    uint32_t latency_max_ms = 0;
+    float latency_avg_ms = 0.0f;
+    {
+        std::lock_guard<std::mutex> lock(bridge.uart_poller_mutex_);
+        if (update_poller) {
+            if (result.success) {
+                bridge.uart_poller_.recordSuccess(elapsed_ms, static_cast<uint32_t>(register_words) * 2U);
             } else {
-                bridge.uart_poller_.recordFailure(elapsed_ms);
+                if (result.last_status == tinybms::AttemptStatus::Timeout) {
+                    bridge.uart_poller_.recordTimeout();
+                } else {
+                    bridge.uart_poller_.recordFailure(elapsed_ms);
+                }
             }
+            bridge.uart_poll_interval_ms_.store(bridge.uart_poller_.currentInterval());
+        }
+        for (size_t i = 0; i < rtt_stats.size(); ++i) {
+            const optimization::RttEstimate& estimate = bridge.uart_poller_.rttEstimates()[i];
+            UartRttStats& rtt = rtt_stats[i];
+            rtt.command = estimate.command;
+            rtt.samples = estimate.samples;
+            rtt.srtt_us = estimate.srtt_us;
+            rtt.rttvar_us = estimate.rttvar_us;
+            rtt.timeout_ms = bridge.uart_poller_.responseTimeoutMs(estimate.command);
+            rtt.retry_delay_ms = bridge.uart_poller_.retryDelayMs(estimate.command);
         }
-        bridge.uart_poll_interval_ms_ = bridge.uart_poller_.currentInterval();
+        latency_max_ms = bridge.uart_poller_.maxLatencyMs();
+        latency_avg_ms = bridge.uart_poller_.averageLatencyMs();
     }
 
     if (xSemaphoreTake(statsMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
         bridge.stats.uart_retry_count += result.retries_performed;
         bridge.stats.uart_timeouts += result.timeout_count;
         bridge.stats.uart_crc_errors += result.crc_error_count;
+        bridge.stats.uart_garbage_bytes += result.garbage_bytes;
+        bridge.stats.uart_resync_count += result.resync_count;
+        bridge.stats.uart_partial_frames += result.partial_frame_count;
+        bridge.stats.uart_wakeups_sent = link_stats.wakeups_sent;
+        bridge.stats.uart_wakeups_skipped = link_stats.wakeups_skipped;
+        bridge.stats.uart_wakeup_skip_failures = link_stats.skip_failures;
+        bridge.stats.uart_wakeup_saved_ms = link_stats.latency_saved_ms;
+        bridge.stats.uart_sleep_threshold_ms = link_stats.sleep_threshold_ms;
+        for (size_t i = 0; i < rtt_stats.size(); ++i) {
+            bridge.stats.uart_rtt[i] = rtt_stats[i];
+        }
         bridge.stats.uart_success_count += result.success ? 1U : 0U;
         if (!result.success) {
             bridge.stats.uart_errors++;
         }
         bridge.stats.uart_latency_last_ms = elapsed_ms;
-        bridge.stats.uart_latency_max_ms = bridge.uart_poller_.maxLatencyMs();
-        bridge.stats.uart_latency_avg_ms = bridge.uart_poller_.averageLatencyMs();
+        bridge.stats.uart_latency_max_ms = latency_max_ms;
+        bridge.stats.uart_latency_avg_ms = latency_avg_ms;
         if (update_poller) {
-            bridge.stats.uart_poll_interval_current_ms = bridge.uart_poll_interval_ms_;
+            bridge.stats.uart_poll_interval_current_ms = bridge.uart_poll_interval_ms_.load();
         }
         xSemaphoreGive(statsMutex);
     }
@@ -205,7 +291,225 @@ bool executeTinyTransaction(TinyBMS_Victron_Bridge& bridge,
     }
 
     xSemaphoreGive(uartMutex);
-    return result.success;
+    return result;
+}
+
+/**
+ * @brief Blocking transaction: queued with `priority` and awaited.
+ *
+ * The job references the caller's buffers, so a job that already started is
+ * always awaited to completion; only a still-queued job is cancelled.
+ */
+template <typename Callable>
+bool executeTinyTransaction(TinyBMS_Victron_Bridge& bridge,
+                            tinybms::TransactionPriority priority,
+                            uint32_t deadline_ms,
+                            size_t register_words,
+                            bool update_poller,
+                            Callable&& callable,
+                            const char* context_label) {
+    if (!bridge.uart_worker_running_.load()) {
+        return runTinyTransaction(bridge, register_words, update_poller, callable, context_label).success;
+    }
+
+    tinybms::TransactionJob job{};
+    job.priority = priority;
+    job.deadline_ms = deadline_ms;
+    job.run = [&bridge, register_words, update_poller, &callable, context_label]() {
+        return runTinyTransaction(bridge, register_words, update_poller, callable, context_label);
+    };
+
+    tinybms::TransactionTicket ticket = bridge.uart_queue_.submit(std::move(job));
+    if (!ticket.wait(kTinyQueueWaitMs) && ticket.cancel()) {
+        BRIDGE_LOG(LOG_WARN, String("UART queue wait timed out for ") + context_label);
+        return false;
+    }
+    // Already running on the worker: it still references our buffers.
+    while (!ticket.wait(kTinyQueueWaitMs)) {
+        BRIDGE_LOG(LOG_WARN, String("Still waiting for UART worker: ") + context_label);
+    }
+
+    switch (ticket.outcome()) {
+        case tinybms::TransactionOutcome::Completed:
+            return ticket.result().success;
+        case tinybms::TransactionOutcome::Rejected:
+            BRIDGE_LOG(LOG_WARN, String("UART queue full, dropped ") + context_label);
+            return false;
+        case tinybms::TransactionOutcome::Expired:
+            BRIDGE_LOG(LOG_DEBUG, String("UART deadline missed for ") + context_label);
+            return false;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Pick the refresh classes due this cycle and return their read plan.
+ *
+ * Periods and link parameters are re-read from the configuration each cycle;
+ * the scheduler only rebuilds a plan when the mapping or the cost model changed.
+ */
+const tinybms::ReadPlan& scheduleReadPlan(TinyBMS_Victron_Bridge& bridge,
+                                          uint32_t now_ms,
+                                          uint8_t& due_mask,
+                                          uint32_t& requests) {
+    tinybms::ReadPlanCostModel model{};
+    model.transaction_overhead_us = kTinyWakeupDelayMs * 1000U + kTinyTurnaroundUs;
+    tinybms::RefreshPeriods periods = bridge.uart_scheduler_.periods();
+    bool broadcast_expected = bridge.uart_broadcast_enabled_.load();
+    if (xSemaphoreTake(configMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        if (config.hardware.uart.baudrate > 0) {
+            model.baud_rate = static_cast<uint32_t>(config.hardware.uart.baudrate);
+        }
+        periods.fast_ms = config.tinybms.refresh_fast_ms;
+        periods.normal_ms = config.tinybms.refresh_normal_ms;
+        periods.slow_ms = config.tinybms.refresh_slow_ms;
+        broadcast_expected = config.tinybms.broadcast_expected;
+        xSemaphoreGive(configMutex);
+    }
+    bridge.uart_broadcast_enabled_.store(broadcast_expected);
+
+    // Registers the TinyBMS is currently broadcasting are not polled.
+    std::vector<uint16_t> covered;
+    if (broadcast_expected) {
+        std::lock_guard<std::mutex> lock(bridge.uart_broadcast_mutex_);
+        const uint32_t now = millis();
+        covered = bridge.uart_broadcast_.coveredAddresses(now);
+        if (bridge.uart_broadcast_.active(now)) {
+            model.transaction_overhead_us = kTinyTurnaroundUs;   // no wake-up pulse
+        }
+    }
+    const uint32_t poll_interval_ms = bridge.uart_poll_interval_ms_.load();
+    if (bridge.uart_link_.sleepThresholdMs() > poll_interval_ms) {
+        // Back-to-back polls keep the BMS awake: the pulse is normally skipped.
+        model.transaction_overhead_us = kTinyTurnaroundUs;
+    }
+
+    tinybms::PollScheduler& scheduler = bridge.uart_scheduler_;
+    scheduler.setPeriods(periods);
+    scheduler.setExcludedAddresses(std::move(covered));
+    due_mask = scheduler.dueMask(now_ms, poll_interval_ms / 2U, requests);
+
+    const tinybms::ReadPlan& plan = scheduler.planFor(due_mask, model);
+    if (bridge.uart_read_buffer_.size() < scheduler.maxOperationWords()) {
+        bridge.uart_read_buffer_.assign(scheduler.maxOperationWords(), 0);
+    }
+    return plan;
+}
+
+/**
+ * @brief Merge the register words decoded from broadcasts into the poll cache.
+ * @return Refresh-class mask of the bindings updated.
+ */
+uint8_t mergeBroadcastWords(TinyBMS_Victron_Bridge& bridge) {
+    if (!bridge.uart_broadcast_enabled_.load()) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(bridge.uart_broadcast_mutex_);
+    return bridge.uart_broadcast_.takeUpdates(bridge.uart_register_cache_);
+}
+
+/**
+ * @brief Drain whatever the TinyBMS sent unsolicited while no transaction
+ *        was running. Called from the UART worker only.
+ */
+void ingestBroadcastBytes(TinyBMS_Victron_Bridge& bridge) {
+    if (bridge.tiny_uart_ == nullptr || bridge.tiny_uart_->available() <= 0) {
+        return;
+    }
+    if (xSemaphoreTake(uartMutex, 0) != pdTRUE) {
+        return;
+    }
+
+    std::array<uint8_t, 64> chunk{};
+    const uint32_t now = millis();
+    int available = bridge.tiny_uart_->available();
+    while (available > 0) {
+        const size_t wanted = std::min(chunk.size(), static_cast<size_t>(available));
+        const size_t read = bridge.tiny_uart_->readBytes(chunk.data(), wanted);
+        if (read == 0) {
+            break;
+        }
+        bridge.uart_trace_.record(tinybms::UartTraceDirection::Rx, now, chunk.data(), read);
+        {
+            std::lock_guard<std::mutex> lock(bridge.uart_broadcast_mutex_);
+            const uint32_t frames_before = bridge.uart_broadcast_.stats().frames;
+            bridge.uart_broadcast_.feed(chunk.data(), read, now);
+            if (bridge.uart_broadcast_.stats().frames != frames_before) {
+                bridge.uart_link_.noteActivity(now);
+            }
+        }
+        available = bridge.tiny_uart_->available();
+    }
+
+    xSemaphoreGive(uartMutex);
+}
+
+/**
+ * @brief Run every operation of the read plan under a single UART transaction
+ *        (one mutex hold, one poller sample) and collect the words read.
+ */
+bool readTinyPlan(TinyBMS_Victron_Bridge& bridge,
+                  const tinybms::ReadPlan& plan,
+                  tinybms::RegisterStore& register_values) {
+    if (plan.empty()) {
+        return false;
+    }
+
+    uint16_t* buffer = bridge.uart_read_buffer_.data();
+    size_t total_words = 0;
+    for (const auto& op : plan.operations) {
+        total_words += op.register_count;
+    }
+
+    auto callable = [&plan, buffer, &register_values](hal::IHalUart& uart,
+                                                      const tinybms::TransactionOptions& options,
+                                                      const tinybms::DelayConfig& delay) {
+        return tinybms::readPlanRegisters(uart, plan, buffer, register_values, options, delay);
+    };
+
+    // A live poll that could not start before the next cycle is worthless.
+    const uint32_t deadline_ms = millis() + bridge.uart_poll_interval_ms_.load();
+    return executeTinyTransaction(bridge, tinybms::TransactionPriority::LivePoll, deadline_ms,
+                                  total_words, true, callable, "register plan read");
+}
+
+/**
+ * @brief Warn when a configured pack leaves the combined view (stale): the
+ *        bank current, SOC and limits change without it. uartTask only.
+ */
+void notePackDropouts(TinyBMS_Victron_Bridge& bridge, BridgeEventSink& sink, uint32_t now_ms) {
+    const std::vector<tinybms::PackStatus> packs = bridge.packs_.status(now_ms);
+    uint8_t fresh_mask = 0;
+    for (const tinybms::PackStatus& pack : packs) {
+        if (pack.fresh) {
+            fresh_mask |= static_cast<uint8_t>(1U << pack.index);
+        }
+    }
+    const uint8_t dropped = bridge.packs_fresh_mask_ & static_cast<uint8_t>(~fresh_mask);
+    const uint8_t rejoined = fresh_mask & static_cast<uint8_t>(~bridge.packs_fresh_mask_);
+    bridge.packs_fresh_mask_ = fresh_mask;
+
+    for (const tinybms::PackStatus& pack : packs) {
+        const uint8_t bit = static_cast<uint8_t>(1U << pack.index);
+        if (rejoined & bit) {
+            BRIDGE_LOG(LOG_INFO, String("Pack ") + pack.index + " merged into the bank");
+        }
+        if ((dropped & bit) == 0) {
+            continue;
+        }
+        BRIDGE_LOG(LOG_WARN, String("Pack ") + pack.index + " stale for " + pack.age_ms + " ms, left out of the bank");
+        WarningRaised warning{};
+        warning.metadata.source = EventSource::Uart;
+        warning.alarm.alarm_code = static_cast<uint16_t>(AlarmCode::BmsOffline);
+        warning.alarm.severity = static_cast<uint8_t>(AlarmSeverity::Warning);
+        std::snprintf(warning.alarm.message, sizeof(warning.alarm.message),
+                      "Pack %u stale, left out of the bank", static_cast<unsigned>(pack.index));
+        warning.alarm.value = static_cast<float>(pack.index);
+        warning.alarm.is_active = true;
+        victron::annotateAlarm(AlarmCode::BmsOffline, AlarmSeverity::Warning, warning.alarm);
+        sink.publish(warning);
+    }
 }
 
 void publishAlarmEvent(BridgeEventSink& sink,
@@ -229,7 +533,8 @@ void publishAlarmEvent(BridgeEventSink& sink,
 }
 }
 
-bool TinyBMS_Victron_Bridge::readTinyRegisters(uint16_t start_addr, uint16_t count, uint16_t* output) {
+bool TinyBMS_Victron_Bridge::readTinyRegisters(uint16_t start_addr, uint16_t count, uint16_t* output,
+                                               tinybms::TransactionPriority priority) {
     if (output == nullptr || count == 0 || count > 127) {
         BRIDGE_LOG(LOG_ERROR, "Invalid readTinyRegisters arguments");
         return false;
@@ -241,10 +546,11 @@ bool TinyBMS_Victron_Bridge::readTinyRegisters(uint16_t start_addr, uint16_t cou
         return tinybms::readRegisterBlock(uart, start_addr, static_cast<uint8_t>(count), output, options, delay);
     };
 
-    return executeTinyTransaction(*this, count, true, callable, "register read");
+    return executeTinyTransaction(*this, priority, 0, count, true, callable, "register read");
 }
 
-bool TinyBMS_Victron_Bridge::readTinyRegisters(const uint16_t* addresses, size_t count, uint16_t* output) {
+bool TinyBMS_Victron_Bridge::readTinyRegisters(const uint16_t* addresses, size_t count, uint16_t* output,
+                                               tinybms::TransactionPriority priority) {
     if (addresses == nullptr || output == nullptr || count == 0 || count > 127) {
         BRIDGE_LOG(LOG_ERROR, "Invalid register list for TinyBMS read");
         return false;
@@ -256,10 +562,11 @@ bool TinyBMS_Victron_Bridge::readTinyRegisters(const uint16_t* addresses, size_t
         return tinybms::readIndividualRegisters(uart, addresses, count, output, options, delay);
     };
 
-    return executeTinyTransaction(*this, count, true, callable, "register list read");
+    return executeTinyTransaction(*this, priority, 0, count, true, callable, "register list read");
 }
 
-bool TinyBMS_Victron_Bridge::writeTinyRegisters(const uint16_t* addresses, const uint16_t* values, size_t count) {
+bool TinyBMS_Victron_Bridge::writeTinyRegisters(const uint16_t* addresses, const uint16_t* values, size_t count,
+                                                tinybms::TransactionPriority priority) {
     if (addresses == nullptr || values == nullptr || count == 0 || count > 63) {
         BRIDGE_LOG(LOG_ERROR, "Invalid TinyBMS write request");
         return false;
@@ -271,7 +578,105 @@ bool TinyBMS_Victron_Bridge::writeTinyRegisters(const uint16_t* addresses, const
         return tinybms::writeIndividualRegisters(uart, addresses, values, count, options, delay);
     };
 
-    return executeTinyTransaction(*this, count, false, callable, "register write");
+    return executeTinyTransaction(*this, priority, 0, count, false, callable, "register write");
+}
+
+tinybms::TransactionTicket TinyBMS_Victron_Bridge::submitTinyTransaction(tinybms::TransactionPriority priority,
+                                                                         uint32_t deadline_ms,
+                                                                         size_t register_words,
+                                                                         TinyTransactionCallable callable,
+                                                                         tinybms::TransactionCompletion on_complete,
+                                                                         const char* context_label) {
+    tinybms::TransactionJob job{};
+    job.priority = priority;
+    job.deadline_ms = deadline_ms;
+    job.on_complete = std::move(on_complete);
+    job.run = [this, register_words, context_label, callable = std::move(callable)]() mutable {
+        return runTinyTransaction(*this, register_words, false, callable, context_label);
+    };
+    return uart_queue_.submit(std::move(job));
+}
+
+void TinyBMS_Victron_Bridge::uartWorkerTask(void *pvParameters) {
+    auto *bridge = static_cast<TinyBMS_Victron_Bridge*>(pvParameters);
+    BRIDGE_LOG(LOG_INFO, "uartWorkerTask started");
+    bridge->uart_worker_running_.store(true);
+
+    while (true) {
+        const bool listening = bridge->uart_broadcast_enabled_.load();
+        bridge->uart_queue_.runNext(listening ? kTinyBroadcastIdleWaitMs : 100);
+        if (listening) {
+            ingestBroadcastBytes(*bridge);
+        }
+        // Between transactions: capture writes never delay the traffic they record.
+        bridge->uart_trace_.flushIfDue();
+    }
+}
+
+void TinyBMS_Victron_Bridge::packPollTask(void *pvParameters) {
+    auto *link = static_cast<TinyPackLink*>(pvParameters);
+    TinyBMS_Victron_Bridge& bridge = *link->bridge;
+    BRIDGE_LOG(LOG_INFO, String("packPollTask started for pack ") + link->index);
+
+    auto delay_adapter = [](uint32_t delay_ms, void*) {
+        if (delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(delay_ms));
+        }
+    };
+    auto clock_adapter = [](void*) -> uint32_t {
+        return micros();
+    };
+    // Same BMS model and wiring as pack 0: its RTT estimates tighten the
+    // timeouts here too (samples are only taken on pack 0's link).
+    const tinybms::DelayConfig delay_config{delay_adapter, &bridge, clock_adapter, nullptr, tuneFromRttEstimate};
+    TinyBMS_LiveData live{};
+
+    while (true) {
+        // Same cadence and link settings as pack 0; this link is owned by
+        // this task alone, so no queue or mutex is involved.
+        const uint32_t interval_ms = bridge.uart_poll_interval_ms_.load();
+        tinybms::TransactionOptions options{};
+        options.attempt_count = 3;
+        options.retry_delay_ms = 50;
+        options.response_timeout_ms = 100;
+        options.include_start_byte = true;
+        options.wakeup_delay_ms = kTinyWakeupDelayMs;
+        tinybms::RefreshPeriods periods{};
+        tinybms::ReadPlanCostModel model{};
+        model.transaction_overhead_us = kTinyWakeupDelayMs * 1000U + kTinyTurnaroundUs;
+        if (xSemaphoreTake(configMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+            options.attempt_count = std::max<uint8_t>(static_cast<uint8_t>(1), config.tinybms.uart_retry_count);
+            options.retry_delay_ms = config.tinybms.uart_retry_delay_ms;
+            options.response_timeout_ms = std::max<uint32_t>(20, static_cast<uint32_t>(config.hardware.uart.timeout_ms));
+            periods.fast_ms = config.tinybms.refresh_fast_ms;
+            periods.normal_ms = config.tinybms.refresh_normal_ms;
+            periods.slow_ms = config.tinybms.refresh_slow_ms;
+            if (config.hardware.uart.baudrate > 0) {
+                model.baud_rate = static_cast<uint32_t>(config.hardware.uart.baudrate);
+            }
+            xSemaphoreGive(configMutex);
+        }
+        link->poller->setPeriods(periods);
+        link->poller->setCostModel(model);
+
+        const uint32_t start_ms = millis();
+        const bool send_wakeup = link->link.wakeupNeeded(start_ms);
+        options.send_wakeup_pulse = send_wakeup;
+        const uint32_t cycles_before = link->poller->stats().cycles;
+        if (link->poller->poll(start_ms, interval_ms / 2U, options, delay_config, live)) {
+            bridge.packs_.update(link->index, live, millis());
+        }
+        if (link->poller->stats().cycles != cycles_before) {
+            link->link.recordTransaction(start_ms, millis(), send_wakeup, options.wakeup_delay_ms,
+                                         link->poller->stats().last_result);
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(interval_ms));
+    }
+}
+
+void TinyBMS_Victron_Bridge::requestTinyRegisterRefresh(uint16_t address) {
+    uart_scheduler_.requestRefreshForAddress(address);
 }
 
 void TinyBMS_Victron_Bridge::uartTask(void *pvParameters) {
@@ -281,44 +686,77 @@ void TinyBMS_Victron_Bridge::uartTask(void *pvParameters) {
     while (true) {
         BridgeEventSink& event_sink = bridge->eventSink();
         uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
-        if (now - bridge->last_uart_poll_ms_ >= bridge->uart_poll_interval_ms_) {
+        if (now - bridge->last_uart_poll_ms_ >= bridge->uart_poll_interval_ms_.load()) {
+            uint8_t due_mask = 0;
+            uint32_t refresh_requests = 0;
+            const tinybms::ReadPlan& plan = scheduleReadPlan(*bridge, now, due_mask, refresh_requests);
+            // Registers not due this cycle keep their last value in the cache.
+            tinybms::RegisterStore& register_values = bridge->uart_register_cache_;
+            register_values.ensureLayout(getTinyRegisterBindings(), getTinyReadMappingVersion());
+            bridge->uart_decode_plan_.ensureCompiled(getTinyRegisterBindings(), register_values);
+            const uint8_t broadcast_mask = mergeBroadcastWords(*bridge);
+            if (plan.empty() && broadcast_mask == 0) {
+                // No refresh class due yet (periods longer than the poll interval),
+                // or every due register is broadcast and nothing new arrived.
+                bridge->uart_scheduler_.markRefreshed(due_mask, now, refresh_requests);
+                bridge->last_uart_poll_ms_ = now;
+                if (xSemaphoreTake(feedMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+                    Watchdog.feed();
+                    xSemaphoreGive(feedMutex);
+                }
+                vTaskDelay(pdMS_TO_TICKS(bridge->uart_poll_interval_ms_.load()));
+                continue;
+            }
+
             TinyBMS_LiveData d{};
             d.resetSnapshots();
 
-            std::map<uint16_t, uint16_t> register_values;
-            std::array<uint16_t, kTinyReadAddressCount> buffer{};
-            bool read_success = bridge->readTinyRegisters(kTinyReadAddresses.data(),
-                                                          kTinyReadAddressCount,
-                                                          buffer.data());
+            // Broadcast-only cycle: nothing left to poll.
+            bool read_success = plan.empty() || readTinyPlan(*bridge, plan, register_values);
 
             if (read_success) {
-                for (size_t i = 0; i < kTinyReadAddressCount; ++i) {
-                    register_values[kTinyReadAddresses[i]] = buffer[i];
+                bridge->uart_scheduler_.markRefreshed(due_mask, now, refresh_requests);
+                const uint8_t refreshed_mask = static_cast<uint8_t>((plan.empty() ? 0 : due_mask) | broadcast_mask);
+                if (xSemaphoreTake(statsMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+                    bridge->stats.uart_cycle_bytes_last = plan.wire_bytes;
+                    xSemaphoreGive(statsMutex);
                 }
-            }
 
-            if (read_success) {
-                // Phase 3: Collect MQTT register events to publish AFTER live_data
-                std::vector<MqttRegisterEvent> deferred_mqtt_events;
-                deferred_mqtt_events.reserve(32); // Reserve space for ~32 typical registers
-
-                const auto& bindings = getTinyRegisterBindings();
-                for (const auto& binding : bindings) {
-                    MqttRegisterEvent mqtt_event{};
-                    tinybms::events::MqttRegisterEvent* event_ptr = event_sink.isReady() ? &mqtt_event : nullptr;
-                    if (tinybms::uart::detail::decodeAndApplyBinding(binding,
-                                                                     register_values,
-                                                                     d,
-                                                                     now,
-                                                                     event_ptr)) {
-                        if (event_ptr != nullptr) {
-                            deferred_mqtt_events.push_back(mqtt_event);
-                        }
-                    }
+                // Phase 3: Collect register events, published as one batch AFTER live_data
+                RegisterCycleBatch& cycle_batch = bridge->uart_cycle_batch_;
+                cycle_batch.clear();
+
+                // Only registers refreshed this cycle, and changed beyond their
+                // deadband (or silent past their heartbeat), are republished over MQTT.
+                // A batch lost by a full subscriber queue took its deltas with it:
+                // report everything again, as after a reconnection.
+                const bool events_ready = event_sink.isReady();
+                const uint32_t batch_drops = event_sink.droppedRegisterBatches();
+                if ((events_ready && !bridge->uart_events_ready_) || batch_drops != bridge->uart_batch_drops_seen_) {
+                    bridge->uart_report_filter_.forceNext();
+                }
+                bridge->uart_batch_drops_seen_ = batch_drops;
+                bridge->uart_events_ready_ = events_ready;
+                const uint8_t event_mask = events_ready ? refreshed_mask : 0;
+                bridge->uart_decode_plan_.apply(register_values, d, now, event_mask, &cycle_batch,
+                                                &bridge->uart_report_filter_);
+                if (xSemaphoreTake(statsMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+                    bridge->stats.uart_events_reported = bridge->uart_report_filter_.stats().reported;
+                    bridge->stats.uart_events_suppressed = bridge->uart_report_filter_.stats().suppressed;
+                    xSemaphoreGive(statsMutex);
                 }
 
                 tinybms::uart::detail::finalizeLiveDataFromRegisters(d);
 
+                // Multi-pack bank: CAN, CVL, alarms and the cutoffs below work on
+                // the combined view (the most conservative limits of the bank).
+                if (bridge->packs_.packCount() > 1) {
+                    const uint32_t pack_now = millis();
+                    bridge->packs_.update(0, d, pack_now);
+                    bridge->packs_.combine(pack_now, d);
+                    notePackDropouts(*bridge, event_sink, pack_now);
+                }
+
                 const bool has_pack_temp = (d.findSnapshot(113) != nullptr);
                 const bool has_overvoltage_reg = (d.findSnapshot(315) != nullptr);
                 const bool has_undervoltage_reg = (d.findSnapshot(316) != nullptr);
@@ -348,12 +786,10 @@ void TinyBMS_Victron_Bridge::uartTask(void *pvParameters) {
                 live_event.data = d;
                 event_sink.publish(live_event);
 
-                // Phase 3: Now publish deferred MQTT register events
-                for (const auto& mqtt_event : deferred_mqtt_events) {
-                    MqttRegisterValue mqtt_value{};
-                    mqtt_value.metadata.source = EventSource::Uart;
-                    mqtt_value.payload = mqtt_event;
-                    event_sink.publish(mqtt_value);
+                // Phase 3: Now publish the cycle's register events, one event for all of them
+                if (!cycle_batch.empty()) {
+                    cycle_batch.metadata.source = EventSource::Uart;
+                    event_sink.publish(cycle_batch);
                 }
 
                 // Phase 2: Protect config.victron.thresholds read
@@ -452,6 +888,6 @@ void TinyBMS_Victron_Bridge::uartTask(void *pvParameters) {
             }
         }
 
-        vTaskDelay(pdMS_TO_TICKS(bridge->uart_poll_interval_ms_));
+        vTaskDelay(pdMS_TO_TICKS(bridge->uart_poll_interval_ms_.load()));
     }
 }
@@ -98,6 +98,7 @@ bool ConfigManager::begin(const char* filename) {
     loadAdvancedConfig(doc);
 
     loaded_ = true;
+    version_.fetch_add(1, std::memory_order_acq_rel);
     logger.log(LOG_INFO, "Configuration loaded successfully");
 
     printConfig();
@@ -114,6 +115,9 @@ bool ConfigManager::save() {
         return false;
     }
 
+    // Callers edit the fields before saving: they are live even if the write fails.
+    version_.fetch_add(1, std::memory_order_acq_rel);
+
     DynamicJsonDocument doc(6144);
 
     hal::IHalStorage& storage = hal::HalManager::instance().storage();
@@ -219,7 +223,31 @@ void ConfigManager::loadTinyBMSConfig(const JsonDocument& doc) {
     tinybms.poll_success_threshold = tinyObj["poll_success_threshold"] | tinybms.poll_success_threshold;
     tinybms.uart_retry_count = tinyObj["uart_retry_count"] | tinybms.uart_retry_count;
     tinybms.uart_retry_delay_ms = tinyObj["uart_retry_delay_ms"] | tinybms.uart_retry_delay_ms;
+    tinybms.uart_adaptive_timeouts = tinyObj["uart_adaptive_timeouts"] | tinybms.uart_adaptive_timeouts;
+    tinybms.uart_timeout_min_ms = tinyObj["uart_timeout_min_ms"] | tinybms.uart_timeout_min_ms;
+    tinybms.uart_retry_delay_min_ms = tinyObj["uart_retry_delay_min_ms"] | tinybms.uart_retry_delay_min_ms;
     tinybms.broadcast_expected = tinyObj["broadcast_expected"] | tinybms.broadcast_expected;
+    tinybms.refresh_fast_ms = tinyObj["refresh_fast_ms"] | tinybms.refresh_fast_ms;
+    tinybms.refresh_normal_ms = tinyObj["refresh_normal_ms"] | tinybms.refresh_normal_ms;
+    tinybms.refresh_slow_ms = tinyObj["refresh_slow_ms"] | tinybms.refresh_slow_ms;
+    tinybms.pack_capacity_ah = tinyObj["pack_capacity_ah"] | tinybms.pack_capacity_ah;
+    tinybms.pack_stale_ms = tinyObj["pack_stale_ms"] | tinybms.pack_stale_ms;
+
+    JsonArrayConst packs = tinyObj["extra_packs"].as<JsonArrayConst>();
+    if (!packs.isNull()) {
+        tinybms.extra_pack_count = 0;
+        for (JsonObjectConst packObj : packs) {
+            if (tinybms.extra_pack_count >= TinyBMSConfig::kMaxExtraPacks) {
+                break;
+            }
+            TinyBMSConfig::ExtraPack& pack = tinybms.extra_packs[tinybms.extra_pack_count++];
+            pack = TinyBMSConfig::ExtraPack{};
+            pack.uart_port = packObj["uart_port"] | pack.uart_port;
+            pack.rx_pin = packObj["rx_pin"] | pack.rx_pin;
+            pack.tx_pin = packObj["tx_pin"] | pack.tx_pin;
+            pack.capacity_ah = packObj["capacity_ah"] | pack.capacity_ah;
+        }
+    }
 }
 
 void ConfigManager::loadVictronConfig(const JsonDocument& doc) {
@@ -227,6 +255,8 @@ void ConfigManager::loadVictronConfig(const JsonDocument& doc) {
     if (vicObj.isNull()) return;
 
     victron.pgn_update_interval_ms = vicObj["pgn_update_interval_ms"] | victron.pgn_update_interval_ms;
+    victron.pgn_energy_interval_ms = vicObj["pgn_energy_interval_ms"] | victron.pgn_energy_interval_ms;
+    victron.pgn_identity_interval_ms = vicObj["pgn_identity_interval_ms"] | victron.pgn_identity_interval_ms;
     victron.cvl_update_interval_ms = vicObj["cvl_update_interval_ms"] | victron.cvl_update_interval_ms;
     victron.keepalive_interval_ms = vicObj["keepalive_interval_ms"] | victron.keepalive_interval_ms;
     victron.keepalive_timeout_ms = vicObj["keepalive_timeout_ms"] | victron.keepalive_timeout_ms;
@@ -401,12 +431,32 @@ void ConfigManager::saveTinyBMSConfig(JsonDocument& doc) const {
     tinyObj["poll_success_threshold"] = tinybms.poll_success_threshold;
     tinyObj["uart_retry_count"] = tinybms.uart_retry_count;
     tinyObj["uart_retry_delay_ms"] = tinybms.uart_retry_delay_ms;
+    tinyObj["uart_adaptive_timeouts"] = tinybms.uart_adaptive_timeouts;
+    tinyObj["uart_timeout_min_ms"] = tinybms.uart_timeout_min_ms;
+    tinyObj["uart_retry_delay_min_ms"] = tinybms.uart_retry_delay_min_ms;
     tinyObj["broadcast_expected"] = tinybms.broadcast_expected;
+    tinyObj["refresh_fast_ms"] = tinybms.refresh_fast_ms;
+    tinyObj["refresh_normal_ms"] = tinybms.refresh_normal_ms;
+    tinyObj["refresh_slow_ms"] = tinybms.refresh_slow_ms;
+    tinyObj["pack_capacity_ah"] = tinybms.pack_capacity_ah;
+    tinyObj["pack_stale_ms"] = tinybms.pack_stale_ms;
+
+    JsonArray packs = tinyObj.createNestedArray("extra_packs");
+    for (uint8_t i = 0; i < tinybms.extra_pack_count; ++i) {
+        const TinyBMSConfig::ExtraPack& pack = tinybms.extra_packs[i];
+        JsonObject packObj = packs.createNestedObject();
+        packObj["uart_port"] = pack.uart_port;
+        packObj["rx_pin"] = pack.rx_pin;
+        packObj["tx_pin"] = pack.tx_pin;
+        packObj["capacity_ah"] = pack.capacity_ah;
+    }
 }
 
 void ConfigManager::saveVictronConfig(JsonDocument& doc) const {
     JsonObject vicObj = doc.createNestedObject("victron");
     vicObj["pgn_update_interval_ms"] = victron.pgn_update_interval_ms;
+    vicObj["pgn_energy_interval_ms"] = victron.pgn_energy_interval_ms;
+    vicObj["pgn_identity_interval_ms"] = victron.pgn_identity_interval_ms;
     vicObj["cvl_update_interval_ms"] = victron.cvl_update_interval_ms;
     vicObj["keepalive_interval_ms"] = victron.keepalive_interval_ms;
     vicObj["keepalive_timeout_ms"] = victron.keepalive_timeout_ms;
@@ -0,0 +1,605 @@
+#include "event/event_journal.h"
+
+#include <Arduino.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+namespace tinybms::event {
+
+using tinybms::events::AlarmCleared;
+using tinybms::events::AlarmEvent;
+using tinybms::events::AlarmRaised;
+using tinybms::events::ConfigChanged;
+using tinybms::events::CVLStateChanged;
+using tinybms::events::StatusMessage;
+using tinybms::events::WarningRaised;
+
+namespace {
+
+constexpr uint8_t kIndexMagic[4] = {'T', 'B', 'J', 'I'};
+constexpr uint8_t kIndexVersion = 1;
+constexpr size_t kIndexHeaderSize = 8;
+constexpr size_t kIndexEntrySize = 24;
+constexpr size_t kRecordSize = sizeof(JournalRecord);
+constexpr size_t kRecordCrcOffset = offsetof(JournalRecord, crc);
+
+uint32_t crc32(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+uint32_t recordCrc(const JournalRecord& record) {
+    return crc32(reinterpret_cast<const uint8_t*>(&record), kRecordCrcOffset);
+}
+
+bool recordValid(const JournalRecord& record) {
+    return record.type != JournalEventType::None &&
+           static_cast<uint8_t>(record.type) <= static_cast<uint8_t>(JournalEventType::StatusMessage) &&
+           record.crc == recordCrc(record);
+}
+
+template <typename T>
+void put(std::vector<uint8_t>& out, T value) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+T get(const uint8_t* data, size_t offset) {
+    T value;
+    std::memcpy(&value, data + offset, sizeof(T));
+    return value;
+}
+
+void copyText(char* dest, size_t size, const char* src) {
+    std::strncpy(dest, src, size - 1);
+    dest[size - 1] = '\0';
+}
+
+JournalRecord alarmRecord(JournalEventType type, const AlarmEvent& alarm) {
+    JournalRecord record{};
+    record.type = type;
+    record.level = alarm.severity;
+    record.code = alarm.alarm_code;
+    record.value = alarm.value;
+    copyText(record.text, sizeof(record.text), alarm.message);
+    return record;
+}
+
+template <typename Event>
+bool isJournaled(const Event&) {
+    return true;
+}
+
+// Slow-subscriber reports are left out: a journal flush is itself a slow
+// callback candidate, and recording its report would feed the loop.
+bool isJournaled(const StatusMessage& event) {
+    return event.metadata.source != tinybms::events::EventSource::EventBus;
+}
+
+} // namespace
+
+const char* journalEventTypeName(JournalEventType type) {
+    switch (type) {
+        case JournalEventType::AlarmRaised:
+            return AlarmRaised::kEventName;
+        case JournalEventType::AlarmCleared:
+            return AlarmCleared::kEventName;
+        case JournalEventType::WarningRaised:
+            return WarningRaised::kEventName;
+        case JournalEventType::CVLStateChanged:
+            return CVLStateChanged::kEventName;
+        case JournalEventType::ConfigChanged:
+            return ConfigChanged::kEventName;
+        case JournalEventType::StatusMessage:
+            return StatusMessage::kEventName;
+        default:
+            return "None";
+    }
+}
+
+JournalRecord makeJournalRecord(const AlarmRaised& event) {
+    return alarmRecord(JournalEventType::AlarmRaised, event.alarm);
+}
+
+JournalRecord makeJournalRecord(const AlarmCleared& event) {
+    return alarmRecord(JournalEventType::AlarmCleared, event.alarm);
+}
+
+JournalRecord makeJournalRecord(const WarningRaised& event) {
+    return alarmRecord(JournalEventType::WarningRaised, event.alarm);
+}
+
+JournalRecord makeJournalRecord(const CVLStateChanged& event) {
+    JournalRecord record{};
+    record.type = JournalEventType::CVLStateChanged;
+    record.code = event.state.new_state;
+    record.value = event.state.new_cvl_voltage;
+    std::snprintf(record.text, sizeof(record.text), "%u->%u CCL %.1fA DCL %.1fA",
+                  static_cast<unsigned>(event.state.old_state), static_cast<unsigned>(event.state.new_state),
+                  static_cast<double>(event.state.new_ccl_current), static_cast<double>(event.state.new_dcl_current));
+    return record;
+}
+
+JournalRecord makeJournalRecord(const ConfigChanged& event) {
+    JournalRecord record{};
+    record.type = JournalEventType::ConfigChanged;
+    // "path=value", truncated to the record.
+    const std::string text = std::string(event.change.config_path) + "=" + event.change.new_value;
+    copyText(record.text, sizeof(record.text), text.c_str());
+    return record;
+}
+
+JournalRecord makeJournalRecord(const StatusMessage& event) {
+    JournalRecord record{};
+    record.type = JournalEventType::StatusMessage;
+    record.level = static_cast<uint8_t>(event.level);
+    copyText(record.text, sizeof(record.text), event.message);
+    return record;
+}
+
+EventJournal::EventJournal(EventBusV2& bus, EventJournalConfig config)
+    : bus_(bus), config_(std::move(config)) {
+    if (config_.records_per_segment == 0) {
+        config_.records_per_segment = 1;
+    }
+    if (config_.segment_count < 2) {
+        config_.segment_count = 2;
+    }
+    if (config_.batch_records == 0) {
+        config_.batch_records = 1;
+    }
+}
+
+EventJournal::~EventJournal() {
+    end();
+}
+
+bool EventJournal::begin(hal::IHalStorage& storage, uint32_t now_ms) {
+    end();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        storage_ = &storage;
+        pending_.clear();
+        pending_.reserve(config_.batch_records);
+        active_alarms_.clear();
+        stats_ = EventJournalStats{};
+        recoverLocked();
+
+        begin_uptime_ms_ = now_ms;
+        last_since_ms_ = 0;
+        uptime_wraps_ = 0;
+        time_base_ms_ = last_time_ms_ > 0 ? last_time_ms_ + 1 : 0;
+        stats_.now_ms = time_base_ms_;
+        if (stats_.write_errors > 0) {
+            storage_ = nullptr;
+            return false;
+        }
+    }
+
+    AsyncSubscriptionOptions options;
+    options.capacity = 16;
+    options.policy = QueuePolicy::DropOldest;
+    subscribeEvent<AlarmRaised>(options);
+    subscribeEvent<AlarmCleared>(options);
+    subscribeEvent<WarningRaised>(options);
+    subscribeEvent<CVLStateChanged>(options);
+    subscribeEvent<ConfigChanged>(options);
+    subscribeEvent<StatusMessage>(options);
+    return true;
+}
+
+template <typename Event>
+void EventJournal::subscribeEvent(const AsyncSubscriptionOptions& options) {
+    subscriptions_.push_back(bus_.subscribeAsync<Event>(
+        [this](const Event& event) {
+            if (!isJournaled(event)) {
+                return;
+            }
+            const uint32_t now_ms = millis();
+            const JournalRecord record = makeJournalRecord(event);
+            if (isTransition(record, now_ms)) {
+                append(record, now_ms);
+            }
+        },
+        options));
+}
+
+void EventJournal::end() {
+    subscriptions_.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    active_alarms_.clear();
+    if (storage_ != nullptr) {
+        flushLocked();
+        storage_ = nullptr;
+    }
+}
+
+bool EventJournal::isTransition(const JournalRecord& record, uint32_t now_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (record.type == JournalEventType::AlarmCleared) {
+        active_alarms_.erase(std::remove_if(active_alarms_.begin(), active_alarms_.end(),
+                                            [&record](const ActiveAlarm& active) {
+                                                return active.type == JournalEventType::AlarmRaised &&
+                                                       active.code == record.code;
+                                            }),
+                             active_alarms_.end());
+        return true;
+    }
+    if (record.type != JournalEventType::AlarmRaised && record.type != JournalEventType::WarningRaised) {
+        return true;
+    }
+
+    // Codes that stopped being re-raised are over, even without an AlarmCleared.
+    const uint32_t repeat_ms = config_.alarm_repeat_ms;
+    active_alarms_.erase(std::remove_if(active_alarms_.begin(), active_alarms_.end(),
+                                        [now_ms, repeat_ms](const ActiveAlarm& active) {
+                                            return now_ms - active.last_raised_ms >= repeat_ms;
+                                        }),
+                         active_alarms_.end());
+    for (ActiveAlarm& active : active_alarms_) {
+        if (active.type == record.type && active.code == record.code) {
+            active.last_raised_ms = now_ms;
+            stats_.suppressed++;
+            return false;
+        }
+    }
+    active_alarms_.push_back(ActiveAlarm{record.type, record.code, now_ms});
+    return true;
+}
+
+bool EventJournal::isActive() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return storage_ != nullptr;
+}
+
+bool EventJournal::append(const JournalRecord& record, uint32_t now_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (storage_ == nullptr) {
+        return false;
+    }
+
+    // Journal time: uptime since begin() on top of the newest stored record.
+    const uint32_t since = now_ms - begin_uptime_ms_;
+    if (since < last_since_ms_ && last_since_ms_ - since > 0x80000000u) {
+        uptime_wraps_ += 1ull << 32;   // millis() wrapped (~49.7 days)
+    }
+    last_since_ms_ = since;
+    last_time_ms_ = std::max(last_time_ms_, time_base_ms_ + uptime_wraps_ + since);
+
+    if (pending_.empty()) {
+        pending_since_ms_ = now_ms;
+    }
+    pending_.push_back(record);
+    JournalRecord& stored = pending_.back();
+    stored.sequence = next_sequence_++;
+    stored.timestamp_ms = last_time_ms_;
+    stored.crc = recordCrc(stored);
+    stats_.appended++;
+    stats_.now_ms = last_time_ms_;
+    return true;
+}
+
+void EventJournal::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushLocked();
+}
+
+bool EventJournal::flushIfDue(uint32_t now_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.empty() ||
+        (pending_.size() < config_.batch_records && now_ms - pending_since_ms_ < config_.flush_interval_ms)) {
+        return false;
+    }
+    flushLocked();
+    return true;
+}
+
+size_t EventJournal::query(uint64_t from_ms, uint64_t to_ms, size_t max_records, std::vector<JournalRecord>& out) {
+    out.clear();
+    if (max_records == 0) {
+        return 0;
+    }
+    auto inRange = [from_ms, to_ms](const JournalRecord& record) {
+        return record.timestamp_ms >= from_ms && record.timestamp_ms <= to_ms;
+    };
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Newest first (buffered records, then segments backwards from the active
+    // one), reversed at the end.
+    for (auto it = pending_.rbegin(); it != pending_.rend() && out.size() < max_records; ++it) {
+        if (inRange(*it)) {
+            out.push_back(*it);
+        }
+    }
+    std::vector<JournalRecord> records;
+    for (size_t i = 0; i < segments_.size() && out.size() < max_records; ++i) {
+        const size_t slot = (active_ + segments_.size() - i) % segments_.size();
+        const Segment& segment = segments_[slot];
+        if (segment.count == 0 || segment.last_ms < from_ms || segment.first_ms > to_ms) {
+            continue;
+        }
+        readSegmentLocked(slot, records);
+        for (auto it = records.rbegin(); it != records.rend() && out.size() < max_records; ++it) {
+            if (inRange(*it)) {
+                out.push_back(*it);
+            }
+        }
+    }
+    std::reverse(out.begin(), out.end());
+    return out.size();
+}
+
+EventJournalStats EventJournal::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    EventJournalStats result = stats_;
+    result.pending = static_cast<uint32_t>(pending_.size());
+    result.next_sequence = next_sequence_;
+    result.stored = 0;
+    result.first_sequence = 0;
+    for (const Segment& segment : segments_) {
+        if (segment.count == 0) {
+            continue;
+        }
+        result.stored += segment.count;
+        if (result.first_sequence == 0 || segment.first_sequence < result.first_sequence) {
+            result.first_sequence = segment.first_sequence;
+        }
+    }
+    return result;
+}
+
+std::string EventJournal::segmentPath(size_t slot) const {
+    return config_.path_prefix + std::to_string(slot) + ".bin";
+}
+
+std::string EventJournal::indexPath() const {
+    return config_.path_prefix + ".idx";
+}
+
+void EventJournal::recoverLocked() {
+    segments_.assign(config_.segment_count, Segment{});
+    active_ = 0;
+
+    const bool indexed = loadIndexLocked();
+    if (indexed) {
+        // Sealed segments are trusted; only the active one can hold a torn tail.
+        segments_[active_] = scanSegmentLocked(active_, segments_[active_].first_sequence, false);
+    } else {
+        uint32_t newest = 0;
+        for (size_t slot = 0; slot < segments_.size(); ++slot) {
+            segments_[slot] = scanSegmentLocked(slot, 0, true);
+            if (segments_[slot].count > 0 && segments_[slot].first_sequence >= newest) {
+                newest = segments_[slot].first_sequence;
+                active_ = slot;
+            }
+        }
+    }
+
+    const Segment& active = segments_[active_];
+    if (active.count > 0 || active.first_sequence > 0) {
+        next_sequence_ = active.first_sequence + active.count;
+    } else {
+        next_sequence_ = 1;
+    }
+    last_time_ms_ = 0;
+    for (const Segment& segment : segments_) {
+        if (segment.count > 0) {
+            last_time_ms_ = std::max(last_time_ms_, segment.last_ms);
+        }
+    }
+
+    if (active.count >= config_.records_per_segment) {
+        rollOverLocked();
+    } else if (!indexed) {
+        segments_[active_].first_sequence = next_sequence_ - segments_[active_].count;
+        writeIndexLocked();
+    }
+}
+
+bool EventJournal::loadIndexLocked() {
+    const std::string path = indexPath();
+    if (!storage_->exists(path)) {
+        return false;
+    }
+    auto file = storage_->open(path, hal::StorageOpenMode::Read);
+    if (!file || !file->isOpen()) {
+        return false;
+    }
+    const size_t expected = kIndexHeaderSize + segments_.size() * kIndexEntrySize + sizeof(uint32_t);
+    std::vector<uint8_t> bytes(expected);
+    const bool complete = file->size() == expected && file->read(bytes.data(), expected) == expected;
+    file->close();
+    if (!complete || std::memcmp(bytes.data(), kIndexMagic, sizeof(kIndexMagic)) != 0 ||
+        bytes[4] != kIndexVersion || bytes[5] != segments_.size() || bytes[6] >= segments_.size() ||
+        get<uint32_t>(bytes.data(), expected - sizeof(uint32_t)) != crc32(bytes.data(), expected - sizeof(uint32_t))) {
+        return false;
+    }
+
+    active_ = bytes[6];
+    for (size_t slot = 0; slot < segments_.size(); ++slot) {
+        const size_t offset = kIndexHeaderSize + slot * kIndexEntrySize;
+        Segment& segment = segments_[slot];
+        segment.first_sequence = get<uint32_t>(bytes.data(), offset);
+        segment.count = get<uint16_t>(bytes.data(), offset + 4);
+        segment.first_ms = get<uint64_t>(bytes.data(), offset + 8);
+        segment.last_ms = get<uint64_t>(bytes.data(), offset + 16);
+        if (segment.count > config_.records_per_segment) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EventJournal::writeIndexLocked() {
+    std::vector<uint8_t> bytes;
+    bytes.reserve(kIndexHeaderSize + segments_.size() * kIndexEntrySize + sizeof(uint32_t));
+    bytes.insert(bytes.end(), kIndexMagic, kIndexMagic + sizeof(kIndexMagic));
+    bytes.push_back(kIndexVersion);
+    bytes.push_back(static_cast<uint8_t>(segments_.size()));
+    bytes.push_back(static_cast<uint8_t>(active_));
+    bytes.push_back(0);
+    for (const Segment& segment : segments_) {
+        put<uint32_t>(bytes, segment.first_sequence);
+        put<uint16_t>(bytes, segment.count);
+        put<uint16_t>(bytes, 0);
+        put<uint64_t>(bytes, segment.first_ms);
+        put<uint64_t>(bytes, segment.last_ms);
+    }
+    put<uint32_t>(bytes, crc32(bytes.data(), bytes.size()));
+
+    auto file = storage_->open(indexPath(), hal::StorageOpenMode::Write);
+    const size_t written = (file && file->isOpen()) ? file->write(bytes.data(), bytes.size()) : 0;
+    if (file) {
+        file->close();
+    }
+    stats_.index_writes++;
+    if (written != bytes.size()) {
+        stats_.write_errors++;   // the next begin() rebuilds the index from the segments
+    }
+}
+
+EventJournal::Segment EventJournal::scanSegmentLocked(size_t slot, uint32_t expected_first, bool any_first) {
+    Segment segment;
+    segment.first_sequence = expected_first;
+    const std::string path = segmentPath(slot);
+    if (!storage_->exists(path)) {
+        return segment;
+    }
+    auto file = storage_->open(path, hal::StorageOpenMode::Read);
+    if (!file || !file->isOpen()) {
+        return segment;
+    }
+    std::vector<uint8_t> bytes(file->size());
+    bytes.resize(file->read(bytes.data(), bytes.size()));
+    file->close();
+
+    const size_t available = std::min<size_t>(bytes.size() / kRecordSize, config_.records_per_segment);
+    size_t valid = 0;
+    for (; valid < available; ++valid) {
+        JournalRecord record;
+        std::memcpy(&record, bytes.data() + valid * kRecordSize, kRecordSize);
+        if (!recordValid(record)) {
+            break;
+        }
+        if (valid == 0 && any_first) {
+            segment.first_sequence = record.sequence;
+        }
+        if (record.sequence != segment.first_sequence + valid ||
+            (valid > 0 && record.timestamp_ms < segment.last_ms)) {
+            break;   // stale record of the segment's previous use
+        }
+        if (valid == 0) {
+            segment.first_ms = record.timestamp_ms;
+        }
+        segment.last_ms = record.timestamp_ms;
+    }
+    segment.count = static_cast<uint16_t>(valid);
+
+    const size_t keep = valid * kRecordSize;
+    if (bytes.size() != keep) {
+        // Cut the torn or stale tail so that appends stay record-aligned.
+        stats_.repaired += static_cast<uint32_t>((bytes.size() - keep + kRecordSize - 1) / kRecordSize);
+        if (keep == 0) {
+            storage_->remove(path);
+        } else {
+            auto rewrite = storage_->open(path, hal::StorageOpenMode::Write);
+            const size_t written = (rewrite && rewrite->isOpen()) ? rewrite->write(bytes.data(), keep) : 0;
+            if (rewrite) {
+                rewrite->close();
+            }
+            if (written != keep) {
+                stats_.write_errors++;
+            }
+        }
+    }
+    return segment;
+}
+
+void EventJournal::rollOverLocked() {
+    const Segment& sealed = segments_[active_];
+    const uint32_t first_sequence = sealed.first_sequence + sealed.count;
+    active_ = (active_ + 1) % segments_.size();
+    segments_[active_] = Segment{};
+    segments_[active_].first_sequence = first_sequence;
+    // Index first: after a crash here the reused segment's old records no
+    // longer match the indexed sequence and are discarded by begin().
+    writeIndexLocked();
+    storage_->remove(segmentPath(active_));
+}
+
+void EventJournal::flushLocked() {
+    if (pending_.empty() || storage_ == nullptr) {
+        return;
+    }
+    size_t offset = 0;
+    while (offset < pending_.size()) {
+        if (segments_[active_].count >= config_.records_per_segment) {
+            rollOverLocked();
+        }
+        Segment& segment = segments_[active_];
+        const size_t count = std::min<size_t>(pending_.size() - offset,
+                                              config_.records_per_segment - segment.count);
+        const size_t length = count * kRecordSize;
+
+        auto file = storage_->open(segmentPath(active_), hal::StorageOpenMode::Append);
+        const size_t written = (file && file->isOpen())
+                                   ? file->write(reinterpret_cast<const uint8_t*>(&pending_[offset]), length)
+                                   : 0;
+        if (file) {
+            file->close();
+        }
+        stats_.flushes++;
+        stats_.bytes_written += static_cast<uint32_t>(written);
+
+        if (written != length) {
+            stats_.write_errors++;
+            const uint16_t before = segment.count;
+            segment = scanSegmentLocked(active_, segment.first_sequence, false);
+            const size_t kept = segment.count - before;
+            stats_.written += static_cast<uint32_t>(kept);
+            stats_.dropped += static_cast<uint32_t>(pending_.size() - offset - kept);
+            // Sequences stay contiguous on flash: the dropped ones are reused.
+            next_sequence_ = segment.first_sequence + segment.count;
+            break;
+        }
+
+        if (segment.count == 0) {
+            segment.first_ms = pending_[offset].timestamp_ms;
+        }
+        segment.count = static_cast<uint16_t>(segment.count + count);
+        segment.last_ms = pending_[offset + count - 1].timestamp_ms;
+        stats_.written += static_cast<uint32_t>(count);
+        offset += count;
+        if (segment.count >= config_.records_per_segment) {
+            rollOverLocked();
+        }
+    }
+    pending_.clear();
+}
+
+void EventJournal::readSegmentLocked(size_t slot, std::vector<JournalRecord>& out) {
+    out.clear();
+    const Segment& segment = segments_[slot];
+    auto file = storage_->open(segmentPath(slot), hal::StorageOpenMode::Read);
+    stats_.segments_read++;
+    if (!file || !file->isOpen()) {
+        return;
+    }
+    out.resize(segment.count);
+    const size_t read = file->read(reinterpret_cast<uint8_t*>(out.data()), out.size() * kRecordSize);
+    file->close();
+    out.resize(read / kRecordSize);
+    out.erase(std::remove_if(out.begin(), out.end(), [](const JournalRecord& record) { return !recordValid(record); }),
+              out.end());
+}
+
+} // namespace tinybms::event
@@ -0,0 +1,153 @@
+#include "event/event_registry.h"
+
+#include <Arduino.h>
+#include <limits>
+
+namespace tinybms::event {
+
+size_t CallbackTimeHistogram::bucketIndex(uint32_t elapsed_us) {
+    size_t width = 0;
+    while (elapsed_us != 0) {
+        elapsed_us >>= 1;
+        width++;
+    }
+    return width < kBucketCount ? width : kBucketCount - 1;
+}
+
+uint32_t CallbackTimeHistogram::bucketUpperUs(size_t index) {
+    if (index >= kBucketCount - 1) {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    return 1u << index;
+}
+
+void CallbackTimeHistogram::record(uint32_t elapsed_us) {
+    buckets_[bucketIndex(elapsed_us)].fetch_add(1, std::memory_order_relaxed);
+    uint32_t previous = max_us_.load(std::memory_order_relaxed);
+    while (elapsed_us > previous &&
+           !max_us_.compare_exchange_weak(previous, elapsed_us, std::memory_order_relaxed)) {
+    }
+}
+
+void CallbackTimeHistogram::reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    max_us_.store(0, std::memory_order_relaxed);
+}
+
+uint32_t CallbackTimeHistogram::count() const {
+    uint32_t total = 0;
+    for (const auto& bucket : buckets_) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint32_t CallbackTimeHistogram::percentileUs(float percentile) const {
+    const uint32_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+    const float clamped = percentile < 0.0f ? 0.0f : (percentile > 100.0f ? 100.0f : percentile);
+    uint32_t rank = static_cast<uint32_t>(clamped / 100.0f * static_cast<float>(total) + 0.5f);
+    if (rank == 0) {
+        rank = 1;
+    }
+    uint32_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        seen += bucket(i);
+        if (seen >= rank) {
+            const uint32_t upper = bucketUpperUs(i);
+            return upper < maxUs() ? upper : maxUs();
+        }
+    }
+    return maxUs();
+}
+
+EventRegistry& EventRegistry::instance() {
+    static EventRegistry registry;
+    return registry;
+}
+
+EventChannelStats& EventRegistry::add(const char* name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    channels_.push_back(std::make_unique<EventChannelStats>(name, static_cast<uint16_t>(channels_.size())));
+    return *channels_.back();
+}
+
+void EventRegistry::recordCallback(EventChannelStats& stats, uint32_t elapsed_us) {
+    stats.callback_time.record(elapsed_us);
+    if (elapsed_us < slowThresholdUs()) {
+        return;
+    }
+    stats.slow_callbacks.fetch_add(1, std::memory_order_relaxed);
+    const uint32_t now = millis();
+    if (stats.slow_ever_reported.load(std::memory_order_relaxed) &&
+        now - stats.slow_reported_ms.load(std::memory_order_relaxed) < kSlowReportIntervalMs) {
+        return;
+    }
+    stats.slow_elapsed_us.store(elapsed_us, std::memory_order_relaxed);
+    if (!stats.slow_pending.exchange(true, std::memory_order_acq_rel)) {
+        stats.slow_reported_ms.store(now, std::memory_order_relaxed);
+        stats.slow_ever_reported.store(true, std::memory_order_relaxed);
+        slow_pending_.fetch_add(1, std::memory_order_release);
+    }
+}
+
+bool EventRegistry::takeSlowReport(SlowCallbackReport& out) {
+    if (slow_pending_.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& channel : channels_) {
+        if (channel->slow_pending.exchange(false, std::memory_order_acq_rel)) {
+            slow_pending_.fetch_sub(1, std::memory_order_relaxed);
+            out.name = channel->name;
+            out.elapsed_us = channel->slow_elapsed_us.load(std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<EventTypeSnapshot> EventRegistry::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<EventTypeSnapshot> result;
+    result.reserve(channels_.size());
+    for (const auto& channel : channels_) {
+        EventTypeSnapshot entry;
+        entry.name = channel->name;
+        entry.id = channel->id;
+        entry.published = channel->published.load(std::memory_order_relaxed);
+        entry.delivered = channel->delivered.load(std::memory_order_relaxed);
+        entry.subscribers = channel->subscribers.load(std::memory_order_relaxed);
+        entry.slow_callbacks = channel->slow_callbacks.load(std::memory_order_relaxed);
+        entry.dropped = channel->dropped.load(std::memory_order_relaxed);
+        entry.latest_skipped = channel->latest_skipped.load(std::memory_order_relaxed);
+        entry.callback_count = channel->callback_time.count();
+        entry.callback_p50_us = channel->callback_time.percentileUs(50.0f);
+        entry.callback_p99_us = channel->callback_time.percentileUs(99.0f);
+        entry.callback_max_us = channel->callback_time.maxUs();
+        for (size_t i = 0; i < CallbackTimeHistogram::kBucketCount; ++i) {
+            entry.callback_buckets[i] = channel->callback_time.bucket(i);
+        }
+        result.push_back(entry);
+    }
+    return result;
+}
+
+void EventRegistry::resetCounters() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& channel : channels_) {
+        channel->published.store(0, std::memory_order_relaxed);
+        channel->delivered.store(0, std::memory_order_relaxed);
+        channel->slow_callbacks.store(0, std::memory_order_relaxed);
+        channel->dropped.store(0, std::memory_order_relaxed);
+        channel->latest_skipped.store(0, std::memory_order_relaxed);
+        channel->callback_time.reset();
+        channel->sample_countdown.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace tinybms::event
@@ -4,7 +4,7 @@
 
 namespace tinybms::event {
 
-EventSubscriber::EventSubscriber(std::function<void()> unsubscribe)
+EventSubscriber::EventSubscriber(UnsubscribeFn unsubscribe)
     : unsubscribe_(std::move(unsubscribe)) {}
 
 EventSubscriber::EventSubscriber(EventSubscriber&& other) noexcept
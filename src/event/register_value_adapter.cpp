@@ -0,0 +1,37 @@
+#include "event/register_value_adapter.h"
+
+namespace tinybms::event {
+
+using tinybms::events::MqttRegisterValue;
+using tinybms::events::RegisterCycleBatch;
+
+RegisterValueAdapter::RegisterValueAdapter(EventBusV2& bus)
+    : bus_(bus) {}
+
+bool RegisterValueAdapter::begin() {
+    if (subscription_.isActive()) {
+        return true;
+    }
+    subscription_ = bus_.subscribe<RegisterCycleBatch>(
+        [this](const RegisterCycleBatch& batch) { split(batch); });
+    return subscription_.isActive();
+}
+
+void RegisterValueAdapter::end() {
+    subscription_.unsubscribe();
+}
+
+size_t RegisterValueAdapter::split(const RegisterCycleBatch& batch) {
+    if (!bus_.hasSubscribers<MqttRegisterValue>()) {
+        return 0;
+    }
+    MqttRegisterValue value{};
+    value.metadata.source = batch.metadata.source;
+    for (const auto& entry : batch) {
+        value.payload = entry;
+        bus_.publish(value);
+    }
+    return batch.size();
+}
+
+} // namespace tinybms::event
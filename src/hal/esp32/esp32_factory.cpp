@@ -19,6 +19,8 @@ public:
     std::unique_ptr<IHalGpio> createGpio() override { return createEsp32Gpio(); }
     std::unique_ptr<IHalTimer> createTimer() override { return createEsp32Timer(); }
     std::unique_ptr<IHalWatchdog> createWatchdog() override { return createEsp32Watchdog(); }
+    // Serial (UART0) is the console.
+    std::vector<int> uartPorts() const override { return {1, 2}; }
 };
 
 std::unique_ptr<HalFactory> createEsp32Factory() {
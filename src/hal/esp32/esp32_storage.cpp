@@ -42,13 +42,12 @@ class Esp32NvsFile : public IHalStorageFile {
 public:
     Esp32NvsFile(Preferences& prefs, std::string key, StorageOpenMode mode)
         : prefs_(prefs), key_(std::move(key)), mode_(mode) {
-        if (mode_ == StorageOpenMode::Read) {
+        if (mode_ != StorageOpenMode::Write) {
             size_t length = prefs_.getBytesLength(key_.c_str());
             if (length > 0) {
                 buffer_.resize(length);
                 prefs_.getBytes(key_.c_str(), buffer_.data(), length);
             }
-            cursor_ = 0;
         }
     }
 
@@ -131,6 +130,10 @@ public:
         return Status::Ok;
     }
 
+    StorageType type() const override {
+        return config_.type;
+    }
+
     bool exists(const std::string& path) override {
         if (!mounted_) {
             return false;
@@ -44,6 +44,11 @@ public:
     std::unique_ptr<IHalWatchdog> createWatchdog() override {
         return createEsp32IdfWatchdog();
     }
+
+    // UART2 drives the TinyBMS by default; UART0 is the console.
+    std::vector<int> uartPorts() const override {
+        return {2, 1};
+    }
 };
 
 std::unique_ptr<HalFactory> createEsp32IdfFactory() {
@@ -136,6 +136,10 @@ public:
         return Status::Ok;
     }
 
+    StorageType type() const override {
+        return StorageType::SPIFFS;   // the only backend mount() accepts
+    }
+
     bool exists(const std::string& path) override {
         std::string full_path = std::string(BASE_PATH) + path;
         struct stat st;
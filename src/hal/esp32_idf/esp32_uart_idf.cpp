@@ -42,7 +42,8 @@ public:
                                   last_config_.tx_pin != config.tx_pin ||
                                   last_config_.baudrate != config.baudrate ||
                                   last_config_.timeout_ms != config.timeout_ms ||
-                                  last_config_.use_dma != config.use_dma);
+                                  last_config_.use_dma != config.use_dma ||
+                                  last_config_.port != config.port);
 
             if (!config_changed) {
                 ESP_LOGD(TAG, "UART already initialized with same config, skipping");
@@ -54,7 +55,12 @@ public:
             deinitialize();
         }
 
-        uart_num_ = UART_NUM_2;  // Use UART2 for TinyBMS
+        // UART2 for the TinyBMS unless the configuration picks another port (multi-pack)
+        if (config.port != -1 && (config.port < 0 || config.port >= UART_NUM_MAX)) {
+            ESP_LOGE(TAG, "Unsupported UART port %d", config.port);
+            return Status::InvalidArgument;
+        }
+        uart_num_ = (config.port == -1) ? UART_NUM_2 : static_cast<uart_port_t>(config.port);
         timeout_ms_ = config.timeout_ms;
 
         uart_config_t uart_config = {
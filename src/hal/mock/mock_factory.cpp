@@ -19,6 +19,7 @@ public:
     std::unique_ptr<IHalGpio> createGpio() override { return createMockGpio(); }
     std::unique_ptr<IHalTimer> createTimer() override { return createMockTimer(); }
     std::unique_ptr<IHalWatchdog> createWatchdog() override { return createMockWatchdog(); }
+    std::vector<int> uartPorts() const override { return {1, 2, 3, 4}; }
 };
 
 std::unique_ptr<HalFactory> createMockFactory() {
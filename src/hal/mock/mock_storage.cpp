@@ -12,9 +12,7 @@ class MockStorageFile : public IHalStorageFile {
 public:
     MockStorageFile(std::vector<uint8_t>& backing, StorageOpenMode mode)
         : backing_(backing), mode_(mode) {
-        if (mode_ == StorageOpenMode::Read) {
-            cursor_ = 0;
-        } else {
+        if (mode_ == StorageOpenMode::Write) {
             backing_.clear();
         }
     }
@@ -60,6 +58,10 @@ public:
         return Status::Ok;
     }
 
+    StorageType type() const override {
+        return config_.type;
+    }
+
     bool exists(const std::string& path) override {
         return files_.count(path) > 0;
     }
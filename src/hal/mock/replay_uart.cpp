@@ -0,0 +1,105 @@
+#include "hal/replay_uart.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace hal {
+
+ReplayUart::ReplayUart(std::vector<tinybms::UartTraceEvent> events, float speed)
+    : events_(std::move(events)), speed_(speed < 0.0f ? 0.0f : speed) {}
+
+Status ReplayUart::initialize(const UartConfig& config) {
+    timeout_ms_ = config.timeout_ms;
+    return Status::Ok;
+}
+
+uint64_t ReplayUart::arrivalUs(const tinybms::UartTraceEvent& event) const {
+    if (speed_ == 0.0f || event.timestamp_ms <= anchor_trace_ms_) {
+        return anchor_us_;
+    }
+    const double gap_us = static_cast<double>(event.timestamp_ms - anchor_trace_ms_) * 1000.0 / speed_;
+    return anchor_us_ + static_cast<uint64_t>(gap_us);
+}
+
+void ReplayUart::releaseArrived() {
+    while (next_ < events_.size() &&
+           events_[next_].direction == tinybms::UartTraceDirection::Rx &&
+           arrivalUs(events_[next_]) <= now_us_) {
+        const auto& bytes = events_[next_].bytes;
+        rx_pending_.insert(rx_pending_.end(), bytes.begin(), bytes.end());
+        ++next_;
+    }
+}
+
+size_t ReplayUart::write(const uint8_t* buffer, size_t size) {
+    // A new request makes whatever the trace received before it stale, read
+    // or not (including RX the code under test wrote too early to see).
+    while (next_ < events_.size() && events_[next_].direction == tinybms::UartTraceDirection::Rx) {
+        stats_.rx_bytes_discarded += static_cast<uint32_t>(events_[next_].bytes.size());
+        ++next_;
+    }
+    stats_.rx_bytes_discarded += static_cast<uint32_t>(rx_pending_.size());
+    rx_pending_.clear();
+
+    if (next_ >= events_.size()) {
+        stats_.tx_beyond_trace++;
+        return size;
+    }
+
+    const tinybms::UartTraceEvent& tx = events_[next_++];
+    if (tx.bytes.size() == size && std::equal(tx.bytes.begin(), tx.bytes.end(), buffer)) {
+        stats_.tx_matched++;
+    } else {
+        stats_.tx_mismatched++;
+    }
+
+    anchor_us_ = now_us_;
+    anchor_trace_ms_ = tx.timestamp_ms;
+    return size;
+}
+
+size_t ReplayUart::readBytes(uint8_t* buffer, size_t length) {
+    size_t read = 0;
+    const uint64_t deadline_us = now_us_ + static_cast<uint64_t>(timeout_ms_) * 1000U;
+    while (read < length) {
+        releaseArrived();
+        if (!rx_pending_.empty()) {
+            const size_t count = std::min(length - read, rx_pending_.size());
+            std::copy(rx_pending_.begin(), rx_pending_.begin() + count, buffer + read);
+            rx_pending_.erase(rx_pending_.begin(), rx_pending_.begin() + count);
+            read += count;
+            stats_.rx_bytes_delivered += static_cast<uint32_t>(count);
+            continue;
+        }
+        if (next_ < events_.size() &&
+            events_[next_].direction == tinybms::UartTraceDirection::Rx &&
+            arrivalUs(events_[next_]) <= deadline_us) {
+            now_us_ = std::max(now_us_, arrivalUs(events_[next_]));
+            continue;
+        }
+        now_us_ = std::max(now_us_, deadline_us);
+        if (read == 0) {
+            stats_.read_timeouts++;
+        }
+        break;
+    }
+    return read;
+}
+
+int ReplayUart::available() {
+    releaseArrived();
+    return static_cast<int>(rx_pending_.size());
+}
+
+int ReplayUart::read() {
+    releaseArrived();
+    if (rx_pending_.empty()) {
+        return -1;
+    }
+    const int value = rx_pending_.front();
+    rx_pending_.pop_front();
+    stats_.rx_bytes_delivered++;
+    return value;
+}
+
+} // namespace hal
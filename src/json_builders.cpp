@@ -71,7 +71,7 @@ String getStatusJSON() {
 
         const TinyRegisterRuntimeBinding* binding = findTinyRegisterBinding(snap.address);
         if (binding && binding->value_type == TinyRegisterValueType::String && snap.has_text) {
-            reg["value"] = snap.text_value;
+            reg["value"] = snap.text_value.c_str();
         } else {
             float scaled_value = static_cast<float>(snap.raw_value);
             if (binding) {
@@ -81,7 +81,7 @@ String getStatusJSON() {
         }
         reg["valid"] = snap.raw_word_count > 0;
         if (snap.has_text) {
-            reg["text"] = snap.text_value;
+            reg["text"] = snap.text_value.c_str();
         }
 
         const TinyRegisterMetadata* meta = findTinyRegisterMetadata(snap.address);
@@ -144,6 +144,12 @@ String getStatusJSON() {
     uart_stats["timeouts"] = local_stats.uart_timeouts;
     uart_stats["crc_errors"] = local_stats.uart_crc_errors;
     uart_stats["retry_count"] = local_stats.uart_retry_count;
+    uart_stats["garbage_bytes"] = local_stats.uart_garbage_bytes;
+    uart_stats["resync_count"] = local_stats.uart_resync_count;
+    uart_stats["partial_frames"] = local_stats.uart_partial_frames;
+    uart_stats["cycle_bytes_last"] = local_stats.uart_cycle_bytes_last;
+    uart_stats["events_reported"] = local_stats.uart_events_reported;
+    uart_stats["events_suppressed"] = local_stats.uart_events_suppressed;
     uart_stats["latency_ms_last"] = local_stats.uart_latency_last_ms;
     uart_stats["latency_ms_max"] = local_stats.uart_latency_max_ms;
     uart_stats["latency_ms_avg"] = local_stats.uart_latency_avg_ms;
@@ -185,9 +191,9 @@ String getStatusJSON() {
     bus["total_events_published"] = bus_stats.total_published;
     bus["total_events_dispatched"] = bus_stats.total_delivered;
     bus["subscriber_count"] = bus_stats.subscriber_count;
-    bus["queue_overruns"] = 0;
-    bus["dispatch_errors"] = 0;
-    bus["current_queue_depth"] = 0;
+    bus["queue_overruns"] = bus_stats.queue_overruns;
+    bus["dispatch_errors"] = bus_stats.dispatch_errors;
+    bus["current_queue_depth"] = bus_stats.current_queue_depth;
 
     JsonObject mqtt_stats = stats.createNestedObject("mqtt");
     mqttBridge.appendStatus(mqtt_stats);
@@ -312,7 +318,7 @@ String getConfigJSON() {
 // SYSTEM CONFIG JSON
 // ============================================================================
 String getSystemConfigJSON() {
-    StaticJsonDocument<3072> doc;
+    StaticJsonDocument<3584> doc;
 
     if (xSemaphoreTake(configMutex, pdMS_TO_TICKS(100)) != pdTRUE) {
         logger.log(LOG_ERROR, "[JSON] Failed to acquire config mutex");
@@ -378,7 +384,24 @@ String getSystemConfigJSON() {
     tiny["poll_success_threshold"] = config.tinybms.poll_success_threshold;
     tiny["uart_retry_count"] = config.tinybms.uart_retry_count;
     tiny["uart_retry_delay_ms"] = config.tinybms.uart_retry_delay_ms;
+    tiny["uart_adaptive_timeouts"] = config.tinybms.uart_adaptive_timeouts;
+    tiny["uart_timeout_min_ms"] = config.tinybms.uart_timeout_min_ms;
+    tiny["uart_retry_delay_min_ms"] = config.tinybms.uart_retry_delay_min_ms;
     tiny["broadcast_expected"] = config.tinybms.broadcast_expected;
+    tiny["refresh_fast_ms"] = config.tinybms.refresh_fast_ms;
+    tiny["refresh_normal_ms"] = config.tinybms.refresh_normal_ms;
+    tiny["refresh_slow_ms"] = config.tinybms.refresh_slow_ms;
+    tiny["pack_capacity_ah"] = config.tinybms.pack_capacity_ah;
+    tiny["pack_stale_ms"] = config.tinybms.pack_stale_ms;
+    JsonArray extraPacks = tiny.createNestedArray("extra_packs");
+    for (uint8_t i = 0; i < config.tinybms.extra_pack_count; ++i) {
+        const auto& pack = config.tinybms.extra_packs[i];
+        JsonObject packObj = extraPacks.createNestedObject();
+        packObj["uart_port"] = pack.uart_port;
+        packObj["rx_pin"] = pack.rx_pin;
+        packObj["tx_pin"] = pack.tx_pin;
+        packObj["capacity_ah"] = pack.capacity_ah;
+    }
 
     // CVL Algorithm
     JsonObject cvl = doc.createNestedObject("cvl_algorithm");
@@ -398,6 +421,8 @@ String getSystemConfigJSON() {
     victron["manufacturer_name"] = config.victron.manufacturer_name;
     victron["battery_name"] = config.victron.battery_name;
     victron["pgn_update_interval_ms"] = config.victron.pgn_update_interval_ms;
+    victron["pgn_energy_interval_ms"] = config.victron.pgn_energy_interval_ms;
+    victron["pgn_identity_interval_ms"] = config.victron.pgn_identity_interval_ms;
     victron["cvl_update_interval_ms"] = config.victron.cvl_update_interval_ms;
     victron["keepalive_interval_ms"] = config.victron.keepalive_interval_ms;
     victron["keepalive_timeout_ms"] = config.victron.keepalive_timeout_ms;
@@ -14,6 +14,7 @@
 #include "config_manager.h"
 #include "logger.h"
 #include "event/event_bus_v2.h"
+#include "event/event_journal.h"
 #include "event/event_types_v2.h"
 #include "mqtt/victron_mqtt_bridge.h"
 #include "tinybms_config_editor.h"
@@ -65,6 +66,7 @@ TinyBMSConfigEditor configEditor;
 using tinybms::event::eventBus;
 
 mqtt::VictronMqttBridge mqttBridge(eventBus);
+tinybms::event::EventJournal eventJournal(eventBus);
 
 // Task handles
 TaskHandle_t webServerTaskHandle = NULL;
@@ -33,36 +33,37 @@ namespace {
 std::vector<TinyRegisterMetadata> g_metadata;
 std::vector<TinyRegisterRuntimeBinding> g_bindings = {
     {32, 2, 32, TinyRegisterValueType::Uint32, false, 1.0f, TinyLiveDataField::None, "Lifetime Counter", "s", nullptr},
-    {36, 1, 36, TinyRegisterValueType::Float, false, 0.01f, TinyLiveDataField::Voltage, "Battery Pack Voltage", "V", nullptr},
-    {38, 1, 38, TinyRegisterValueType::Float, true, 0.1f, TinyLiveDataField::Current, "Battery Pack Current", "A", nullptr},
-    {40, 1, 40, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::MinCellMv, "Min Cell Voltage", "mV", nullptr},
-    {41, 1, 41, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::MaxCellMv, "Max Cell Voltage", "mV", nullptr},
+    {36, 1, 36, TinyRegisterValueType::Float, false, 0.01f, TinyLiveDataField::Voltage, "Battery Pack Voltage", "V", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Fast},
+    {38, 1, 38, TinyRegisterValueType::Float, true, 0.1f, TinyLiveDataField::Current, "Battery Pack Current", "A", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Fast},
+    {40, 1, 40, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::MinCellMv, "Min Cell Voltage", "mV", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Fast},
+    {41, 1, 41, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::MaxCellMv, "Max Cell Voltage", "mV", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Fast},
     {42, 1, 42, TinyRegisterValueType::Int16, true, 0.1f, TinyLiveDataField::None, "External Temperature #1", "°C", nullptr},
     {43, 1, 43, TinyRegisterValueType::Int16, true, 0.1f, TinyLiveDataField::None, "External Temperature #2", "°C", nullptr},
     {45, 1, 45, TinyRegisterValueType::Uint16, false, 0.1f, TinyLiveDataField::SohPercent, "State Of Health", "%", nullptr},
-    {46, 1, 46, TinyRegisterValueType::Uint16, false, 0.1f, TinyLiveDataField::SocPercent, "State Of Charge", "%", nullptr},
+    {46, 1, 46, TinyRegisterValueType::Uint16, false, 0.1f, TinyLiveDataField::SocPercent, "State Of Charge", "%", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Fast},
     {48, 1, 48, TinyRegisterValueType::Int16, true, 0.1f, TinyLiveDataField::Temperature, "Internal Temperature", "°C", nullptr},
     {50, 1, 50, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::OnlineStatus, "System Status", "-", nullptr},
-    {51, 1, 51, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::BalancingBits, "Need Balancing", "-", nullptr},
+    {51, 1, 51, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::BalancingBits, "Need Balancing", "-", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Fast},
     {52, 1, 52, TinyRegisterValueType::Uint8, false, 1.0f, TinyLiveDataField::None, "Cell Imbalance Alarm", "-", nullptr},
     {113, 1, 113, TinyRegisterValueType::Int8, true, 1.0f, TinyLiveDataField::PackMinTemperature, "Pack Temperature Min", "°C", nullptr, TinyRegisterDataSlice::LowByte},
     {113, 1, 1131, TinyRegisterValueType::Int8, true, 1.0f, TinyLiveDataField::PackMaxTemperature, "Pack Temperature Max", "°C", nullptr, TinyRegisterDataSlice::HighByte},
     {102, 1, 102, TinyRegisterValueType::Uint16, false, 0.1f, TinyLiveDataField::MaxDischargeCurrent, "Max Discharge Current", "A", nullptr},
     {103, 1, 103, TinyRegisterValueType::Uint16, false, 0.1f, TinyLiveDataField::MaxChargeCurrent, "Max Charge Current", "A", nullptr},
-    {305, 1, 305, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::None, "Victron Keep-Alive", "-", nullptr},
-    {306, 1, 306, TinyRegisterValueType::Uint16, false, 0.01f, TinyLiveDataField::None, "Battery Capacity", "Ah", nullptr},
-    {307, 1, 307, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::None, "Identification Handshake", "-", nullptr},
-    {315, 1, 315, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::CellOvervoltageMv, "Overvoltage Cutoff", "mV", nullptr},
-    {316, 1, 316, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::CellUndervoltageMv, "Undervoltage Cutoff", "mV", nullptr},
-    {317, 1, 317, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::DischargeOvercurrentA, "Discharge Over-current Cutoff", "A", nullptr},
-    {318, 1, 318, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::ChargeOvercurrentA, "Charge Over-current Cutoff", "A", nullptr},
-    {319, 1, 319, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::OverheatCutoffC, "Overheat Cutoff", "°C", nullptr},
-    {500, 4, 500, TinyRegisterValueType::String, false, 1.0f, TinyLiveDataField::None, "Manufacturer Name", nullptr, nullptr},
-    {501, 2, 501, TinyRegisterValueType::Uint32, false, 1.0f, TinyLiveDataField::None, "Firmware Version", nullptr, nullptr},
-    {502, 4, 502, TinyRegisterValueType::String, false, 1.0f, TinyLiveDataField::None, "Battery Family", nullptr, nullptr}
+    {305, 1, 305, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::None, "Victron Keep-Alive", "-", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Slow},
+    {306, 1, 306, TinyRegisterValueType::Uint16, false, 0.01f, TinyLiveDataField::None, "Battery Capacity", "Ah", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Slow},
+    {307, 1, 307, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::None, "Identification Handshake", "-", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Slow},
+    {315, 1, 315, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::CellOvervoltageMv, "Overvoltage Cutoff", "mV", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Slow},
+    {316, 1, 316, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::CellUndervoltageMv, "Undervoltage Cutoff", "mV", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Slow},
+    {317, 1, 317, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::DischargeOvercurrentA, "Discharge Over-current Cutoff", "A", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Slow},
+    {318, 1, 318, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::ChargeOvercurrentA, "Charge Over-current Cutoff", "A", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Slow},
+    {319, 1, 319, TinyRegisterValueType::Uint16, false, 1.0f, TinyLiveDataField::OverheatCutoffC, "Overheat Cutoff", "°C", nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Slow},
+    {500, 4, 500, TinyRegisterValueType::String, false, 1.0f, TinyLiveDataField::None, "Manufacturer Name", nullptr, nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Once},
+    {501, 2, 501, TinyRegisterValueType::Uint32, false, 1.0f, TinyLiveDataField::None, "Firmware Version", nullptr, nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Once},
+    {502, 4, 502, TinyRegisterValueType::String, false, 1.0f, TinyLiveDataField::None, "Battery Family", nullptr, nullptr, TinyRegisterDataSlice::FullWord, TinyRegisterRefreshClass::Once}
 };
 
 std::unordered_map<uint16_t, const TinyRegisterMetadata*> g_metadata_lookup;
+uint32_t g_mapping_version = 1;
 
 TinyRegisterValueType parseType(const char* value) {
     if (!value) {
@@ -125,6 +126,7 @@ std::vector<uint16_t> parseAddresses(const char* key) {
 }
 
 void rebuildLookup() {
+    g_mapping_version++;
     g_metadata_lookup.clear();
     for (const auto& meta : g_metadata) {
         for (uint16_t addr : meta.addresses) {
@@ -154,11 +156,40 @@ void rebuildLookup() {
     }
 }
 
-void addMetadataEntry(const std::string& raw_key,
-                      const std::string& name,
-                      const std::string& type,
-                      const std::string& unit,
-                      const std::string& comment) {
+// "0.5" (engineering units), "2%" (of the last reported value) or "-1" (always).
+void applyReportDeadband(const std::string& text, TinyRegisterMetadata& meta) {
+    if (text.empty()) {
+        return;
+    }
+    try {
+        size_t used = 0;
+        const float value = std::stof(text, &used);
+        meta.report_deadband = value;
+        meta.report_deadband_percent = text.find('%', used) != std::string::npos;
+    } catch (...) {
+        // Keep the default policy
+    }
+}
+
+void applyReportHeartbeat(const std::string& text, TinyRegisterMetadata& meta) {
+    if (text.empty()) {
+        return;
+    }
+    try {
+        const long value = std::stol(text);
+        if (value >= 0) {
+            meta.report_heartbeat_ms = static_cast<uint32_t>(value);
+        }
+    } catch (...) {
+        // Keep the default heartbeat
+    }
+}
+
+TinyRegisterMetadata& addMetadataEntry(const std::string& raw_key,
+                                       const std::string& name,
+                                       const std::string& type,
+                                       const std::string& unit,
+                                       const std::string& comment) {
     TinyRegisterMetadata meta;
     meta.addresses = parseAddresses(raw_key.c_str());
     if (!meta.addresses.empty()) {
@@ -172,6 +203,7 @@ void addMetadataEntry(const std::string& raw_key,
     meta.type = parseType(type.c_str());
 
     g_metadata.push_back(std::move(meta));
+    return g_metadata.back();
 }
 
 #ifdef ARDUINO
@@ -197,11 +229,23 @@ bool parseDocument(const JsonVariantConst& root, Logger* logger) {
         const char* unit = entry["tiny_scale_unit"].as<const char*>();
         const char* comment = entry["comment"].as<const char*>();
         const char* type = entry["tiny_type"].as<const char*>();
-        addMetadataEntry(kv.key().c_str(),
-                         name ? std::string(name) : std::string(),
-                         type ? std::string(type) : std::string(),
-                         unit ? std::string(unit) : std::string(),
-                         comment ? std::string(comment) : std::string());
+        TinyRegisterMetadata& meta = addMetadataEntry(kv.key().c_str(),
+                                                      name ? std::string(name) : std::string(),
+                                                      type ? std::string(type) : std::string(),
+                                                      unit ? std::string(unit) : std::string(),
+                                                      comment ? std::string(comment) : std::string());
+        JsonVariantConst deadband = entry["report_deadband"];
+        if (deadband.is<const char*>()) {
+            applyReportDeadband(deadband.as<const char*>(), meta);
+        } else if (!deadband.isNull()) {
+            meta.report_deadband = deadband.as<float>();
+        }
+        JsonVariantConst heartbeat = entry["report_heartbeat_ms"];
+        if (heartbeat.is<const char*>()) {
+            applyReportHeartbeat(heartbeat.as<const char*>(), meta);
+        } else if (!heartbeat.isNull() && heartbeat.as<long>() >= 0) {
+            meta.report_heartbeat_ms = heartbeat.as<uint32_t>();
+        }
     }
 
     rebuildLookup();
@@ -236,6 +280,32 @@ std::string extractField(const std::string& object, const char* field) {
     return object.substr(first + 1, second - first - 1);
 }
 
+// Quoted or bare value of `field` (numbers are not quoted).
+std::string extractScalar(const std::string& object, const char* field) {
+    std::string pattern = "\"" + std::string(field) + "\"";
+    size_t pos = object.find(pattern);
+    if (pos == std::string::npos) {
+        return {};
+    }
+    pos = object.find(':', pos + pattern.size());
+    if (pos == std::string::npos) {
+        return {};
+    }
+    pos = object.find_first_not_of(" \t\r\n", pos + 1);
+    if (pos == std::string::npos) {
+        return {};
+    }
+    if (object[pos] == '"') {
+        return extractField(object, field);
+    }
+    const size_t end = object.find_first_of(",}\r\n", pos);
+    std::string value = object.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+    while (!value.empty() && std::isspace(static_cast<unsigned char>(value.back()))) {
+        value.pop_back();
+    }
+    return value;
+}
+
 bool parseJsonFallback(const char* json, Logger* logger) {
     if (!json) {
         return false;
@@ -316,7 +386,9 @@ bool parseJsonFallback(const char* json, Logger* logger) {
         std::string type = extractField(object, "tiny_type");
         std::string unit = extractField(object, "tiny_scale_unit");
         std::string comment = extractField(object, "comment");
-        addMetadataEntry(key, name, type, unit, comment);
+        TinyRegisterMetadata& meta = addMetadataEntry(key, name, type, unit, comment);
+        applyReportDeadband(extractScalar(object, "report_deadband"), meta);
+        applyReportHeartbeat(extractScalar(object, "report_heartbeat_ms"), meta);
         pos = obj_end;
     }
 
@@ -409,6 +481,10 @@ const std::vector<TinyRegisterRuntimeBinding>& getTinyRegisterBindings() {
     return g_bindings;
 }
 
+uint32_t getTinyReadMappingVersion() {
+    return g_mapping_version;
+}
+
 const TinyRegisterRuntimeBinding* findTinyRegisterBinding(uint16_t address) {
     for (const auto& binding : g_bindings) {
         if (binding.metadata_address == address) {
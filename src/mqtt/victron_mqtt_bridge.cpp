@@ -88,7 +88,7 @@ uint8_t clampQos(uint8_t qos) {
 
 } // namespace
 
-using tinybms::events::MqttRegisterValue;
+using tinybms::events::RegisterCycleBatch;
 using tinybms::events::MqttRegisterEvent;
 using tinybms::events::AlarmRaised;
 using tinybms::events::AlarmCleared;
@@ -145,10 +145,20 @@ bool VictronMqttBridge::begin() {
         return true;
     }
 
-    bus_subscription_ = bus_.subscribe<MqttRegisterValue>(
-        [this](const MqttRegisterValue& event) {
-            handleRegisterEvent(event);
-        });
+    // Async: JSON serialisation and the network publish run on the event
+    // dispatcher task, not on the UART task, which never waits on a slow
+    // broker: a full queue drops its oldest batch. Batches only carry the
+    // registers that changed, so the UART task watches the bus drop counter
+    // and reports every register again after a loss. Alarms block briefly
+    // rather than drop.
+    tinybms::event::AsyncSubscriptionOptions register_queue;
+    register_queue.capacity = 4;
+    register_queue.policy = tinybms::event::QueuePolicy::DropOldest;
+    bus_subscription_ = bus_.subscribeAsync<RegisterCycleBatch>(
+        [this](const RegisterCycleBatch& batch) {
+            handleRegisterBatch(batch);
+        },
+        register_queue);
 
     if (!bus_subscription_.isActive()) {
         noteError(1, "Event bus subscription failed");
@@ -156,20 +166,28 @@ bool VictronMqttBridge::begin() {
         return false;
     }
 
-    alarm_subscription_ = bus_.subscribe<AlarmRaised>(
+    tinybms::event::AsyncSubscriptionOptions alarm_queue;
+    alarm_queue.capacity = 8;
+    alarm_queue.policy = tinybms::event::QueuePolicy::Block;
+    alarm_queue.block_timeout_ms = 20;
+
+    alarm_subscription_ = bus_.subscribeAsync<AlarmRaised>(
         [this](const AlarmRaised& event) {
             handleAlarmEvent(event);
-        });
+        },
+        alarm_queue);
 
-    alarm_cleared_subscription_ = bus_.subscribe<AlarmCleared>(
+    alarm_cleared_subscription_ = bus_.subscribeAsync<AlarmCleared>(
         [this](const AlarmCleared& event) {
             handleAlarmCleared(event);
-        });
+        },
+        alarm_queue);
 
-    warning_subscription_ = bus_.subscribe<WarningRaised>(
+    warning_subscription_ = bus_.subscribeAsync<WarningRaised>(
         [this](const WarningRaised& event) {
             handleWarningEvent(event);
-        });
+        },
+        alarm_queue);
 
     if (!alarm_subscription_.isActive() || !alarm_cleared_subscription_.isActive() || !warning_subscription_.isActive()) {
         noteError(12, "Alarm subscription failed");
@@ -618,12 +636,16 @@ void VictronMqttBridge::handleWarningEvent(const WarningRaised& event) {
     publishVictronAlarm(event.alarm, event.metadata.timestamp_ms, true);
 }
 
-void VictronMqttBridge::handleRegisterEvent(const MqttRegisterValue& event) {
+void VictronMqttBridge::handleRegisterBatch(const RegisterCycleBatch& batch) {
     if (!enabled_ || !configured_) {
         return;
     }
+    for (const auto& payload : batch) {
+        handleRegisterEvent(payload);
+    }
+}
 
-    const MqttRegisterEvent& payload = event.payload;
+void VictronMqttBridge::handleRegisterEvent(const MqttRegisterEvent& payload) {
     const TinyRegisterRuntimeBinding* binding = findTinyRegisterBinding(payload.address);
     if (!binding) {
         return;
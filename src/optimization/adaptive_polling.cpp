@@ -7,6 +7,13 @@ namespace optimization {
 namespace {
 constexpr uint32_t kMinLatencyTarget = 5;
 constexpr uint32_t kMinInterval = 5;
+// Timer granularity term of the RTO (vTaskDelay / UART timeouts tick in ms).
+constexpr uint32_t kRttGranularityUs = 1000;
+constexpr uint8_t kMaxRttBackoff = 3;
+
+uint32_t ceilMs(uint64_t us) {
+    return static_cast<uint32_t>((us + 999U) / 1000U);
+}
 }
 
 AdaptivePoller::AdaptivePoller() {
@@ -29,6 +36,12 @@ void AdaptivePoller::configure(const AdaptivePollingConfig& config) {
     latency_samples_ = 0;
     failure_streak_ = 0;
     success_streak_ = 0;
+    config_.response_timeout_min_ms = std::max<uint32_t>(1, config_.response_timeout_min_ms);
+    config_.response_timeout_max_ms = std::max(config_.response_timeout_max_ms, config_.response_timeout_min_ms);
+    config_.retry_delay_max_ms = std::max(config_.retry_delay_max_ms, config_.retry_delay_min_ms);
+    for (auto& estimate : rtt_) {
+        estimate = RttEstimate{};
+    }
 }
 
 uint32_t AdaptivePoller::currentInterval() const {
@@ -90,6 +103,82 @@ void AdaptivePoller::recordTimeout() {
     recordFailure(config_.latency_target_ms + config_.latency_slack_ms);
 }
 
+RttEstimate* AdaptivePoller::rttSlot(uint8_t command) {
+    RttEstimate* free_slot = nullptr;
+    for (auto& estimate : rtt_) {
+        if (estimate.samples > 0 || estimate.backoff > 0) {
+            if (estimate.command == command) {
+                return &estimate;
+            }
+        } else if (free_slot == nullptr) {
+            free_slot = &estimate;
+        }
+    }
+    if (free_slot != nullptr) {
+        free_slot->command = command;
+    }
+    return free_slot;
+}
+
+const RttEstimate* AdaptivePoller::rttEstimate(uint8_t command) const {
+    for (const auto& estimate : rtt_) {
+        if (estimate.samples > 0 && estimate.command == command) {
+            return &estimate;
+        }
+    }
+    return nullptr;
+}
+
+void AdaptivePoller::recordRtt(uint8_t command, uint32_t turnaround_us) {
+    RttEstimate* estimate = rttSlot(command);
+    if (estimate == nullptr) {
+        return;
+    }
+    if (estimate->samples == 0) {
+        estimate->srtt_us = turnaround_us;
+        estimate->rttvar_us = turnaround_us / 2U;
+    } else {
+        // RFC 6298: RTTVAR <- 3/4 RTTVAR + 1/4 |SRTT - R|, SRTT <- 7/8 SRTT + 1/8 R
+        const uint32_t error = (estimate->srtt_us > turnaround_us) ? estimate->srtt_us - turnaround_us
+                                                                   : turnaround_us - estimate->srtt_us;
+        estimate->rttvar_us = estimate->rttvar_us - estimate->rttvar_us / 4U + error / 4U;
+        estimate->srtt_us = estimate->srtt_us - estimate->srtt_us / 8U + turnaround_us / 8U;
+    }
+    estimate->samples++;
+    estimate->backoff = 0;
+}
+
+void AdaptivePoller::recordRttTimeout(uint8_t command) {
+    RttEstimate* estimate = rttSlot(command);
+    if (estimate != nullptr && estimate->backoff < kMaxRttBackoff) {
+        estimate->backoff++;
+    }
+}
+
+uint32_t AdaptivePoller::responseTimeoutMs(uint8_t command, size_t response_bytes) const {
+    const RttEstimate* estimate = rttEstimate(command);
+    if (!config_.adaptive_timeouts || estimate == nullptr) {
+        return config_.response_timeout_max_ms;
+    }
+    // The estimate covers the BMS turnaround only: a large 0x09 list read
+    // adds its own transfer time instead of inheriting the small reads' RTO.
+    const uint64_t rto_us = static_cast<uint64_t>(estimate->srtt_us) +
+                            std::max<uint64_t>(kRttGranularityUs, 4ULL * estimate->rttvar_us) +
+                            static_cast<uint64_t>(response_bytes) * config_.byte_time_us;
+    const uint64_t timeout_ms = static_cast<uint64_t>(ceilMs(rto_us)) << estimate->backoff;
+    return static_cast<uint32_t>(std::clamp<uint64_t>(timeout_ms,
+                                                      config_.response_timeout_min_ms,
+                                                      config_.response_timeout_max_ms));
+}
+
+uint32_t AdaptivePoller::retryDelayMs(uint8_t command) const {
+    const RttEstimate* estimate = rttEstimate(command);
+    if (!config_.adaptive_timeouts || estimate == nullptr) {
+        return config_.retry_delay_max_ms;
+    }
+    return std::clamp(ceilMs(4ULL * estimate->rttvar_us), config_.retry_delay_min_ms, config_.retry_delay_max_ms);
+}
+
 void AdaptivePoller::clampInterval() {
     if (interval_ms_ < config_.min_interval_ms) {
         interval_ms_ = config_.min_interval_ms;
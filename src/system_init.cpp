@@ -15,7 +15,9 @@
 #include "tinybms_victron_bridge.h"
 #include "tinybms_config_editor.h"
 #include "event/event_bus_v2.h"
+#include "event/event_journal.h"
 #include "event/event_types_v2.h"
+#include "event/register_value_adapter.h"
 #include "bridge_core.h"
 #include "tiny_read_mapping.h"
 #include "victron_can_mapping.h"
@@ -42,12 +44,16 @@ using tinybms::events::StatusLevel;
 using tinybms::events::StatusMessage;
 using tinybms::events::LiveDataUpdate;
 extern mqtt::VictronMqttBridge mqttBridge;
+extern tinybms::event::EventJournal eventJournal;
 
 extern TaskHandle_t webServerTaskHandle;
 extern TaskHandle_t websocketTaskHandle;
 extern TaskHandle_t watchdogTaskHandle;
 extern TaskHandle_t mqttTaskHandle;
 
+// Splits RegisterCycleBatch into MqttRegisterValue for single-register subscribers.
+static tinybms::event::RegisterValueAdapter registerValueAdapter(eventBus);
+
 hal::HalConfig buildHalConfig(const ConfigManager& cfg) {
     hal::HalConfig hal_cfg{};
     hal_cfg.uart.rx_pin = cfg.hardware.uart.rx_pin;
@@ -107,6 +113,16 @@ bool createTask(const char* name,
     return true;
 }
 
+// Runs the callbacks of async Event Bus subscriptions (MQTT bridge, event
+// journal) and writes the journal's buffered records once they are due.
+void eventDispatchTask(void* pvParameters) {
+    auto* bus = static_cast<tinybms::event::EventBusV2*>(pvParameters);
+    while (true) {
+        bus->dispatchPending(100);
+        eventJournal.flushIfDue(millis());
+    }
+}
+
 void mqttLoopTask(void* pvParameters) {
     auto* client = static_cast<mqtt::VictronMqttBridge*>(pvParameters);
     const TickType_t delay = pdMS_TO_TICKS(1000);
@@ -390,8 +406,27 @@ bool initializeSystem() {
     }
 
     eventBus.resetStats();
-    const bool event_bus_ok = true;
-    logger.log(LOG_INFO, "[EVENT_BUS] Ready ✓");
+    registerValueAdapter.begin();
+    bool journal_ok = false;
+    if (hal::HalManager::instance().isInitialized()) {
+        journal_ok = eventJournal.begin(hal::HalManager::instance().storage(), millis());
+    }
+    if (journal_ok) {
+        logger.log(LOG_INFO, String("[JOURNAL] Ready, next sequence ") + eventJournal.stats().next_sequence);
+    } else {
+        logger.log(LOG_WARN, "[JOURNAL] Storage unavailable, events not persisted");
+    }
+    // Larger stack: the MQTT bridge serialises JSON in its async callbacks.
+    const bool event_bus_ok = createTask(
+        "EventDispatch",
+        eventDispatchTask,
+        TASK_DEFAULT_STACK_SIZE + 2048,
+        &eventBus,
+        TASK_NORMAL_PRIORITY,
+        nullptr
+    );
+    overall_ok &= event_bus_ok;
+    logger.log(LOG_INFO, event_bus_ok ? "[EVENT_BUS] Ready ✓" : "[EVENT_BUS] Dispatcher task failed");
     publishStatusIfPossible("Event bus ready", StatusLevel::Notice);
     publishStatusIfPossible(spiffs_ok ? "SPIFFS mounted" : "SPIFFS unavailable",
                             spiffs_ok ? StatusLevel::Notice : StatusLevel::Error);
@@ -197,6 +197,7 @@ TinyBMSConfigError TinyBMSConfigEditor::writeRegisterRaw(uint16_t address, uint1
         CONFIG_LOG(LOG_ERROR, "TinyBMS write failed for register " + String(address));
         return TinyBMSConfigError::WriteFailed;
     }
+    bridge.requestTinyRegisterRefresh(address);
 
     float user_value = convertRawToUser(reg, value);
     reg.current_raw_value = value;
@@ -0,0 +1,319 @@
+#include "uart/tinybms_broadcast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_read_planner.h"
+
+namespace tinybms {
+namespace {
+
+// TinyBMS Communication Protocols Rev D, §1.1: live-data replies, also sent
+// unsolicited when a broadcast interval is configured. Data is LSB first.
+constexpr uint8_t CMD_PACK_VOLTAGE = 0x14;     // FLOAT, V
+constexpr uint8_t CMD_PACK_CURRENT = 0x15;     // FLOAT, A
+constexpr uint8_t CMD_MAX_CELL_VOLTAGE = 0x16; // UINT16, mV
+constexpr uint8_t CMD_MIN_CELL_VOLTAGE = 0x17; // UINT16, mV
+constexpr uint8_t CMD_ONLINE_STATUS = 0x18;    // UINT16
+constexpr uint8_t CMD_LIFETIME = 0x19;         // UINT32, s
+constexpr uint8_t CMD_ESTIMATED_SOC = 0x1A;    // UINT32, 0.000001 %
+constexpr uint8_t CMD_TEMPERATURES = 0x1B;     // PL + 3 x INT16, 0.1 °C (internal, ext #1, ext #2)
+constexpr uint8_t CMD_CELL_VOLTAGES = 0x1C;    // PL + N x UINT16, 0.1 mV (cell 1..N)
+
+constexpr FrameParser::FrameLayout kLayouts[] = {
+    {CMD_PACK_VOLTAGE, 4},
+    {CMD_PACK_CURRENT, 4},
+    {CMD_MAX_CELL_VOLTAGE, 2},
+    {CMD_MIN_CELL_VOLTAGE, 2},
+    {CMD_ONLINE_STATUS, 2},
+    {CMD_LIFETIME, 4},
+    {CMD_ESTIMATED_SOC, 4},
+    {CMD_TEMPERATURES, 0},
+    {CMD_CELL_VOLTAGES, 0},
+};
+constexpr size_t kLayoutCount = sizeof(kLayouts) / sizeof(kLayouts[0]);
+
+constexpr uint16_t kRegLifetime = 32;
+constexpr uint16_t kRegPackVoltage = 36;
+constexpr uint16_t kRegPackCurrent = 38;
+constexpr uint16_t kRegMinCell = 40;
+constexpr uint16_t kRegMaxCell = 41;
+constexpr uint16_t kRegExternalTemp1 = 42;
+constexpr uint16_t kRegExternalTemp2 = 43;
+constexpr uint16_t kRegSoc = 46;
+constexpr uint16_t kRegInternalTemp = 48;
+constexpr uint16_t kRegOnlineStatus = 50;
+constexpr uint16_t kRegFirstCell = 0;
+
+// A source stays current for 2.5 periods; before its period is known, for
+// kFirstFrameGraceMs after the first frame.
+constexpr uint32_t kFirstFrameGraceMs = 1500;
+constexpr uint32_t kMinStaleMs = 300;
+
+uint16_t readU16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (static_cast<uint16_t>(p[1]) << 8));
+}
+
+uint32_t readU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) |
+           (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
+}
+
+float readF32(const uint8_t* p) {
+    const uint32_t bits = readU32(p);
+    float value = 0.0f;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Encode a physical value as the register word the mapping decodes,
+ *        i.e. using the binding's scale and signedness.
+ */
+bool encodeScaled(uint16_t address, double physical, uint16_t& word) {
+    const TinyRegisterRuntimeBinding* binding = findTinyRegisterBinding(address);
+    if (binding == nullptr || binding->scale == 0.0f || !std::isfinite(physical)) {
+        return false;
+    }
+    const double raw = std::round(physical / static_cast<double>(binding->scale));
+    if (binding->is_signed) {
+        const double clamped = std::min(32767.0, std::max(-32768.0, raw));
+        word = static_cast<uint16_t>(static_cast<int16_t>(clamped));
+    } else {
+        word = static_cast<uint16_t>(std::min(65535.0, std::max(0.0, raw)));
+    }
+    return true;
+}
+
+class WordWriter {
+public:
+    WordWriter(RegisterWord* out, size_t capacity) : out_(out), capacity_(capacity) {}
+
+    void put(uint16_t address, uint16_t value) {
+        if (count_ < capacity_) {
+            out_[count_].address = address;
+            out_[count_].value = value;
+            ++count_;
+        }
+    }
+
+    void putScaled(uint16_t address, double physical) {
+        uint16_t word = 0;
+        if (encodeScaled(address, physical, word)) {
+            put(address, word);
+        }
+    }
+
+    size_t count() const { return count_; }
+
+private:
+    RegisterWord* out_;
+    size_t capacity_;
+    size_t count_ = 0;
+};
+
+} // namespace
+
+const FrameParser::FrameLayout* broadcastFrameLayouts(size_t& count) {
+    count = kLayoutCount;
+    return kLayouts;
+}
+
+size_t decodeBroadcastFrame(const FrameView& frame, RegisterWord* out, size_t capacity) {
+    if (frame.data == nullptr || frame.length < 3 || out == nullptr) {
+        return 0;
+    }
+
+    const uint8_t command = frame.data[1];
+    const uint8_t* body = frame.data + 2;
+    size_t body_length = frame.length - 2;
+    if (command == CMD_TEMPERATURES || command == CMD_CELL_VOLTAGES) {
+        body_length = frame.data[2];
+        body = frame.data + 3;
+        if (frame.length != 3 + body_length) {
+            return 0;
+        }
+    }
+
+    WordWriter writer(out, capacity);
+    switch (command) {
+        case CMD_PACK_VOLTAGE:
+            if (body_length == 4) writer.putScaled(kRegPackVoltage, readF32(body));
+            break;
+        case CMD_PACK_CURRENT:
+            if (body_length == 4) writer.putScaled(kRegPackCurrent, readF32(body));
+            break;
+        case CMD_MAX_CELL_VOLTAGE:
+            if (body_length == 2) writer.put(kRegMaxCell, readU16(body));
+            break;
+        case CMD_MIN_CELL_VOLTAGE:
+            if (body_length == 2) writer.put(kRegMinCell, readU16(body));
+            break;
+        case CMD_ONLINE_STATUS:
+            if (body_length == 2) writer.put(kRegOnlineStatus, readU16(body));
+            break;
+        case CMD_LIFETIME:
+            if (body_length == 4) {
+                writer.put(kRegLifetime, readU16(body));                              // low word first
+                writer.put(static_cast<uint16_t>(kRegLifetime + 1), readU16(body + 2));
+            }
+            break;
+        case CMD_ESTIMATED_SOC:
+            if (body_length == 4) writer.putScaled(kRegSoc, static_cast<double>(readU32(body)) * 1e-6);
+            break;
+        case CMD_TEMPERATURES:
+            if (body_length == 6) {
+                writer.put(kRegInternalTemp, readU16(body));
+                writer.put(kRegExternalTemp1, readU16(body + 2));
+                writer.put(kRegExternalTemp2, readU16(body + 4));
+            }
+            break;
+        case CMD_CELL_VOLTAGES:
+            for (size_t i = 0; i + 1 < body_length; i += 2) {
+                writer.put(static_cast<uint16_t>(kRegFirstCell + i / 2), readU16(body + i));
+            }
+            break;
+        default:
+            break;
+    }
+    return writer.count();
+}
+
+// ---------------------------------------------------------------------------
+// BroadcastListener
+// ---------------------------------------------------------------------------
+BroadcastListener::BroadcastListener() {
+    expectation_.extra_layouts = broadcastFrameLayouts(expectation_.extra_layout_count);
+    sources_.resize(kLayoutCount);
+    for (size_t i = 0; i < kLayoutCount; ++i) {
+        sources_[i].command = kLayouts[i].command;
+    }
+    pending_.reserve(kBroadcastMaxWords * 2);
+    parser_.reset(expectation_);
+}
+
+void BroadcastListener::reset() {
+    parser_.reset(expectation_);
+    parser_.resetStats();
+    for (auto& source : sources_) {
+        const uint8_t command = source.command;
+        source = Source{};
+        source.command = command;
+    }
+    pending_.clear();
+    stats_ = BroadcastStats{};
+}
+
+void BroadcastListener::feed(const uint8_t* data, size_t length, uint32_t now_ms) {
+    size_t offset = 0;
+    while (offset < length) {
+        offset += parser_.feed(data + offset, length - offset);
+        while (parser_.frameReady()) {
+            handleFrame(now_ms);
+            parser_.consumeFrame();
+        }
+    }
+}
+
+void BroadcastListener::handleFrame(uint32_t now_ms) {
+    const FrameView frame = parser_.frame();
+    std::array<RegisterWord, kBroadcastMaxWords> words{};
+    const size_t count = decodeBroadcastFrame(frame, words.data(), words.size());
+    if (count == 0) {
+        stats_.ignored_frames++;
+        return;
+    }
+
+    auto it = std::find_if(sources_.begin(), sources_.end(),
+                           [&frame](const Source& source) { return source.command == frame.data[1]; });
+    if (it == sources_.end()) {
+        stats_.ignored_frames++;
+        return;
+    }
+
+    Source& source = *it;
+    if (source.seen) {
+        const uint32_t interval = now_ms - source.last_ms;
+        // Smooth the period so one late frame does not drop coverage.
+        source.period_ms = (source.period_ms == 0) ? interval : (source.period_ms * 3U + interval) / 4U;
+    }
+    source.seen = true;
+    source.last_ms = now_ms;
+    source.address_count = static_cast<uint8_t>(count);
+    for (size_t i = 0; i < count; ++i) {
+        source.addresses[i] = words[i].address;
+        // Keep only the newest value per address until the poll task drains.
+        auto pending = std::find_if(pending_.begin(), pending_.end(), [&](const RegisterWord& word) {
+            return word.address == words[i].address;
+        });
+        if (pending != pending_.end()) {
+            pending->value = words[i].value;
+        } else {
+            pending_.push_back(words[i]);
+        }
+    }
+
+    stats_.frames++;
+    stats_.words += static_cast<uint32_t>(count);
+    stats_.last_frame_ms = now_ms;
+}
+
+uint8_t BroadcastListener::takeUpdates(RegisterStore& registers) {
+    uint8_t mask = 0;
+    if (pending_.empty()) {
+        return mask;
+    }
+    for (const auto& word : pending_) {
+        registers.set(word.address, word.value);
+    }
+    for (const auto& binding : getTinyRegisterBindings()) {
+        const uint8_t words = binding.register_count == 0 ? 1 : binding.register_count;
+        for (const auto& word : pending_) {
+            if (word.address >= binding.register_address &&
+                static_cast<uint32_t>(word.address) < static_cast<uint32_t>(binding.register_address) + words) {
+                mask |= refreshClassBit(binding.refresh_class);
+                break;
+            }
+        }
+    }
+    pending_.clear();
+    return mask;
+}
+
+bool BroadcastListener::isCurrent(const Source& source, uint32_t now_ms) const {
+    if (!source.seen) {
+        return false;
+    }
+    const uint32_t limit = (source.period_ms == 0)
+        ? kFirstFrameGraceMs
+        : std::max(kMinStaleMs, source.period_ms * 5U / 2U);
+    return now_ms - source.last_ms <= limit;
+}
+
+std::vector<uint16_t> BroadcastListener::coveredAddresses(uint32_t now_ms) const {
+    std::vector<uint16_t> addresses;
+    for (const auto& source : sources_) {
+        if (isCurrent(source, now_ms)) {
+            addresses.insert(addresses.end(), source.addresses.begin(),
+                             source.addresses.begin() + source.address_count);
+        }
+    }
+    std::sort(addresses.begin(), addresses.end());
+    addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+    return addresses;
+}
+
+bool BroadcastListener::active(uint32_t now_ms) const {
+    for (const auto& source : sources_) {
+        if (isCurrent(source, now_ms)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace tinybms
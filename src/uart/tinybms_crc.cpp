@@ -0,0 +1,94 @@
+#include "uart/tinybms_crc.h"
+
+namespace tinybms::crc {
+namespace {
+
+using SliceTables = std::array<std::array<uint16_t, 256>, 8>;
+
+// Table k advances a byte through k additional zero bytes, which lets
+// slice-by-N fold N input bytes with N independent lookups.
+constexpr SliceTables makeSliceTables() {
+    SliceTables tables{};
+    tables[0] = kModbusTable;
+    for (size_t k = 1; k < tables.size(); ++k) {
+        for (size_t i = 0; i < 256; ++i) {
+            const uint16_t prev = tables[k - 1][i];
+            tables[k][i] = static_cast<uint16_t>((prev >> 8) ^ kModbusTable[prev & 0xFFu]);
+        }
+    }
+    return tables;
+}
+
+constexpr SliceTables kSliceTables = makeSliceTables();
+
+uint16_t updateBytewise(uint16_t crc, const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        crc = updateByte(crc, data[i]);
+    }
+    return crc;
+}
+
+uint16_t updateSlice4(uint16_t crc, const uint8_t* data, size_t length) {
+    while (length >= 4) {
+        crc ^= static_cast<uint16_t>(data[0] | (static_cast<uint16_t>(data[1]) << 8));
+        crc = static_cast<uint16_t>(kSliceTables[3][crc & 0xFFu] ^
+                                    kSliceTables[2][crc >> 8] ^
+                                    kSliceTables[1][data[2]] ^
+                                    kSliceTables[0][data[3]]);
+        data += 4;
+        length -= 4;
+    }
+    return updateBytewise(crc, data, length);
+}
+
+uint16_t updateSlice8(uint16_t crc, const uint8_t* data, size_t length) {
+    while (length >= 8) {
+        crc ^= static_cast<uint16_t>(data[0] | (static_cast<uint16_t>(data[1]) << 8));
+        crc = static_cast<uint16_t>(kSliceTables[7][crc & 0xFFu] ^
+                                    kSliceTables[6][crc >> 8] ^
+                                    kSliceTables[5][data[2]] ^
+                                    kSliceTables[4][data[3]] ^
+                                    kSliceTables[3][data[4]] ^
+                                    kSliceTables[2][data[5]] ^
+                                    kSliceTables[1][data[6]] ^
+                                    kSliceTables[0][data[7]]);
+        data += 8;
+        length -= 8;
+    }
+    return updateSlice4(crc, data, length);
+}
+
+} // namespace
+
+uint16_t update(uint16_t state, const uint8_t* data, size_t length, Crc16Mode mode) {
+    if (data == nullptr || length == 0) {
+        return state;
+    }
+
+    switch (mode) {
+        case Crc16Mode::SliceBy8:
+            return updateSlice8(state, data, length);
+        case Crc16Mode::SliceBy4:
+            return updateSlice4(state, data, length);
+        case Crc16Mode::Bytewise:
+        default:
+            return updateBytewise(state, data, length);
+    }
+}
+
+uint16_t computeBitwise(const uint8_t* data, size_t length) {
+    uint16_t crc = kModbusInitialState;
+    for (size_t i = 0; i < length; ++i) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            if (crc & 0x0001) {
+                crc = static_cast<uint16_t>((crc >> 1) ^ kModbusPolynomial);
+            } else {
+                crc >>= 1;
+            }
+        }
+    }
+    return crc;
+}
+
+} // namespace tinybms::crc
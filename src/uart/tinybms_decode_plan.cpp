@@ -0,0 +1,285 @@
+#include "uart/tinybms_decode_plan.h"
+
+#include <algorithm>
+#include <array>
+
+#include "uart/tinybms_decoder.h"
+#include "uart/tinybms_read_planner.h"
+
+namespace tinybms {
+namespace {
+
+constexpr size_t kFieldCount = static_cast<size_t>(TinyLiveDataField::OverheatCutoffC) + 1;
+
+LiveFieldDestination scaledTo(float TinyBMS_LiveData::*member) {
+    LiveFieldDestination destination;
+    destination.write = LiveFieldWrite::Scaled;
+    destination.scaled = member;
+    return destination;
+}
+
+LiveFieldDestination scaledWithRawTo(float TinyBMS_LiveData::*member, uint16_t TinyBMS_LiveData::*raw) {
+    LiveFieldDestination destination = scaledTo(member);
+    destination.write = LiveFieldWrite::ScaledWithRaw;
+    destination.raw = raw;
+    return destination;
+}
+
+LiveFieldDestination rawTo(uint16_t TinyBMS_LiveData::*member) {
+    LiveFieldDestination destination;
+    destination.write = LiveFieldWrite::Raw;
+    destination.raw = member;
+    return destination;
+}
+
+LiveFieldDestination signedRawTo(int16_t TinyBMS_LiveData::*member, LiveFieldWrite write = LiveFieldWrite::SignedRaw) {
+    LiveFieldDestination destination;
+    destination.write = write;
+    destination.signed_raw = member;
+    return destination;
+}
+
+// Same destinations as TinyBMS_LiveData::applyField().
+std::array<LiveFieldDestination, kFieldCount> buildDestinations() {
+    using Field = TinyLiveDataField;
+    std::array<LiveFieldDestination, kFieldCount> table{};
+    auto at = [&table](Field field) -> LiveFieldDestination& { return table[static_cast<size_t>(field)]; };
+    at(Field::Voltage) = scaledTo(&TinyBMS_LiveData::voltage);
+    at(Field::Current) = scaledTo(&TinyBMS_LiveData::current);
+    at(Field::SocPercent) = scaledWithRawTo(&TinyBMS_LiveData::soc_percent, &TinyBMS_LiveData::soc_raw);
+    at(Field::SohPercent) = scaledWithRawTo(&TinyBMS_LiveData::soh_percent, &TinyBMS_LiveData::soh_raw);
+    at(Field::Temperature) = signedRawTo(&TinyBMS_LiveData::temperature);
+    at(Field::PackMinTemperature) = signedRawTo(&TinyBMS_LiveData::pack_temp_min, LiveFieldWrite::PackTemperatures);
+    at(Field::PackMaxTemperature) = signedRawTo(&TinyBMS_LiveData::pack_temp_max, LiveFieldWrite::SignedRawTenths);
+    at(Field::MinCellMv) = rawTo(&TinyBMS_LiveData::min_cell_mv);
+    at(Field::MaxCellMv) = rawTo(&TinyBMS_LiveData::max_cell_mv);
+    at(Field::BalancingBits) = rawTo(&TinyBMS_LiveData::balancing_bits);
+    at(Field::MaxChargeCurrent) = rawTo(&TinyBMS_LiveData::max_charge_current);
+    at(Field::MaxDischargeCurrent) = rawTo(&TinyBMS_LiveData::max_discharge_current);
+    at(Field::OnlineStatus) = rawTo(&TinyBMS_LiveData::online_status);
+    at(Field::CellImbalanceMv) = rawTo(&TinyBMS_LiveData::cell_imbalance_mv);
+    at(Field::CellOvervoltageMv) = rawTo(&TinyBMS_LiveData::cell_overvoltage_mv);
+    at(Field::CellUndervoltageMv) = rawTo(&TinyBMS_LiveData::cell_undervoltage_mv);
+    at(Field::DischargeOvercurrentA) = rawTo(&TinyBMS_LiveData::discharge_overcurrent_a);
+    at(Field::ChargeOvercurrentA) = rawTo(&TinyBMS_LiveData::charge_overcurrent_a);
+    at(Field::OverheatCutoffC) = rawTo(&TinyBMS_LiveData::overheat_cutoff_c);
+    return table;   // NeedBalancing (reserved) and None stay unwritten
+}
+
+DecodeKind decodeKindFor(const TinyRegisterRuntimeBinding& binding, uint8_t word_count) {
+    if (binding.value_type == TinyRegisterValueType::String) {
+        return DecodeKind::None;
+    }
+    if (binding.value_type == TinyRegisterValueType::Uint32 && word_count >= 2) {
+        return DecodeKind::Uint32;
+    }
+    if (binding.data_slice == TinyRegisterDataSlice::LowByte) {
+        return binding.is_signed ? DecodeKind::SignedLowByte : DecodeKind::LowByte;
+    }
+    if (binding.data_slice == TinyRegisterDataSlice::HighByte) {
+        return binding.is_signed ? DecodeKind::SignedHighByte : DecodeKind::HighByte;
+    }
+    return binding.is_signed ? DecodeKind::Int16 : DecodeKind::Uint16;
+}
+
+DecodeTextKind textKindFor(const TinyRegisterRuntimeBinding& binding, uint8_t word_count) {
+    if (binding.value_type == TinyRegisterValueType::String) {
+        return DecodeTextKind::Chars;
+    }
+    if (binding.metadata_address == 501 && word_count >= 2) {
+        return DecodeTextKind::Version;
+    }
+    return DecodeTextKind::None;
+}
+
+int32_t rawValueOf(DecodeKind kind, const uint16_t* words) {
+    switch (kind) {
+        case DecodeKind::Uint16:
+            return static_cast<int32_t>(words[0]);
+        case DecodeKind::Int16:
+            return static_cast<int32_t>(static_cast<int16_t>(words[0]));
+        case DecodeKind::LowByte:
+            return static_cast<int32_t>(words[0] & 0x00FFu);
+        case DecodeKind::SignedLowByte:
+            return static_cast<int32_t>(static_cast<int8_t>(words[0] & 0x00FFu));
+        case DecodeKind::HighByte:
+            return static_cast<int32_t>((words[0] >> 8) & 0x00FFu);
+        case DecodeKind::SignedHighByte:
+            return static_cast<int32_t>(static_cast<int8_t>((words[0] >> 8) & 0x00FFu));
+        case DecodeKind::Uint32:
+            return static_cast<int32_t>((static_cast<uint32_t>(words[1]) << 16) | words[0]);
+        case DecodeKind::None:
+        default:
+            return 0;
+    }
+}
+
+void writeField(const LiveFieldDestination& destination,
+                int32_t raw_value,
+                float scaled_value,
+                const uint16_t* words,
+                TinyBMS_LiveData& live) {
+    switch (destination.write) {
+        case LiveFieldWrite::Scaled:
+            live.*destination.scaled = scaled_value;
+            break;
+        case LiveFieldWrite::ScaledWithRaw:
+            live.*destination.scaled = scaled_value;
+            live.*destination.raw = static_cast<uint16_t>(raw_value);
+            break;
+        case LiveFieldWrite::Raw:
+            live.*destination.raw = static_cast<uint16_t>(raw_value);
+            break;
+        case LiveFieldWrite::SignedRaw:
+            live.*destination.signed_raw = static_cast<int16_t>(raw_value);
+            break;
+        case LiveFieldWrite::SignedRawTenths:
+            live.*destination.signed_raw = static_cast<int16_t>(raw_value * 10);
+            break;
+        case LiveFieldWrite::PackTemperatures:
+            live.pack_temp_min = static_cast<int16_t>(raw_value * 10);
+            live.pack_temp_max = static_cast<int16_t>(static_cast<int8_t>((words[0] >> 8) & 0xFFu) * 10);
+            break;
+        case LiveFieldWrite::None:
+        default:
+            break;
+    }
+}
+
+// Shared body of both DecodePlan::apply() overloads. `next_event()` returns
+// the event to fill, or nullptr when there is no room (or no output).
+template <typename NextEvent>
+size_t decodeSteps(const std::vector<DecodeStep>& steps,
+                   uint32_t generation,
+                   const RegisterStore& store,
+                   TinyBMS_LiveData& live,
+                   uint32_t timestamp_ms,
+                   uint8_t event_class_mask,
+                   ReportFilter* filter,
+                   NextEvent&& next_event) {
+    const uint16_t* words = store.words();
+    if (filter != nullptr) {
+        filter->bind(generation, steps.size());
+    }
+    size_t decoded = 0;
+    for (size_t index = 0; index < steps.size(); ++index) {
+        const DecodeStep& step = steps[index];
+        if (!store.slotsValid(step.slot, step.slot_count)) {
+            continue;
+        }
+        // The binding's words are contiguous in the store: read them in place.
+        const uint16_t* raw_words = words + step.slot;
+        const int32_t raw_value = rawValueOf(step.kind, raw_words);
+        const float scaled_value = static_cast<float>(raw_value) * step.scale;
+        writeField(step.destination, raw_value, scaled_value, raw_words, live);
+
+        TinyRegisterText text_value;
+        text_value.clear();
+        if (step.text == DecodeTextKind::Chars) {
+            uart::detail::registerCharsText(raw_words, step.word_count, text_value);
+        } else if (step.text == DecodeTextKind::Version) {
+            uart::detail::registerVersionText(raw_words, text_value);
+        }
+        const TinyRegisterText* text_ptr = (text_value.length() > 0) ? &text_value : nullptr;
+        live.appendSnapshot(step.snapshot_address, step.value_type, raw_value, step.slot_count, text_ptr, raw_words);
+
+        if ((step.refresh_bit & event_class_mask) != 0 &&
+            (filter == nullptr ||
+             filter->admit(index, step.report, scaled_value, raw_words, step.word_count, timestamp_ms))) {
+            // The filter only remembers values whose event was accepted: an
+            // overflowed entry is reported again on the next refresh.
+            if (events::MqttRegisterEvent* event = next_event()) {
+                uart::detail::populateMqttEvent(step.event_address, step.value_type, raw_value, raw_words,
+                                                step.word_count, timestamp_ms, text_ptr, *event);
+                if (filter != nullptr) {
+                    filter->commit(index, scaled_value, raw_words, step.word_count, timestamp_ms);
+                }
+            } else if (filter != nullptr) {
+                filter->forceNext(index);
+            }
+        }
+        decoded++;
+    }
+    return decoded;
+}
+
+} // namespace
+
+const LiveFieldDestination& liveFieldDestination(TinyLiveDataField field) {
+    static const std::array<LiveFieldDestination, kFieldCount> table = buildDestinations();
+    static const LiveFieldDestination none{};
+    const size_t index = static_cast<size_t>(field);
+    return index < table.size() ? table[index] : none;
+}
+
+void DecodePlan::compile(const std::vector<TinyRegisterRuntimeBinding>& bindings, const RegisterStore& store) {
+    steps_.clear();
+    steps_.reserve(bindings.size());
+    for (const auto& binding : bindings) {
+        if (binding.register_count == 0) {
+            continue;
+        }
+        const size_t slot = store.slotOf(binding.register_address);
+        const uint16_t last_address = static_cast<uint16_t>(binding.register_address + binding.register_count - 1U);
+        // Multi-word bindings must sit in one window (consecutive slots).
+        if (slot == RegisterStore::kNoSlot || store.slotOf(last_address) != slot + binding.register_count - 1U) {
+            continue;
+        }
+
+        DecodeStep step;
+        step.slot = static_cast<uint16_t>(slot);
+        step.slot_count = binding.register_count;
+        step.word_count = std::min<uint8_t>(binding.register_count, static_cast<uint8_t>(TINY_REGISTER_MAX_WORDS));
+        step.kind = decodeKindFor(binding, step.word_count);
+        step.text = textKindFor(binding, step.word_count);
+        step.scale = binding.scale;
+        step.destination = liveFieldDestination(binding.live_field);
+        step.snapshot_address = binding.metadata_address;
+        step.event_address = (binding.metadata_address != 0) ? binding.metadata_address : binding.register_address;
+        step.value_type = binding.value_type;
+        step.refresh_bit = refreshClassBit(binding.refresh_class);
+        step.report = reportPolicyFor(binding);
+        steps_.push_back(step);
+    }
+    layout_generation_ = store.layoutGeneration();
+    generation_++;
+}
+
+bool DecodePlan::ensureCompiled(const std::vector<TinyRegisterRuntimeBinding>& bindings, const RegisterStore& store) {
+    if (store.layoutGeneration() == layout_generation_) {
+        return false;
+    }
+    compile(bindings, store);
+    return true;
+}
+
+size_t DecodePlan::apply(const RegisterStore& store,
+                         TinyBMS_LiveData& live,
+                         uint32_t timestamp_ms,
+                         uint8_t event_class_mask,
+                         std::vector<events::MqttRegisterEvent>* events,
+                         ReportFilter* filter) const {
+    if (events == nullptr) {
+        event_class_mask = 0;
+    }
+    return decodeSteps(steps_, generation_, store, live, timestamp_ms, event_class_mask, filter,
+                       [events]() -> events::MqttRegisterEvent* {
+                           events->emplace_back();
+                           return &events->back();
+                       });
+}
+
+size_t DecodePlan::apply(const RegisterStore& store,
+                         TinyBMS_LiveData& live,
+                         uint32_t timestamp_ms,
+                         uint8_t event_class_mask,
+                         events::RegisterCycleBatch* batch,
+                         ReportFilter* filter) const {
+    if (batch == nullptr) {
+        event_class_mask = 0;
+    }
+    return decodeSteps(steps_, generation_, store, live, timestamp_ms, event_class_mask, filter,
+                       [batch]() { return batch->append(); });
+}
+
+} // namespace tinybms
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdio>
 #include <cstring>
 
 using tinybms::events::MqttRegisterEvent;
@@ -11,8 +12,9 @@ namespace {
 
 constexpr uint8_t kMaxCopyWords = static_cast<uint8_t>(TINY_REGISTER_MAX_WORDS);
 
+template <typename Lookup>
 bool collectWords(const TinyRegisterRuntimeBinding& binding,
-                  const std::map<uint16_t, uint16_t>& register_values,
+                  Lookup&& lookup,
                   std::array<uint16_t, TINY_REGISTER_MAX_WORDS>& out,
                   uint8_t& word_count) {
     if (binding.register_count == 0) {
@@ -23,12 +25,12 @@ bool collectWords(const TinyRegisterRuntimeBinding& binding,
     word_count = std::min<uint8_t>(binding.register_count, kMaxCopyWords);
     for (uint8_t idx = 0; idx < binding.register_count; ++idx) {
         const uint16_t address = static_cast<uint16_t>(binding.register_address + idx);
-        auto it = register_values.find(address);
-        if (it == register_values.end()) {
+        uint16_t value = 0;
+        if (!lookup(address, value)) {
             return false;
         }
         if (idx < word_count) {
-            out[idx] = it->second;
+            out[idx] = value;
         }
     }
 
@@ -70,42 +72,110 @@ int32_t computeRawValue(const TinyRegisterRuntimeBinding& binding,
     return static_cast<int32_t>(words[0]);
 }
 
-String buildTextValue(const TinyRegisterRuntimeBinding& binding,
-                      const std::array<uint16_t, TINY_REGISTER_MAX_WORDS>& words,
-                      uint8_t word_count) {
-    String text_value;
-
+void buildTextValue(const TinyRegisterRuntimeBinding& binding,
+                    const std::array<uint16_t, TINY_REGISTER_MAX_WORDS>& words,
+                    uint8_t word_count,
+                    TinyRegisterText& out) {
     if (binding.value_type == TinyRegisterValueType::String) {
-        text_value.reserve(static_cast<size_t>(word_count) * 2U);
-        for (uint8_t idx = 0; idx < word_count; ++idx) {
-            const char high = static_cast<char>((words[idx] >> 8) & 0xFF);
-            const char low = static_cast<char>(words[idx] & 0xFF);
-            if (high != '\0') {
-                text_value += high;
-            }
-            if (low != '\0') {
-                text_value += low;
-            }
-        }
+        registerCharsText(words.data(), word_count, out);
     } else if (binding.metadata_address == 501 && word_count >= 2) {
-        const uint16_t major = words[0];
-        const uint16_t minor = words[1];
-        text_value = String(major) + "." + String(minor);
+        registerVersionText(words.data(), out);
+    } else {
+        out.clear();
+    }
+}
+
+template <typename Lookup>
+bool decodeWords(const TinyRegisterRuntimeBinding& binding,
+                 Lookup&& lookup,
+                 TinyBMS_LiveData& live_data,
+                 uint32_t timestamp_ms,
+                 MqttRegisterEvent* mqtt_event_out) {
+    std::array<uint16_t, TINY_REGISTER_MAX_WORDS> raw_words{};
+    uint8_t word_count = 0;
+
+    if (!collectWords(binding, lookup, raw_words, word_count)) {
+        return false;
+    }
+
+    const int32_t raw_value = computeRawValue(binding, raw_words, word_count);
+    const float scaled_value = static_cast<float>(raw_value) * binding.scale;
+    TinyRegisterText text_value;
+    buildTextValue(binding, raw_words, word_count, text_value);
+    const TinyRegisterText* text_ptr = (text_value.length() > 0) ? &text_value : nullptr;
+
+    live_data.applyBinding(binding, raw_value, scaled_value, text_ptr, raw_words.data());
+
+    if (mqtt_event_out != nullptr) {
+        const uint16_t address = (binding.metadata_address != 0) ? binding.metadata_address : binding.register_address;
+        populateMqttEvent(address, binding.value_type, raw_value, raw_words.data(), word_count, timestamp_ms,
+                          text_ptr, *mqtt_event_out);
     }
 
-    return text_value;
+    return true;
+}
+
+} // namespace
+
+bool decodeAndApplyBinding(const TinyRegisterRuntimeBinding& binding,
+                           const RegisterStore& register_values,
+                           TinyBMS_LiveData& live_data,
+                           uint32_t timestamp_ms,
+                           MqttRegisterEvent* mqtt_event_out) {
+    auto lookup = [&register_values](uint16_t address, uint16_t& value) {
+        return register_values.get(address, value);
+    };
+    return decodeWords(binding, lookup, live_data, timestamp_ms, mqtt_event_out);
 }
 
-void populateMqttEvent(const TinyRegisterRuntimeBinding& binding,
+bool decodeAndApplyBinding(const TinyRegisterRuntimeBinding& binding,
+                           const std::map<uint16_t, uint16_t>& register_values,
+                           TinyBMS_LiveData& live_data,
+                           uint32_t timestamp_ms,
+                           MqttRegisterEvent* mqtt_event_out) {
+    auto lookup = [&register_values](uint16_t address, uint16_t& value) {
+        auto it = register_values.find(address);
+        if (it == register_values.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    };
+    return decodeWords(binding, lookup, live_data, timestamp_ms, mqtt_event_out);
+}
+
+void registerCharsText(const uint16_t* words, uint8_t word_count, TinyRegisterText& out) {
+    out.clear();
+    for (uint8_t idx = 0; idx < word_count; ++idx) {
+        const char high = static_cast<char>((words[idx] >> 8) & 0xFF);
+        const char low = static_cast<char>(words[idx] & 0xFF);
+        if (high != '\0') {
+            out.append(high);
+        }
+        if (low != '\0') {
+            out.append(low);
+        }
+    }
+}
+
+void registerVersionText(const uint16_t* words, TinyRegisterText& out) {
+    char buffer[TINY_REGISTER_TEXT_CAPACITY + 1];
+    const int written = std::snprintf(buffer, sizeof(buffer), "%u.%u",
+                                      static_cast<unsigned>(words[0]), static_cast<unsigned>(words[1]));
+    out.assign(buffer, written > 0 ? static_cast<size_t>(written) : 0U);
+}
+
+void populateMqttEvent(uint16_t address,
+                       TinyRegisterValueType value_type,
                        int32_t raw_value,
-                       const std::array<uint16_t, TINY_REGISTER_MAX_WORDS>& words,
+                       const uint16_t* words,
                        uint8_t word_count,
                        uint32_t timestamp_ms,
-                       const String* text_value,
+                       const TinyRegisterText* text_value,
                        MqttRegisterEvent& out) {
     out = MqttRegisterEvent{};
-    out.address = (binding.metadata_address != 0) ? binding.metadata_address : binding.register_address;
-    out.value_type = binding.value_type;
+    out.address = address;
+    out.value_type = value_type;
     out.raw_value = raw_value;
     out.timestamp_ms = timestamp_ms;
     out.raw_word_count = std::min<uint8_t>(word_count, kMaxCopyWords);
@@ -130,34 +200,6 @@ void populateMqttEvent(const TinyRegisterRuntimeBinding& binding,
     }
 }
 
-} // namespace
-
-bool decodeAndApplyBinding(const TinyRegisterRuntimeBinding& binding,
-                           const std::map<uint16_t, uint16_t>& register_values,
-                           TinyBMS_LiveData& live_data,
-                           uint32_t timestamp_ms,
-                           MqttRegisterEvent* mqtt_event_out) {
-    std::array<uint16_t, TINY_REGISTER_MAX_WORDS> raw_words{};
-    uint8_t word_count = 0;
-
-    if (!collectWords(binding, register_values, raw_words, word_count)) {
-        return false;
-    }
-
-    const int32_t raw_value = computeRawValue(binding, raw_words, word_count);
-    const float scaled_value = static_cast<float>(raw_value) * binding.scale;
-    String text_value = buildTextValue(binding, raw_words, word_count);
-    const String* text_ptr = (text_value.length() > 0) ? &text_value : nullptr;
-
-    live_data.applyBinding(binding, raw_value, scaled_value, text_ptr, raw_words.data());
-
-    if (mqtt_event_out != nullptr) {
-        populateMqttEvent(binding, raw_value, raw_words, word_count, timestamp_ms, text_ptr, *mqtt_event_out);
-    }
-
-    return true;
-}
-
 void finalizeLiveDataFromRegisters(TinyBMS_LiveData& live_data) {
     if (live_data.max_cell_mv > live_data.min_cell_mv) {
         live_data.cell_imbalance_mv = static_cast<uint16_t>(live_data.max_cell_mv - live_data.min_cell_mv);
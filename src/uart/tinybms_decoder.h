@@ -6,6 +6,7 @@
 #include "event/event_types_v2.h"
 #include "shared_data.h"
 #include "tiny_read_mapping.h"
+#include "uart/tinybms_register_store.h"
 
 namespace tinybms::uart::detail {
 
@@ -19,7 +20,7 @@ namespace tinybms::uart::detail {
  * already rely on `TinyBMS_LiveData` and the event payload layout.
  *
  * @param binding         Register binding description (address, scaling, field).
- * @param register_values Map of raw Modbus words read during the polling round.
+ * @param register_values Raw Modbus words read during the polling round.
  * @param live_data       Mutable live data snapshot that receives the decoded value.
  * @param timestamp_ms    Capture timestamp propagated to MQTT register events.
  * @param mqtt_event_out  Optional pointer that receives a populated MQTT event when
@@ -27,12 +28,46 @@ namespace tinybms::uart::detail {
  *                        caller is not interested in MQTT notifications.
  * @return true if all required Modbus words were present and the binding was decoded.
  */
+bool decodeAndApplyBinding(const TinyRegisterRuntimeBinding& binding,
+                           const tinybms::RegisterStore& register_values,
+                           TinyBMS_LiveData& live_data,
+                           uint32_t timestamp_ms,
+                           tinybms::events::MqttRegisterEvent* mqtt_event_out);
+
+/**
+ * @brief Same decoding from a map of raw words (tools and legacy callers; the
+ *        poll path uses the allocation-free RegisterStore overload).
+ */
 bool decodeAndApplyBinding(const TinyRegisterRuntimeBinding& binding,
                            const std::map<uint16_t, uint16_t>& register_values,
                            TinyBMS_LiveData& live_data,
                            uint32_t timestamp_ms,
                            tinybms::events::MqttRegisterEvent* mqtt_event_out);
 
+/**
+ * @brief Text of a String register: two characters per word, high byte first,
+ *        NUL bytes skipped.
+ */
+void registerCharsText(const uint16_t* words, uint8_t word_count, TinyRegisterText& out);
+
+/**
+ * @brief "major.minor" text of the firmware version register (501, two words).
+ */
+void registerVersionText(const uint16_t* words, TinyRegisterText& out);
+
+/**
+ * @brief Fill an MQTT register event (words beyond TINY_REGISTER_MAX_WORDS
+ *        and text beyond the payload buffer are truncated).
+ */
+void populateMqttEvent(uint16_t address,
+                       TinyRegisterValueType value_type,
+                       int32_t raw_value,
+                       const uint16_t* words,
+                       uint8_t word_count,
+                       uint32_t timestamp_ms,
+                       const TinyRegisterText* text_value,
+                       tinybms::events::MqttRegisterEvent& out);
+
 /**
  * @brief Apply derived calculations after raw bindings have been processed.
  *
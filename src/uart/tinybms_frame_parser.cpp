@@ -0,0 +1,261 @@
+#include "uart/tinybms_frame_parser.h"
+
+#include <cstring>
+
+#include "optimization/ring_buffer.h"
+#include "uart/tinybms_crc.h"
+
+namespace tinybms {
+namespace {
+
+constexpr uint8_t CMD_NACK_REV_D = 0x00;
+constexpr uint8_t CMD_ACK = 0x01;
+constexpr uint8_t CMD_NACK_LEGACY = 0x81;
+constexpr size_t kCrcLength = 2;
+constexpr size_t kMinFrameLength = 5;   // AA 01 STATUS CRC_L CRC_H
+
+} // namespace
+
+void FrameParser::reset(const Expectation& expectation) {
+    expectation_ = expectation;
+    if (replay_pos_ < replay_len_) {
+        stats_.garbage_bytes += static_cast<uint32_t>(replay_len_ - replay_pos_);
+    }
+    replay_pos_ = 0;
+    replay_len_ = 0;
+    state_ = State::WaitPreamble;
+    length_ = 0;
+    body_remaining_ = 0;
+    header_length_ = 0;
+    body_length_ = 0;
+    body_length_known_ = false;
+}
+
+size_t FrameParser::feed(const uint8_t* data, size_t length) {
+    if (data == nullptr) {
+        return 0;
+    }
+
+    size_t consumed = 0;
+    while (consumed < length && state_ != State::Complete) {
+        process(data[consumed++]);
+        drainReplay();
+    }
+    return consumed;
+}
+
+size_t FrameParser::feed(optimization::ByteRingBuffer& buffer) {
+    size_t consumed = 0;
+    uint8_t byte = 0;
+    while (state_ != State::Complete && buffer.pop(&byte, 1) == 1) {
+        process(byte);
+        drainReplay();
+        ++consumed;
+    }
+    return consumed;
+}
+
+FrameView FrameParser::frame() const {
+    FrameView view{};
+    if (state_ == State::Complete && length_ >= kCrcLength) {
+        view.data = buffer_.data();
+        view.length = length_ - kCrcLength;
+    }
+    return view;
+}
+
+void FrameParser::consumeFrame() {
+    if (state_ != State::Complete) {
+        return;
+    }
+    state_ = State::WaitPreamble;
+    length_ = 0;
+    body_length_known_ = false;
+    drainReplay();
+}
+
+size_t FrameParser::bytesNeeded() const {
+    if (state_ == State::Complete) {
+        return 0;
+    }
+    const size_t total = expectedTotalLength();
+    return (total > length_) ? (total - length_) : 1;
+}
+
+bool FrameParser::hasPartialFrame() const {
+    return state_ != State::WaitPreamble && state_ != State::Complete;
+}
+
+bool FrameParser::abandonPartialFrame() {
+    if (!hasPartialFrame()) {
+        return false;
+    }
+    stats_.partial_frames++;
+    stats_.garbage_bytes += static_cast<uint32_t>(length_);
+    state_ = State::WaitPreamble;
+    length_ = 0;
+    body_length_known_ = false;
+    return true;
+}
+
+void FrameParser::process(uint8_t byte) {
+    switch (state_) {
+        case State::WaitPreamble:
+            if (byte == kPreamble) {
+                startFrame();
+            } else {
+                stats_.garbage_bytes++;
+            }
+            break;
+
+        case State::Command:
+            append(byte);
+            crc_state_ = crc::updateByte(crc_state_, byte);
+            if (!acceptCommand(byte)) {
+                resync();
+            }
+            break;
+
+        case State::Header:
+            append(byte);
+            crc_state_ = crc::updateByte(crc_state_, byte);
+            body_length_ = byte;
+            body_length_known_ = true;
+            if (header_length_ + body_length_ + kCrcLength > kMaxFrameSize ||
+                (check_payload_length_ && byte != expectation_.payload_length)) {
+                resync();
+                break;
+            }
+            body_remaining_ = body_length_;
+            state_ = (body_remaining_ == 0) ? State::CrcLow : State::Body;
+            break;
+
+        case State::Body:
+            append(byte);
+            crc_state_ = crc::updateByte(crc_state_, byte);
+            if (--body_remaining_ == 0) {
+                state_ = State::CrcLow;
+            }
+            break;
+
+        case State::CrcLow:
+            append(byte);
+            crc_low_ = byte;
+            state_ = State::CrcHigh;
+            break;
+
+        case State::CrcHigh: {
+            append(byte);
+            const uint16_t received = static_cast<uint16_t>(crc_low_) |
+                                      (static_cast<uint16_t>(byte) << 8);
+            if (received == crc_state_) {
+                state_ = State::Complete;
+                stats_.frames_ok++;
+            } else {
+                stats_.crc_errors++;
+                resync();
+            }
+            break;
+        }
+
+        case State::Complete:
+            break;
+    }
+}
+
+void FrameParser::startFrame() {
+    length_ = 0;
+    body_length_ = 0;
+    body_remaining_ = 0;
+    header_length_ = 0;
+    body_length_known_ = false;
+    append(kPreamble);
+    crc_state_ = crc::updateByte(crc::kModbusInitialState, kPreamble);
+    state_ = State::Command;
+}
+
+void FrameParser::append(uint8_t byte) {
+    if (length_ < buffer_.size()) {
+        buffer_[length_++] = byte;
+    }
+}
+
+bool FrameParser::acceptCommand(uint8_t command) {
+    check_payload_length_ = false;
+    if (expectation_.command != kNoCommand && command == expectation_.command) {
+        header_length_ = 3;
+        check_payload_length_ = (expectation_.payload_length != 0);
+        state_ = State::Header;
+        return true;
+    }
+    if (command == CMD_ACK || command == CMD_NACK_LEGACY) {
+        header_length_ = 2;
+        body_length_ = 1;
+    } else if (command == CMD_NACK_REV_D) {
+        header_length_ = 2;
+        body_length_ = 2;
+    } else {
+        const FrameLayout* layout = nullptr;
+        for (size_t i = 0; i < expectation_.extra_layout_count; ++i) {
+            if (expectation_.extra_layouts[i].command == command) {
+                layout = &expectation_.extra_layouts[i];
+                break;
+            }
+        }
+        if (layout == nullptr) {
+            return false;
+        }
+        if (layout->body_length == 0) {
+            header_length_ = 3;
+            state_ = State::Header;
+            return true;
+        }
+        header_length_ = 2;
+        body_length_ = layout->body_length;
+    }
+    body_length_known_ = true;
+    body_remaining_ = body_length_;
+    state_ = State::Body;
+    return true;
+}
+
+void FrameParser::resync() {
+    stats_.resync_count++;
+    stats_.garbage_bytes++;   // the false preamble
+
+    // Bytes after the false preamble have not been searched for a preamble yet:
+    // replay them ahead of anything still pending. Both ranges come from one
+    // earlier frame buffer, so together they always fit in replay_.
+    const size_t tail = (length_ > 1) ? length_ - 1 : 0;
+    const size_t pending = replay_len_ - replay_pos_;
+    if (replay_pos_ >= tail) {
+        replay_pos_ -= tail;
+    } else {
+        std::memmove(replay_.data() + tail, replay_.data() + replay_pos_, pending);
+        replay_pos_ = 0;
+        replay_len_ = tail + pending;
+    }
+    std::memcpy(replay_.data() + replay_pos_, buffer_.data() + 1, tail);
+
+    state_ = State::WaitPreamble;
+    length_ = 0;
+    body_length_known_ = false;
+}
+
+void FrameParser::drainReplay() {
+    while (replay_pos_ < replay_len_ && state_ != State::Complete) {
+        process(replay_[replay_pos_++]);
+    }
+}
+
+size_t FrameParser::expectedTotalLength() const {
+    if (body_length_known_) {
+        return header_length_ + body_length_ + kCrcLength;
+    }
+    if (expectation_.command != kNoCommand) {
+        return 3 + static_cast<size_t>(expectation_.payload_length) + kCrcLength;
+    }
+    return kMinFrameLength;
+}
+
+} // namespace tinybms
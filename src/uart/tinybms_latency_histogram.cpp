@@ -0,0 +1,183 @@
+#include "uart/tinybms_latency_histogram.h"
+
+#include <algorithm>
+
+namespace tinybms {
+namespace {
+
+constexpr uint8_t kCommands[UartLatencyStats::kCommandCount] = {0x07, 0x09, 0x0B, 0x0D};
+constexpr AttemptStatus kOutcomes[UartLatencyStats::kOutcomeCount] = {
+    AttemptStatus::Success,
+    AttemptStatus::Timeout,
+    AttemptStatus::CrcMismatch,
+    AttemptStatus::ProtocolError,
+};
+
+int commandIndex(uint8_t command) {
+    for (size_t i = 0; i < UartLatencyStats::kCommandCount; ++i) {
+        if (kCommands[i] == command) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+int outcomeIndex(AttemptStatus status) {
+    for (size_t i = 0; i < UartLatencyStats::kOutcomeCount; ++i) {
+        if (kOutcomes[i] == status) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+int highestBit(uint32_t value) {
+    int bit = 31;
+    while (bit > 0 && (value & (1UL << bit)) == 0) {
+        --bit;
+    }
+    return bit;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// LatencyHistogram
+// ---------------------------------------------------------------------------
+size_t LatencyHistogram::bucketIndex(uint32_t value_us) {
+    if (value_us < (1UL << kMinShift)) {
+        return 0;
+    }
+    const int msb = highestBit(value_us);
+    const int octave = msb - kMinShift;
+    if (octave >= kOctaves) {
+        return kBucketCount - 1;
+    }
+    const uint32_t sub = (value_us >> (msb - 2)) & (kSubBuckets - 1);
+    return 1 + static_cast<size_t>(octave) * kSubBuckets + sub;
+}
+
+uint32_t LatencyHistogram::bucketUpperUs(size_t index) {
+    if (index == 0) {
+        return 1UL << kMinShift;
+    }
+    if (index >= kBucketCount - 1) {
+        return UINT32_MAX;
+    }
+    const size_t octave = (index - 1) / kSubBuckets;
+    const size_t sub = (index - 1) % kSubBuckets;
+    const uint32_t base = 1UL << (kMinShift + octave);
+    const uint32_t step = base / kSubBuckets;
+    return base + static_cast<uint32_t>(sub + 1) * step;
+}
+
+void LatencyHistogram::record(uint32_t value_us) {
+    buckets_[bucketIndex(value_us)]++;
+    count_++;
+    max_us_ = std::max(max_us_, value_us);
+}
+
+void LatencyHistogram::reset() {
+    buckets_.fill(0);
+    count_ = 0;
+    max_us_ = 0;
+}
+
+uint32_t LatencyHistogram::percentileUs(float percentile) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    const float clamped = std::min(100.0f, std::max(0.0f, percentile));
+    // Rank of the sample at this percentile (1-based, nearest rank).
+    uint32_t rank = static_cast<uint32_t>(clamped / 100.0f * static_cast<float>(count_) + 0.999f);
+    rank = std::max<uint32_t>(1, std::min(rank, count_));
+
+    uint32_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        seen += buckets_[i];
+        if (seen >= rank) {
+            return std::min(bucketUpperUs(i), max_us_);
+        }
+    }
+    return max_us_;
+}
+
+LatencySummary summarize(const LatencyHistogram& histogram) {
+    LatencySummary summary;
+    summary.count = histogram.count();
+    summary.p50_us = histogram.percentileUs(50.0f);
+    summary.p90_us = histogram.percentileUs(90.0f);
+    summary.p99_us = histogram.percentileUs(99.0f);
+    summary.max_us = histogram.maxUs();
+    return summary;
+}
+
+// ---------------------------------------------------------------------------
+// UartLatencyStats
+// ---------------------------------------------------------------------------
+void UartLatencyStats::record(const AttemptTiming& timing) {
+    const int command = commandIndex(timing.command);
+    const int outcome = outcomeIndex(timing.status);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (command < 0 || outcome < 0) {
+        untimed_attempts_++;
+        return;
+    }
+    Entry& entry = entries_[command][outcome];
+    entry.attempts++;
+    if (timing.received) {
+        entry.first_byte.record(timing.first_byte_us);
+        entry.transfer.record(timing.transfer_us);
+    }
+}
+
+void UartLatencyStats::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& per_command : entries_) {
+        for (auto& entry : per_command) {
+            entry.attempts = 0;
+            entry.first_byte.reset();
+            entry.transfer.reset();
+        }
+    }
+    untimed_attempts_ = 0;
+}
+
+std::vector<UartLatencyStats::EntrySnapshot> UartLatencyStats::snapshot() const {
+    std::vector<EntrySnapshot> result;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t c = 0; c < kCommandCount; ++c) {
+        for (size_t o = 0; o < kOutcomeCount; ++o) {
+            const Entry& entry = entries_[c][o];
+            if (entry.attempts == 0) {
+                continue;
+            }
+            EntrySnapshot snapshot;
+            snapshot.command = kCommands[c];
+            snapshot.outcome = kOutcomes[o];
+            snapshot.attempts = entry.attempts;
+            snapshot.first_byte = summarize(entry.first_byte);
+            snapshot.transfer = summarize(entry.transfer);
+            result.push_back(snapshot);
+        }
+    }
+    return result;
+}
+
+uint32_t UartLatencyStats::untimedAttempts() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return untimed_attempts_;
+}
+
+const char* attemptStatusName(AttemptStatus status) {
+    switch (status) {
+        case AttemptStatus::Success:       return "success";
+        case AttemptStatus::Timeout:       return "timeout";
+        case AttemptStatus::CrcMismatch:   return "crc_mismatch";
+        case AttemptStatus::WriteError:    return "write_error";
+        case AttemptStatus::ProtocolError: return "protocol_error";
+    }
+    return "unknown";
+}
+
+} // namespace tinybms
@@ -0,0 +1,113 @@
+#include "uart/tinybms_link_tracker.h"
+
+#include <algorithm>
+
+namespace tinybms {
+
+LinkTracker::LinkTracker(const LinkTrackerConfig& config) {
+    configure(config);
+}
+
+void LinkTracker::configure(const LinkTrackerConfig& config) {
+    config_ = config;
+    config_.min_sleep_threshold_ms = std::max<uint32_t>(1, config_.min_sleep_threshold_ms);
+    config_.initial_sleep_threshold_ms =
+        std::max(config_.min_sleep_threshold_ms, config_.initial_sleep_threshold_ms);
+    threshold_ms_.store(config_.initial_sleep_threshold_ms, std::memory_order_relaxed);
+    sleep_failures_ = 0;
+    wakeups_since_probe_ = 0;
+}
+
+bool LinkTracker::wakeupNeeded(uint32_t now_ms) const {
+    if (force_wakeup_ || !has_activity_) {
+        return true;
+    }
+    const uint32_t idle_ms = now_ms - last_activity_ms_;
+    if (idle_ms <= sleepThresholdMs()) {
+        return false;
+    }
+    // Probe a lowered threshold now and then, or it could never come back up.
+    const bool probe = config_.probe_interval > 0 && wakeups_since_probe_ >= config_.probe_interval &&
+                       idle_ms <= config_.initial_sleep_threshold_ms;
+    return !probe;
+}
+
+void LinkTracker::noteActivity(uint32_t now_ms) {
+    has_activity_ = true;
+    last_activity_ms_ = now_ms;
+}
+
+void LinkTracker::recordTransaction(uint32_t start_ms,
+                                    uint32_t end_ms,
+                                    bool wakeup_sent,
+                                    uint32_t wakeup_cost_ms,
+                                    const TransactionResult& result) {
+    const uint32_t idle_ms = has_activity_ ? start_ms - last_activity_ms_ : 0;
+
+    if (wakeup_sent) {
+        stats_.wakeups_sent++;
+        wakeups_since_probe_++;
+    } else {
+        stats_.wakeups_skipped++;
+        const bool probe = idle_ms > sleepThresholdMs();
+        if (probe) {
+            wakeups_since_probe_ = 0;
+        }
+        if (result.first_attempt_timed_out) {
+            stats_.skip_failures++;
+            // Asleep, not gone: the retry got through. A failed probe only
+            // confirms the current threshold.
+            if (result.success && has_activity_ && !probe) {
+                noteSleepFailure(idle_ms);
+            }
+        } else {
+            stats_.latency_saved_ms += wakeup_cost_ms;
+            if (result.success && has_activity_) {
+                noteCleanWake(idle_ms);
+            }
+        }
+    }
+
+    if (result.success) {
+        noteActivity(end_ms);
+        force_wakeup_ = false;
+    } else {
+        force_wakeup_ = true;
+    }
+}
+
+void LinkTracker::noteSleepFailure(uint32_t idle_ms) {
+    sleep_failure_gap_ms_ = sleep_failures_ == 0 ? idle_ms : std::max(sleep_failure_gap_ms_, idle_ms);
+    if (++sleep_failures_ < std::max<uint32_t>(1, config_.failures_to_lower)) {
+        return;
+    }
+    const uint32_t learned = std::max(config_.min_sleep_threshold_ms, sleep_failure_gap_ms_ / 4U * 3U);
+    if (learned < sleepThresholdMs()) {
+        threshold_ms_.store(learned, std::memory_order_relaxed);
+    }
+    sleep_failures_ = 0;
+}
+
+void LinkTracker::noteCleanWake(uint32_t idle_ms) {
+    sleep_failures_ = 0;
+    const uint32_t initial = config_.initial_sleep_threshold_ms;
+    if (idle_ms >= initial) {
+        return;
+    }
+    const uint32_t raised = idle_ms + (initial - idle_ms) / 16U;
+    if (raised > sleepThresholdMs()) {
+        threshold_ms_.store(raised, std::memory_order_relaxed);
+    }
+}
+
+LinkTrackerStats LinkTracker::stats() const {
+    LinkTrackerStats stats = stats_;
+    stats.sleep_threshold_ms = sleepThresholdMs();
+    return stats;
+}
+
+void LinkTracker::resetStats() {
+    stats_ = LinkTrackerStats{};
+}
+
+} // namespace tinybms
@@ -0,0 +1,218 @@
+#include "uart/tinybms_pack_aggregator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace tinybms {
+namespace {
+
+uint16_t clampU16(float value) {
+    if (!(value > 0.0f)) {
+        return 0;
+    }
+    return static_cast<uint16_t>(std::min(65535.0f, std::floor(value)));
+}
+
+// Keep the raw register in the primary's scale (the mapping decides it).
+uint16_t rescaleRaw(uint16_t raw, float value, float combined) {
+    if (!(value > 0.0f)) {
+        return raw;
+    }
+    return clampU16(static_cast<float>(raw) * combined / value + 0.5f);
+}
+
+} // namespace
+
+PackAggregator::PackAggregator(size_t pack_count, uint32_t stale_ms) {
+    configure(pack_count, stale_ms);
+}
+
+void PackAggregator::configure(size_t pack_count, uint32_t stale_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pack_count_ = std::max<size_t>(1, std::min(pack_count, kMaxPacks));
+    stale_ms_ = stale_ms;
+    for (auto& slot : slots_) {
+        const float fallback = slot.fallback_capacity_ah;
+        slot = Slot{};
+        slot.fallback_capacity_ah = fallback;
+    }
+}
+
+size_t PackAggregator::packCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pack_count_;
+}
+
+uint32_t PackAggregator::staleMs() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stale_ms_;
+}
+
+void PackAggregator::setFallbackCapacityAh(size_t pack, float capacity_ah) {
+    if (pack >= kMaxPacks) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    slots_[pack].fallback_capacity_ah = std::max(0.0f, capacity_ah);
+}
+
+void PackAggregator::update(size_t pack, const TinyBMS_LiveData& live, uint32_t now_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pack >= pack_count_) {
+        return;
+    }
+    Slot& slot = slots_[pack];
+    slot.live = live;
+    slot.present = true;
+    slot.updated_ms = now_ms;
+    slot.updates++;
+}
+
+bool PackAggregator::isFresh(const Slot& slot, uint32_t now_ms) const {
+    return slot.present && (now_ms - slot.updated_ms) <= stale_ms_;
+}
+
+float PackAggregator::capacityAh(const Slot& slot) {
+    const TinyRegisterSnapshot* snapshot = slot.live.findSnapshot(kCapacityRegister);
+    if (snapshot != nullptr && snapshot->raw_value > 0) {
+        return static_cast<float>(snapshot->raw_value) * 0.01f;
+    }
+    return slot.fallback_capacity_ah;
+}
+
+size_t PackAggregator::combine(uint32_t now_ms, TinyBMS_LiveData& out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::array<const Slot*, kMaxPacks> fresh{};
+    std::array<float, kMaxPacks> weight{};
+    size_t count = 0;
+    bool capacities_known = true;
+    float total_capacity = 0.0f;
+    for (size_t i = 0; i < pack_count_; ++i) {
+        if (!isFresh(slots_[i], now_ms)) {
+            continue;
+        }
+        fresh[count] = &slots_[i];
+        weight[count] = capacityAh(slots_[i]);
+        capacities_known = capacities_known && weight[count] > 0.0f;
+        total_capacity += weight[count];
+        count++;
+    }
+    if (count == 0) {
+        return 0;
+    }
+    // One unknown capacity and the weights would be meaningless: weigh equally.
+    float total_weight = total_capacity;
+    if (!capacities_known) {
+        std::fill(weight.begin(), weight.begin() + count, 1.0f);
+        total_weight = static_cast<float>(count);
+    }
+
+    out = fresh[0]->live;   // snapshots, cutoffs and identification of the primary
+
+    float voltage_sum = 0.0f;
+    float current_sum = 0.0f;
+    float soc_weighted = 0.0f;
+    float soh_weighted = 0.0f;
+    float charge_limit = INFINITY;
+    float discharge_limit = INFINITY;
+    float charge_overcurrent = INFINITY;
+    float discharge_overcurrent = INFINITY;
+    bool fault = false;
+
+    for (size_t i = 0; i < count; ++i) {
+        const TinyBMS_LiveData& live = fresh[i]->live;
+        voltage_sum += live.voltage;
+        current_sum += live.current;
+        soc_weighted += live.soc_percent * weight[i];
+        soh_weighted += live.soh_percent * weight[i];
+
+        // The pack reaching its limit first caps the bank.
+        const float share = total_weight / weight[i];
+        charge_limit = std::min(charge_limit, live.max_charge_current * share);
+        discharge_limit = std::min(discharge_limit, live.max_discharge_current * share);
+        charge_overcurrent = std::min(charge_overcurrent, live.charge_overcurrent_a * share);
+        discharge_overcurrent = std::min(discharge_overcurrent, live.discharge_overcurrent_a * share);
+
+        if (i == 0) {
+            continue;
+        }
+        if (live.min_cell_mv > 0) {
+            out.min_cell_mv = (out.min_cell_mv == 0) ? live.min_cell_mv : std::min(out.min_cell_mv, live.min_cell_mv);
+        }
+        out.max_cell_mv = std::max(out.max_cell_mv, live.max_cell_mv);
+        out.temperature = std::max(out.temperature, live.temperature);
+        out.pack_temp_min = std::min(out.pack_temp_min, live.pack_temp_min);
+        out.pack_temp_max = std::max(out.pack_temp_max, live.pack_temp_max);
+        out.balancing_bits |= live.balancing_bits;
+        if (live.cell_overvoltage_mv > 0) {
+            out.cell_overvoltage_mv = (out.cell_overvoltage_mv == 0)
+                ? live.cell_overvoltage_mv : std::min(out.cell_overvoltage_mv, live.cell_overvoltage_mv);
+        }
+        out.cell_undervoltage_mv = std::max(out.cell_undervoltage_mv, live.cell_undervoltage_mv);
+        if (live.overheat_cutoff_c > 0) {
+            out.overheat_cutoff_c = (out.overheat_cutoff_c == 0)
+                ? live.overheat_cutoff_c : std::min(out.overheat_cutoff_c, live.overheat_cutoff_c);
+        }
+        fault = fault || live.online_status == kFaultStatus;
+    }
+    fault = fault || fresh[0]->live.online_status == kFaultStatus;
+
+    out.voltage = voltage_sum / static_cast<float>(count);
+    out.current = current_sum;
+    out.soc_percent = soc_weighted / total_weight;
+    out.soh_percent = soh_weighted / total_weight;
+    out.soc_raw = rescaleRaw(out.soc_raw, fresh[0]->live.soc_percent, out.soc_percent);
+    out.soh_raw = rescaleRaw(out.soh_raw, fresh[0]->live.soh_percent, out.soh_percent);
+    out.cell_imbalance_mv = (out.min_cell_mv > 0 && out.max_cell_mv >= out.min_cell_mv)
+        ? static_cast<uint16_t>(out.max_cell_mv - out.min_cell_mv) : 0;
+    out.max_charge_current = clampU16(charge_limit);
+    out.max_discharge_current = clampU16(discharge_limit);
+    out.charge_overcurrent_a = clampU16(charge_overcurrent);
+    out.discharge_overcurrent_a = clampU16(discharge_overcurrent);
+    if (fault) {
+        out.online_status = kFaultStatus;
+    }
+
+    if (capacities_known) {
+        for (uint16_t i = 0; i < out.register_count; ++i) {
+            TinyRegisterSnapshot& snapshot = out.register_snapshots[i];
+            if (snapshot.address == kCapacityRegister) {
+                // raw_value is 32-bit: a bank may exceed the 655.35 Ah of one word.
+                snapshot.raw_value = static_cast<int32_t>(total_capacity * 100.0f + 0.5f);
+                snapshot.raw_words[0] = clampU16(total_capacity * 100.0f + 0.5f);
+            }
+        }
+    }
+    return count;
+}
+
+std::vector<PackStatus> PackAggregator::status(uint32_t now_ms) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<PackStatus> result;
+    result.reserve(pack_count_);
+    for (size_t i = 0; i < pack_count_; ++i) {
+        const Slot& slot = slots_[i];
+        PackStatus status;
+        status.index = static_cast<uint8_t>(i);
+        status.present = slot.present;
+        status.fresh = isFresh(slot, now_ms);
+        status.age_ms = slot.present ? now_ms - slot.updated_ms : 0;
+        status.updates = slot.updates;
+        status.capacity_ah = capacityAh(slot);
+        if (slot.present) {
+            status.voltage = slot.live.voltage;
+            status.current = slot.live.current;
+            status.soc_percent = slot.live.soc_percent;
+            status.min_cell_mv = slot.live.min_cell_mv;
+            status.max_cell_mv = slot.live.max_cell_mv;
+            status.max_charge_current = slot.live.max_charge_current;
+            status.max_discharge_current = slot.live.max_discharge_current;
+            status.online_status = slot.live.online_status;
+        }
+        result.push_back(status);
+    }
+    return result;
+}
+
+} // namespace tinybms
@@ -0,0 +1,107 @@
+#include "uart/tinybms_pack_poller.h"
+
+#include <algorithm>
+
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_decoder.h"
+
+namespace tinybms {
+namespace {
+
+void accumulate(TransactionResult& total, const TransactionResult& part) {
+    total.retries_performed += part.retries_performed;
+    total.timeout_count += part.timeout_count;
+    total.crc_error_count += part.crc_error_count;
+    total.write_error_count += part.write_error_count;
+    total.garbage_bytes += part.garbage_bytes;
+    total.resync_count += part.resync_count;
+    total.partial_frame_count += part.partial_frame_count;
+    total.last_status = part.last_status;
+    total.success = part.success;
+}
+
+} // namespace
+
+TransactionResult readPlanRegisters(hal::IHalUart& uart,
+                                    const ReadPlan& plan,
+                                    uint16_t* buffer,
+                                    RegisterStore& register_values,
+                                    const TransactionOptions& options,
+                                    const DelayConfig& delay) {
+    TransactionResult total{};
+    total.success = true;
+    total.last_status = AttemptStatus::Success;
+    for (const auto& op : plan.operations) {
+        TransactionResult part;
+        if (op.kind == ReadOperationKind::Block) {
+            part = readRegisterBlock(uart, op.start_address, static_cast<uint8_t>(op.register_count),
+                                     buffer, options, delay);
+        } else {
+            part = readIndividualRegisters(uart, op.addresses.data(), op.addresses.size(),
+                                           buffer, options, delay);
+        }
+        if (&op == &plan.operations.front()) {
+            // Only the first request follows the idle gap (sleep detection).
+            total.first_attempt_timed_out = part.first_attempt_timed_out;
+        }
+        accumulate(total, part);
+        if (!part.success) {
+            break;
+        }
+        if (op.kind == ReadOperationKind::Block) {
+            register_values.setRange(op.start_address, buffer, op.register_count);
+        } else {
+            for (uint16_t i = 0; i < op.register_count; ++i) {
+                register_values.set(op.addresses[i], buffer[i]);
+            }
+        }
+    }
+    return total;
+}
+
+void decodeLiveData(const DecodePlan& plan,
+                    const RegisterStore& register_values,
+                    uint32_t now_ms,
+                    TinyBMS_LiveData& live) {
+    live = TinyBMS_LiveData{};
+    live.resetSnapshots();
+    plan.apply(register_values, live, now_ms);
+    uart::detail::finalizeLiveDataFromRegisters(live);
+}
+
+PackPoller::PackPoller(hal::IHalUart& uart) : uart_(uart) {}
+
+bool PackPoller::poll(uint32_t now_ms,
+                      uint32_t tolerance_ms,
+                      const TransactionOptions& options,
+                      const DelayConfig& delay,
+                      TinyBMS_LiveData& live) {
+    uint32_t requests = 0;
+    const uint8_t due_mask = scheduler_.dueMask(now_ms, tolerance_ms, requests);
+    if (due_mask == 0) {
+        return false;
+    }
+    const ReadPlan& plan = scheduler_.planFor(due_mask, model_);
+    if (plan.empty()) {
+        scheduler_.markRefreshed(due_mask, now_ms, requests);
+        return false;
+    }
+    register_cache_.ensureLayout(getTinyRegisterBindings(), getTinyReadMappingVersion());
+    decode_plan_.ensureCompiled(getTinyRegisterBindings(), register_cache_);
+    if (buffer_.size() < scheduler_.maxOperationWords()) {
+        buffer_.assign(scheduler_.maxOperationWords(), 0);
+    }
+
+    stats_.cycles++;
+    stats_.last_result = readPlanRegisters(uart_, plan, buffer_.data(), register_cache_, options, delay);
+    if (!stats_.last_result.success) {
+        stats_.failures++;
+        return false;
+    }
+    stats_.last_cycle_bytes = plan.wire_bytes;
+    scheduler_.markRefreshed(due_mask, now_ms, requests);
+    decodeLiveData(decode_plan_, register_cache_, now_ms, live);
+    return true;
+}
+
+} // namespace tinybms
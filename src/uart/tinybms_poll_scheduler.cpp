@@ -0,0 +1,130 @@
+#include "uart/tinybms_poll_scheduler.h"
+
+#include <algorithm>
+
+namespace tinybms {
+namespace {
+
+constexpr uint32_t kRequestMask = 0xFFu;
+constexpr uint32_t kRequestCountStep = 0x100u;
+
+uint32_t periodFor(const RefreshPeriods& periods, size_t index) {
+    switch (static_cast<TinyRegisterRefreshClass>(index)) {
+        case TinyRegisterRefreshClass::Fast:   return periods.fast_ms;
+        case TinyRegisterRefreshClass::Normal: return periods.normal_ms;
+        case TinyRegisterRefreshClass::Slow:   return periods.slow_ms;
+        case TinyRegisterRefreshClass::Once:   break;
+    }
+    return 0;
+}
+
+} // namespace
+
+PollScheduler::PollScheduler() {
+    plan_valid_.fill(false);
+}
+
+void PollScheduler::setPeriods(const RefreshPeriods& periods) {
+    periods_ = periods;
+}
+
+uint8_t PollScheduler::dueMask(uint32_t now_ms, uint32_t tolerance_ms, uint32_t& requests) const {
+    requests = pending_.load(std::memory_order_acquire);
+    uint8_t mask = static_cast<uint8_t>(requests & kRequestMask);
+    for (size_t i = 0; i < kClassCount; ++i) {
+        if (static_cast<TinyRegisterRefreshClass>(i) == TinyRegisterRefreshClass::Once) {
+            continue;   // only through pending_
+        }
+        const uint32_t period = periodFor(periods_, i);
+        if (now_ms - last_refresh_ms_[i] + tolerance_ms >= period) {
+            mask |= static_cast<uint8_t>(1U << i);
+        }
+    }
+    return mask;
+}
+
+uint8_t PollScheduler::dueMask(uint32_t now_ms, uint32_t tolerance_ms) const {
+    uint32_t requests = 0;
+    return dueMask(now_ms, tolerance_ms, requests);
+}
+
+void PollScheduler::markRefreshed(uint8_t mask, uint32_t now_ms, uint32_t requests) {
+    for (size_t i = 0; i < kClassCount; ++i) {
+        if (mask & (1U << i)) {
+            last_refresh_ms_[i] = now_ms;
+        }
+    }
+    // Fails when a request arrived during the read: everything stays pending.
+    pending_.compare_exchange_strong(requests, requests & ~static_cast<uint32_t>(mask), std::memory_order_acq_rel);
+}
+
+void PollScheduler::addRequests(uint8_t mask) {
+    uint32_t current = pending_.load(std::memory_order_relaxed);
+    uint32_t next = 0;
+    do {
+        next = ((current & ~kRequestMask) + kRequestCountStep) | (current & kRequestMask) | mask;
+    } while (!pending_.compare_exchange_weak(current, next, std::memory_order_acq_rel));
+}
+
+void PollScheduler::requestRefresh(TinyRegisterRefreshClass refresh_class) {
+    addRequests(refreshClassBit(refresh_class));
+}
+
+void PollScheduler::requestRefreshForAddress(uint16_t address) {
+    uint8_t mask = 0;
+    for (const auto& binding : getTinyRegisterBindings()) {
+        const uint8_t words = binding.register_count == 0 ? 1 : binding.register_count;
+        if (address >= binding.register_address &&
+            static_cast<uint32_t>(address) < static_cast<uint32_t>(binding.register_address) + words) {
+            mask |= refreshClassBit(binding.refresh_class);
+        }
+    }
+    if (mask != 0) {
+        addRequests(mask);
+    }
+}
+
+void PollScheduler::requestFullRefresh() {
+    addRequests(kAllRefreshClasses);
+}
+
+void PollScheduler::setExcludedAddresses(std::vector<uint16_t> addresses) {
+    std::sort(addresses.begin(), addresses.end());
+    addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+    if (addresses == excluded_) {
+        return;
+    }
+    excluded_ = std::move(addresses);
+    plan_valid_.fill(false);
+    max_operation_words_ = 0;
+}
+
+const ReadPlan& PollScheduler::planFor(uint8_t mask, const ReadPlanCostModel& model) {
+    mask &= kAllRefreshClasses;
+    const uint32_t version = getTinyReadMappingVersion();
+    if (version != plans_mapping_version_ || model != plans_cost_model_) {
+        plan_valid_.fill(false);
+        plans_mapping_version_ = version;
+        plans_cost_model_ = model;
+        max_operation_words_ = 0;
+    }
+
+    if (!plan_valid_[mask]) {
+        if (excluded_.empty()) {
+            plans_[mask] = buildReadPlanFromMapping(model, mask);
+        } else {
+            std::vector<uint16_t> addresses = collectPollAddresses(getTinyRegisterBindings(), mask);
+            addresses.erase(std::remove_if(addresses.begin(), addresses.end(), [this](uint16_t address) {
+                                return std::binary_search(excluded_.begin(), excluded_.end(), address);
+                            }),
+                            addresses.end());
+            plans_[mask] = buildReadPlan(addresses, model);
+            plans_[mask].mapping_version = version;
+        }
+        plan_valid_[mask] = true;
+        max_operation_words_ = std::max(max_operation_words_, plans_[mask].max_operation_words);
+    }
+    return plans_[mask];
+}
+
+} // namespace tinybms
@@ -0,0 +1,205 @@
+#include "uart/tinybms_read_planner.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace tinybms {
+namespace {
+
+constexpr uint32_t kBlockFixedBytes = 7 + 5;    // AA 07 RL ADDR_L ADDR_H CRC + AA 07 PL .. CRC
+constexpr uint32_t kBlockBytesPerWord = 2;
+constexpr uint32_t kListFixedBytes = 5 + 5;     // AA 09 PL .. CRC, both directions
+constexpr uint32_t kListBytesPerWord = 4;       // address in the request, value in the reply
+constexpr uint8_t kProtocolMaxRegisters = 127;
+
+struct Step {
+    uint32_t from = 0;
+    uint8_t from_fill = 0;
+    bool block = false;
+};
+
+uint8_t clampMaxRegisters(uint8_t value) {
+    if (value == 0) {
+        return 1;
+    }
+    return std::min(value, kProtocolMaxRegisters);
+}
+
+uint64_t byteTimeNs(const ReadPlanCostModel& model) {
+    const uint64_t baud = model.baud_rate == 0 ? 115200 : model.baud_rate;
+    const uint64_t bits = model.bits_per_byte == 0 ? 10 : model.bits_per_byte;
+    return (bits * 1000000000ULL) / baud;
+}
+
+void finalizePlan(ReadPlan& plan, const ReadPlanCostModel& model) {
+    plan.cost_model = model;
+    plan.wire_bytes = 0;
+    plan.max_operation_words = 0;
+    for (const auto& op : plan.operations) {
+        plan.wire_bytes += operationWireBytes(op);
+        plan.max_operation_words = std::max(plan.max_operation_words, op.register_count);
+    }
+    const uint64_t wire_ns = static_cast<uint64_t>(plan.wire_bytes) * byteTimeNs(model);
+    plan.estimated_cycle_us = static_cast<uint32_t>(wire_ns / 1000ULL) +
+                              static_cast<uint32_t>(plan.operations.size()) * model.transaction_overhead_us;
+}
+
+void appendListOperations(ReadPlan& plan, const std::vector<uint16_t>& addresses, uint8_t max_registers) {
+    for (size_t offset = 0; offset < addresses.size(); offset += max_registers) {
+        const size_t count = std::min<size_t>(max_registers, addresses.size() - offset);
+        ReadOperation op{};
+        op.kind = ReadOperationKind::List;
+        op.start_address = addresses[offset];
+        op.register_count = static_cast<uint16_t>(count);
+        op.addresses.assign(addresses.begin() + offset, addresses.begin() + offset + count);
+        plan.operations.push_back(std::move(op));
+    }
+}
+
+std::vector<uint16_t> sortedUnique(std::vector<uint16_t> addresses) {
+    std::sort(addresses.begin(), addresses.end());
+    addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+    return addresses;
+}
+
+} // namespace
+
+uint32_t operationWireBytes(const ReadOperation& operation) {
+    if (operation.kind == ReadOperationKind::Block) {
+        return kBlockFixedBytes + kBlockBytesPerWord * operation.register_count;
+    }
+    return kListFixedBytes + kListBytesPerWord * operation.register_count;
+}
+
+std::vector<uint16_t> collectPollAddresses(const std::vector<TinyRegisterRuntimeBinding>& bindings,
+                                           uint8_t refresh_class_mask) {
+    std::vector<uint16_t> addresses;
+    addresses.reserve(bindings.size() + 8);
+    for (const auto& binding : bindings) {
+        if ((refreshClassBit(binding.refresh_class) & refresh_class_mask) == 0) {
+            continue;
+        }
+        const uint8_t words = binding.register_count == 0 ? 1 : binding.register_count;
+        for (uint8_t i = 0; i < words; ++i) {
+            const uint32_t address = static_cast<uint32_t>(binding.register_address) + i;
+            if (address <= 0xFFFF) {
+                addresses.push_back(static_cast<uint16_t>(address));
+            }
+        }
+    }
+    return sortedUnique(std::move(addresses));
+}
+
+ReadPlan buildReadPlan(const std::vector<uint16_t>& addresses, const ReadPlanCostModel& model) {
+    ReadPlan plan{};
+    plan.addresses = sortedUnique(addresses);
+
+    const std::vector<uint16_t>& a = plan.addresses;
+    const size_t n = a.size();
+    if (n == 0) {
+        finalizePlan(plan, model);
+        return plan;
+    }
+
+    const uint8_t max_registers = clampMaxRegisters(model.max_registers_per_read);
+    const uint64_t byte_ns = byteTimeNs(model);
+    const uint64_t overhead_ns = static_cast<uint64_t>(model.transaction_overhead_us) * 1000ULL;
+    constexpr uint64_t kInf = std::numeric_limits<uint64_t>::max();
+
+    // List entries are shared by the whole plan and split every max_registers
+    // entries (appendListOperations), so the DP tracks the fill of the current
+    // list transaction: fill 0 = no list yet, a full list opens a new one.
+    // With at most max_registers addresses a single list always fits, so
+    // "open" is the only fill state needed.
+    const size_t fills = n > max_registers ? static_cast<size_t>(max_registers) + 1 : 2;
+    auto nextFill = [&](size_t fill) -> size_t {
+        if (fill == 0 || fill == max_registers) {
+            return 1;
+        }
+        return std::min(fill + 1, fills - 1);
+    };
+
+    // cost[fill * (n + 1) + i]: cheapest cover of a[0..i) leaving the list at `fill`.
+    std::vector<uint64_t> cost(fills * (n + 1), kInf);
+    std::vector<Step> step(fills * (n + 1));
+    auto at = [n](size_t fill, size_t i) { return fill * (n + 1) + i; };
+    cost[at(0, 0)] = 0;
+
+    auto relax = [&](size_t fill, size_t to, uint64_t value, size_t from, size_t from_fill, bool block) {
+        if (value < cost[at(fill, to)]) {
+            cost[at(fill, to)] = value;
+            step[at(fill, to)] = Step{static_cast<uint32_t>(from), static_cast<uint8_t>(from_fill), block};
+        }
+    };
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t fill = 0; fill < fills; ++fill) {
+            const uint64_t base = cost[at(fill, i)];
+            if (base == kInf) {
+                continue;
+            }
+
+            const size_t list_fill = nextFill(fill);
+            uint64_t list_cost = kListBytesPerWord * byte_ns;
+            if (fill == 0 || fill == max_registers) {
+                list_cost += kListFixedBytes * byte_ns + overhead_ns;
+            }
+            relax(list_fill, i + 1, base + list_cost, i, fill, false);
+
+            for (size_t j = i; j < n; ++j) {
+                const uint32_t span = static_cast<uint32_t>(a[j] - a[i]) + 1U;
+                if (span > max_registers) {
+                    break;
+                }
+                const uint64_t block_cost = (kBlockFixedBytes + kBlockBytesPerWord * span) * byte_ns + overhead_ns;
+                relax(fill, j + 1, base + block_cost, i, fill, true);
+            }
+        }
+    }
+
+    size_t last_fill = 0;
+    for (size_t fill = 1; fill < fills; ++fill) {
+        if (cost[at(fill, n)] < cost[at(last_fill, n)]) {
+            last_fill = fill;
+        }
+    }
+    size_t index = n;
+    std::vector<uint16_t> list_addresses;
+    while (index > 0) {
+        const Step s = step[at(last_fill, index)];
+        if (s.block) {
+            ReadOperation op{};
+            op.kind = ReadOperationKind::Block;
+            op.start_address = a[s.from];
+            op.register_count = static_cast<uint16_t>(a[index - 1] - a[s.from] + 1);
+            plan.operations.push_back(std::move(op));
+        } else {
+            list_addresses.push_back(a[s.from]);
+        }
+        index = s.from;
+        last_fill = s.from_fill;
+    }
+
+    std::reverse(plan.operations.begin(), plan.operations.end());
+    std::reverse(list_addresses.begin(), list_addresses.end());
+    appendListOperations(plan, list_addresses, max_registers);
+
+    finalizePlan(plan, model);
+    return plan;
+}
+
+ReadPlan buildReadPlanFromMapping(const ReadPlanCostModel& model, uint8_t refresh_class_mask) {
+    ReadPlan plan = buildReadPlan(collectPollAddresses(getTinyRegisterBindings(), refresh_class_mask), model);
+    plan.mapping_version = getTinyReadMappingVersion();
+    return plan;
+}
+
+ReadPlan buildSingleListPlan(const std::vector<uint16_t>& addresses, const ReadPlanCostModel& model) {
+    ReadPlan plan{};
+    plan.addresses = sortedUnique(addresses);
+    appendListOperations(plan, plan.addresses, clampMaxRegisters(model.max_registers_per_read));
+    finalizePlan(plan, model);
+    return plan;
+}
+
+} // namespace tinybms
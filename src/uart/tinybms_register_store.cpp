@@ -0,0 +1,144 @@
+#include "uart/tinybms_register_store.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "uart/tinybms_read_planner.h"
+
+namespace tinybms {
+
+void RegisterStore::configure(const std::vector<uint16_t>& addresses, uint16_t max_gap) {
+    // Keep the words of addresses that survive the new layout.
+    std::vector<std::pair<uint16_t, uint16_t>> kept;
+    for (const Window& window : windows_) {
+        for (uint16_t i = 0; i < window.count; ++i) {
+            const size_t slot = static_cast<size_t>(window.offset) + i;
+            if (isValid(slot)) {
+                kept.emplace_back(static_cast<uint16_t>(window.start + i), values_[slot]);
+            }
+        }
+    }
+
+    windows_.clear();
+    size_t slots = 0;
+    for (uint16_t address : addresses) {
+        if (!windows_.empty()) {
+            Window& last = windows_.back();
+            const uint32_t end = static_cast<uint32_t>(last.start) + last.count;   // one past the last address
+            if (address < end) {
+                continue;   // duplicate
+            }
+            if (address - end <= max_gap) {
+                const uint16_t grown = static_cast<uint16_t>(address - last.start + 1U);
+                slots += grown - last.count;
+                last.count = grown;
+                continue;
+            }
+        }
+        Window window;
+        window.start = address;
+        window.count = 1;
+        window.offset = static_cast<uint16_t>(slots);
+        windows_.push_back(window);
+        slots++;
+    }
+
+    values_.assign(slots, 0);
+    valid_.assign((slots + 31U) / 32U, 0);
+    layout_generation_++;
+    for (const auto& word : kept) {
+        set(word.first, word.second);
+    }
+}
+
+bool RegisterStore::ensureLayout(const std::vector<TinyRegisterRuntimeBinding>& bindings, uint32_t mapping_version) {
+    if (mapping_version == mapping_version_ && !windows_.empty()) {
+        return false;
+    }
+    configure(collectPollAddresses(bindings));
+    mapping_version_ = mapping_version;
+    return true;
+}
+
+size_t RegisterStore::slotOf(uint16_t address) const {
+    // A handful of windows: a linear scan beats a binary search here.
+    for (const Window& window : windows_) {
+        const uint16_t index = static_cast<uint16_t>(address - window.start);
+        if (index < window.count) {
+            return static_cast<size_t>(window.offset) + index;
+        }
+    }
+    return kNoSlot;
+}
+
+bool RegisterStore::get(uint16_t address, uint16_t& value) const {
+    const size_t slot = slotOf(address);
+    if (slot == kNoSlot || !isValid(slot)) {
+        return false;
+    }
+    value = values_[slot];
+    return true;
+}
+
+bool RegisterStore::slotsValid(size_t slot, size_t count) const {
+    if (slot + count > values_.size()) {
+        return false;
+    }
+    if (count == 1) {
+        return isValid(slot);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!isValid(slot + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RegisterStore::set(uint16_t address, uint16_t value) {
+    const size_t slot = slotOf(address);
+    if (slot == kNoSlot) {
+        return false;
+    }
+    values_[slot] = value;
+    markValid(slot);
+    return true;
+}
+
+size_t RegisterStore::setRange(uint16_t start_address, const uint16_t* words, size_t count) {
+    if (words == nullptr || count == 0) {
+        return 0;
+    }
+    const uint32_t first = start_address;
+    const uint32_t last = first + static_cast<uint32_t>(count);   // exclusive
+    size_t stored = 0;
+    for (const Window& window : windows_) {
+        const uint32_t window_end = static_cast<uint32_t>(window.start) + window.count;
+        const uint32_t from = std::max<uint32_t>(first, window.start);
+        const uint32_t to = std::min(last, window_end);
+        if (from >= to) {
+            continue;
+        }
+        const size_t slot = static_cast<size_t>(window.offset) + (from - window.start);
+        std::copy(words + (from - first), words + (to - first), values_.begin() + slot);
+        for (size_t i = 0; i < to - from; ++i) {
+            markValid(slot + i);
+        }
+        stored += to - from;
+    }
+    return stored;
+}
+
+void RegisterStore::invalidate() {
+    std::fill(valid_.begin(), valid_.end(), 0);
+}
+
+size_t RegisterStore::validCount() const {
+    size_t count = 0;
+    for (uint32_t bits : valid_) {
+        count += static_cast<size_t>(__builtin_popcount(bits));
+    }
+    return count;
+}
+
+} // namespace tinybms
@@ -0,0 +1,91 @@
+#include "uart/tinybms_report_filter.h"
+
+#include <cmath>
+
+namespace tinybms {
+namespace {
+
+uint32_t hashWords(const uint16_t* words, uint8_t word_count) {
+    uint32_t hash = 2166136261u;   // FNV-1a
+    for (uint8_t i = 0; i < word_count; ++i) {
+        hash = (hash ^ (words[i] & 0xFFu)) * 16777619u;
+        hash = (hash ^ (words[i] >> 8)) * 16777619u;
+    }
+    return hash;
+}
+
+} // namespace
+
+ReportPolicy reportPolicyFor(const TinyRegisterRuntimeBinding& binding) {
+    ReportPolicy policy;
+    if (binding.metadata != nullptr) {
+        policy.deadband = binding.metadata->report_deadband;
+        policy.percent = binding.metadata->report_deadband_percent;
+        policy.heartbeat_ms = binding.metadata->report_heartbeat_ms;
+    }
+    return policy;
+}
+
+void ReportFilter::bind(uint32_t generation, size_t steps) {
+    if (generation != generation_ || states_.size() != steps) {
+        states_.assign(steps, State{});
+        generation_ = generation;
+    }
+}
+
+bool ReportFilter::admit(size_t step,
+                         const ReportPolicy& policy,
+                         float scaled_value,
+                         const uint16_t* words,
+                         uint8_t word_count,
+                         uint32_t now_ms) {
+    if (step >= states_.size()) {
+        return true;
+    }
+    State& state = states_[step];
+    const uint32_t words_hash = hashWords(words, word_count);
+
+    bool report = !state.reported || policy.deadband < 0.0f;
+    if (!report && policy.heartbeat_ms > 0 && now_ms - state.reported_ms >= policy.heartbeat_ms) {
+        report = true;
+    }
+    if (!report) {
+        if (policy.deadband == 0.0f) {
+            report = words_hash != state.words_hash;
+        } else {
+            const float band = policy.percent ? std::fabs(state.scaled) * policy.deadband / 100.0f : policy.deadband;
+            report = std::fabs(scaled_value - state.scaled) > band;
+        }
+    }
+
+    if (!report) {
+        stats_.suppressed++;
+    }
+    return report;
+}
+
+void ReportFilter::commit(size_t step, float scaled_value, const uint16_t* words, uint8_t word_count, uint32_t now_ms) {
+    stats_.reported++;
+    if (step >= states_.size()) {
+        return;
+    }
+    State& state = states_[step];
+    state.reported = true;
+    state.scaled = scaled_value;
+    state.words_hash = hashWords(words, word_count);
+    state.reported_ms = now_ms;
+}
+
+void ReportFilter::forceNext() {
+    for (State& state : states_) {
+        state.reported = false;
+    }
+}
+
+void ReportFilter::forceNext(size_t step) {
+    if (step < states_.size()) {
+        states_[step].reported = false;
+    }
+}
+
+} // namespace tinybms
@@ -0,0 +1,222 @@
+#include "uart/tinybms_transaction_queue.h"
+
+#include <Arduino.h>
+#include <algorithm>
+#include <chrono>
+
+namespace tinybms {
+namespace {
+
+size_t indexOf(TransactionPriority priority) {
+    const size_t index = static_cast<size_t>(priority);
+    return index < kTransactionPriorityCount ? index : kTransactionPriorityCount - 1;
+}
+
+bool deadlinePassed(uint32_t deadline_ms, uint32_t now_ms) {
+    return deadline_ms != 0 && static_cast<int32_t>(now_ms - deadline_ms) > 0;
+}
+
+bool isFinished(TransactionOutcome outcome) {
+    return outcome != TransactionOutcome::Pending && outcome != TransactionOutcome::Running;
+}
+
+} // namespace
+
+const char* transactionPriorityName(TransactionPriority priority) {
+    switch (priority) {
+        case TransactionPriority::LivePoll:    return "live_poll";
+        case TransactionPriority::Alarm:       return "alarm";
+        case TransactionPriority::ConfigWrite: return "config_write";
+        case TransactionPriority::ConfigRead:  return "config_read";
+    }
+    return "unknown";
+}
+
+// ---------------------------------------------------------------------------
+// TransactionTicket
+// ---------------------------------------------------------------------------
+bool TransactionTicket::wait(uint32_t timeout_ms) const {
+    if (!state_) {
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    return state_->done_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]() {
+        return isFinished(state_->outcome);
+    });
+}
+
+bool TransactionTicket::cancel() {
+    if (!state_ || state_->owner == nullptr) {
+        return false;
+    }
+    return state_->owner->cancel(state_);
+}
+
+TransactionOutcome TransactionTicket::outcome() const {
+    if (!state_) {
+        return TransactionOutcome::Rejected;
+    }
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->outcome;
+}
+
+TransactionResult TransactionTicket::result() const {
+    if (!state_) {
+        return TransactionResult{};
+    }
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->result;
+}
+
+// ---------------------------------------------------------------------------
+// TransactionQueue
+// ---------------------------------------------------------------------------
+TransactionQueue::TransactionQueue(size_t max_depth_per_priority)
+    : max_depth_(std::max<size_t>(1, max_depth_per_priority)) {}
+
+TransactionTicket TransactionQueue::submit(TransactionJob job) {
+    auto state = std::make_shared<detail::TransactionState>();
+    const size_t index = indexOf(job.priority);
+    state->job = std::move(job);
+    state->enqueued_ms = millis();
+    state->owner = this;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TransactionQueueStats& stats = stats_[index];
+        stats.submitted++;
+        if (queues_[index].size() < max_depth_) {
+            queues_[index].push_back(state);
+            stats.depth = static_cast<uint32_t>(queues_[index].size());
+            stats.depth_max = std::max(stats.depth_max, stats.depth);
+            work_cv_.notify_one();
+            return TransactionTicket(state);
+        }
+        stats.rejected++;
+    }
+
+    finish(state, TransactionOutcome::Rejected, TransactionResult{});
+    return TransactionTicket(state);
+}
+
+bool TransactionQueue::runNext(uint32_t wait_ms) {
+    StatePtr state;
+    size_t index = 0;
+    bool expired = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto has_work = [this]() {
+            for (const auto& queue : queues_) {
+                if (!queue.empty()) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        if (!work_cv_.wait_for(lock, std::chrono::milliseconds(wait_ms), has_work)) {
+            return false;
+        }
+
+        for (index = 0; index < kTransactionPriorityCount; ++index) {
+            if (!queues_[index].empty()) {
+                state = queues_[index].front();
+                queues_[index].pop_front();
+                stats_[index].depth = static_cast<uint32_t>(queues_[index].size());
+                break;
+            }
+        }
+        if (!state) {
+            return false;
+        }
+
+        const uint32_t now = millis();
+        if (deadlinePassed(state->job.deadline_ms, now)) {
+            stats_[index].expired++;
+            expired = true;
+        } else {
+            TransactionQueueStats& stats = stats_[index];
+            const uint32_t waited = now - state->enqueued_ms;
+            stats.wait_ms_last = waited;
+            stats.wait_ms_max = std::max(stats.wait_ms_max, waited);
+            wait_samples_[index]++;
+            stats.wait_ms_avg += (static_cast<float>(waited) - stats.wait_ms_avg) /
+                                 static_cast<float>(wait_samples_[index]);
+            std::lock_guard<std::mutex> state_lock(state->mutex);
+            state->outcome = TransactionOutcome::Running;
+        }
+    }
+
+    if (expired) {
+        finish(state, TransactionOutcome::Expired, TransactionResult{});
+        return true;
+    }
+
+    TransactionResult result{};
+    if (state->job.run) {
+        result = state->job.run();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_[index].completed++;
+        if (!result.success) {
+            stats_[index].failed++;
+        }
+    }
+    finish(state, TransactionOutcome::Completed, result);
+    return true;
+}
+
+size_t TransactionQueue::depth(TransactionPriority priority) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queues_[indexOf(priority)].size();
+}
+
+TransactionQueueStats TransactionQueue::stats(TransactionPriority priority) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_[indexOf(priority)];
+}
+
+void TransactionQueue::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < kTransactionPriorityCount; ++i) {
+        stats_[i] = TransactionQueueStats{};
+        stats_[i].depth = static_cast<uint32_t>(queues_[i].size());
+        stats_[i].depth_max = stats_[i].depth;
+        wait_samples_[i] = 0;
+    }
+}
+
+bool TransactionQueue::cancel(const StatePtr& state) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const size_t index = indexOf(state->job.priority);
+        auto& queue = queues_[index];
+        auto it = std::find(queue.begin(), queue.end(), state);
+        if (it == queue.end()) {
+            return false;   // already running or finished
+        }
+        queue.erase(it);
+        stats_[index].depth = static_cast<uint32_t>(queue.size());
+        stats_[index].cancelled++;
+    }
+    finish(state, TransactionOutcome::Cancelled, TransactionResult{});
+    return true;
+}
+
+void TransactionQueue::finish(const StatePtr& state, TransactionOutcome outcome, const TransactionResult& result) {
+    TransactionCompletion callback;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->outcome = outcome;
+        state->result = result;
+        callback = std::move(state->job.on_complete);
+        state->job.run = nullptr;   // release captures early
+    }
+    state->done_cv.notify_all();
+    if (callback) {
+        callback(outcome, result);
+    }
+}
+
+} // namespace tinybms
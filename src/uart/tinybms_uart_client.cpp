@@ -1,4 +1,6 @@
 #include "uart/tinybms_uart_client.h"
+#include "uart/tinybms_crc.h"
+#include "uart/tinybms_frame_parser.h"
 
 #include <algorithm>
 #include <array>
@@ -17,18 +19,7 @@ constexpr uint8_t CMD_NACK        = 0x81;
 constexpr size_t MAX_FRAME_SIZE = 256;
 
 uint16_t modbusCRC16(const uint8_t* data, size_t length) {
-    uint16_t crc = 0xFFFF;
-    for (size_t i = 0; i < length; ++i) {
-        crc ^= data[i];
-        for (uint8_t bit = 0; bit < 8; ++bit) {
-            if (crc & 0x0001) {
-                crc = (crc >> 1) ^ 0xA001;
-            } else {
-                crc >>= 1;
-            }
-        }
-    }
-    return crc;
+    return tinybms::crc::compute(data, length);
 }
 
 void performDelay(const tinybms::DelayConfig& delay, uint32_t delay_ms) {
@@ -37,25 +28,140 @@ void performDelay(const tinybms::DelayConfig& delay, uint32_t delay_ms) {
     }
 }
 
-using ResponseValidator = std::function<tinybms::AttemptStatus(const uint8_t*, size_t)>;
+using ResponseValidator = std::function<tinybms::AttemptStatus(const tinybms::FrameView&)>;
+
+constexpr size_t RX_CHUNK_SIZE = 64;
+constexpr size_t RX_BYTE_BUDGET = MAX_FRAME_SIZE * 2; // bounds a single attempt on a babbling line
+
+void drainInput(hal::IHalUart& uart) {
+    while (uart.available() > 0) {
+        uart.read();
+    }
+}
+
+/**
+ * Times one attempt when the caller supplied a clock and an attempt sink.
+ */
+class AttemptTimer {
+public:
+    AttemptTimer(const tinybms::DelayConfig& delay, uint8_t command)
+        : delay_(delay),
+          enabled_(delay.clock_us_fn != nullptr && delay.attempt_fn != nullptr),
+          command_(command) {}
+
+    void start(uint8_t attempt) {
+        if (!enabled_) {
+            return;
+        }
+        timing_ = tinybms::AttemptTiming{};
+        timing_.command = command_;
+        timing_.attempt = attempt;
+        sent_us_ = now();
+    }
+
+    bool awaitingFirstByte() const { return enabled_ && !timing_.received; }
+
+    void chunkReceived() {
+        if (!enabled_) {
+            return;
+        }
+        last_us_ = now();
+        if (!timing_.received) {
+            timing_.received = true;
+            first_us_ = last_us_;
+            timing_.first_byte_us = first_us_ - sent_us_;
+        }
+    }
+
+    void finish(tinybms::AttemptStatus status) {
+        if (!enabled_) {
+            return;
+        }
+        timing_.status = status;
+        timing_.transfer_us = timing_.received ? last_us_ - first_us_ : 0;
+        timing_.total_us = now() - sent_us_;
+        delay_.attempt_fn(timing_, delay_.context);
+    }
+
+private:
+    uint32_t now() const { return delay_.clock_us_fn(delay_.context); }
+
+    const tinybms::DelayConfig& delay_;
+    const bool enabled_;
+    const uint8_t command_;
+    tinybms::AttemptTiming timing_{};
+    uint32_t sent_us_ = 0;
+    uint32_t first_us_ = 0;
+    uint32_t last_us_ = 0;
+};
+
+/**
+ * Pull bytes into the parser until a frame validates or the UART times out.
+ * Reads never exceed parser.bytesNeeded(), so they stay frame-aligned.
+ *
+ * With a clock, `timeout_ms` bounds the whole attempt: each read only gets
+ * the time left. Without one, each read gets the full timeout and only the
+ * byte budget bounds the attempt.
+ */
+void receiveFrame(hal::IHalUart& uart,
+                  tinybms::FrameParser& parser,
+                  AttemptTimer& timer,
+                  const tinybms::DelayConfig& delay,
+                  uint32_t timeout_ms) {
+    std::array<uint8_t, RX_CHUNK_SIZE> chunk{};
+    size_t budget = RX_BYTE_BUDGET;
+    const bool bounded = delay.clock_us_fn != nullptr;
+    const uint32_t start_us = bounded ? delay.clock_us_fn(delay.context) : 0;
+    uart.setTimeout(timeout_ms);
+
+    while (!parser.frameReady() && budget > 0) {
+        if (bounded) {
+            const uint32_t elapsed_ms = (delay.clock_us_fn(delay.context) - start_us) / 1000U;
+            if (elapsed_ms >= timeout_ms) {
+                return;
+            }
+            uart.setTimeout(timeout_ms - elapsed_ms);
+        }
+        // readBytes() waits for the whole request: when timing, ask for a
+        // single byte first so the first chunk really marks the first byte.
+        const size_t limit = timer.awaitingFirstByte() ? 1 : chunk.size();
+        const size_t wanted = std::min({parser.bytesNeeded(), limit, budget});
+        const size_t received = uart.readBytes(chunk.data(), wanted);
+        if (received == 0) {
+            return;
+        }
+        timer.chunkReceived();
+        budget -= received;
+        parser.feed(chunk.data(), received);
+    }
+}
 
 tinybms::TransactionResult performTransaction(hal::IHalUart& uart,
                                               const uint8_t* request,
                                               size_t request_len,
-                                              size_t expected_response_len,
+                                              const tinybms::FrameParser::Expectation& expectation,
                                               const tinybms::TransactionOptions& options,
                                               const tinybms::DelayConfig& delay,
                                               const ResponseValidator& validator) {
     tinybms::TransactionResult result{};
 
-    if (request == nullptr || request_len == 0 || expected_response_len > MAX_FRAME_SIZE) {
+    if (request == nullptr || request_len == 0 ||
+        3U + expectation.payload_length + 2U > MAX_FRAME_SIZE) {
         result.last_status = tinybms::AttemptStatus::ProtocolError;
         return result;
     }
 
+    const uint8_t command = request_len > 1 ? request[1] : 0;
+    uint32_t response_timeout_ms = options.response_timeout_ms;
+    uint32_t retry_delay_ms = options.retry_delay_ms;
+    if (delay.tune_fn) {
+        const size_t response_bytes = 3U + expectation.payload_length + 2U;
+        delay.tune_fn(command, response_bytes, response_timeout_ms, retry_delay_ms, delay.context);
+    }
+
     const uint8_t attempts = std::max<uint8_t>(1, options.attempt_count);
     const uint32_t previous_timeout = uart.getTimeout();
-    uart.setTimeout(options.response_timeout_ms);
+    uart.setTimeout(response_timeout_ms);
 
     if (options.send_wakeup_pulse) {
         size_t warmup_written = uart.write(request, request_len);
@@ -64,50 +170,53 @@ tinybms::TransactionResult performTransaction(hal::IHalUart& uart,
             result.write_error_count++;
         }
         performDelay(delay, options.wakeup_delay_ms);
-        while (uart.available() > 0) {
-            uart.read();
-        }
+        drainInput(uart);
     }
 
-    std::array<uint8_t, MAX_FRAME_SIZE> response{};
+    tinybms::FrameParser parser;
+    AttemptTimer timer(delay, command);
     bool success = false;
 
     for (uint8_t attempt = 0; attempt < attempts; ++attempt) {
         if (attempt > 0) {
             result.retries_performed++;
-            performDelay(delay, options.retry_delay_ms);
+            performDelay(delay, retry_delay_ms);
         }
 
-        while (uart.available() > 0) {
-            uart.read();
-        }
+        drainInput(uart);
 
         size_t written = uart.write(request, request_len);
         uart.flush();
+        timer.start(attempt);
         if (written != request_len) {
             result.write_error_count++;
             result.last_status = tinybms::AttemptStatus::WriteError;
+            timer.finish(result.last_status);
             continue;
         }
 
-        size_t received = uart.readBytes(response.data(), expected_response_len);
-        if (received != expected_response_len) {
-            result.timeout_count++;
-            result.last_status = tinybms::AttemptStatus::Timeout;
-            continue;
-        }
+        parser.reset(expectation);
+        const uint32_t crc_errors_before = parser.stats().crc_errors;
+        receiveFrame(uart, parser, timer, delay, response_timeout_ms);
+        const uint32_t crc_errors = parser.stats().crc_errors - crc_errors_before;
+        result.crc_error_count += crc_errors;
 
-        const uint16_t resp_crc = static_cast<uint16_t>(response[received - 2]) |
-                                  (static_cast<uint16_t>(response[received - 1]) << 8);
-        const uint16_t calc_crc = modbusCRC16(response.data(), received - 2);
-        if (resp_crc != calc_crc) {
-            result.crc_error_count++;
-            result.last_status = tinybms::AttemptStatus::CrcMismatch;
+        if (!parser.frameReady()) {
+            parser.abandonPartialFrame();
+            if (crc_errors > 0) {
+                result.last_status = tinybms::AttemptStatus::CrcMismatch;
+            } else {
+                result.timeout_count++;
+                result.last_status = tinybms::AttemptStatus::Timeout;
+                result.first_attempt_timed_out |= attempt == 0;
+            }
+            timer.finish(result.last_status);
             continue;
         }
 
-        tinybms::AttemptStatus status = validator(response.data(), received - 2);
+        tinybms::AttemptStatus status = validator(parser.frame());
         result.last_status = status;
+        timer.finish(status);
         if (status == tinybms::AttemptStatus::Success) {
             success = true;
             break;
@@ -120,6 +229,11 @@ tinybms::TransactionResult performTransaction(hal::IHalUart& uart,
         result.last_status = tinybms::AttemptStatus::ProtocolError;
     }
 
+    const tinybms::FrameParserStats& parser_stats = parser.stats();
+    result.garbage_bytes = parser_stats.garbage_bytes;
+    result.resync_count = parser_stats.resync_count;
+    result.partial_frame_count = parser_stats.partial_frames;
+
     return result;
 }
 
@@ -166,8 +280,9 @@ TransactionResult readRegisterBlock(hal::IHalUart& uart,
         return result;
     }
 
-    auto validator = [output, register_count, expected_data_bytes](const uint8_t* data, size_t length_without_crc) {
-        if (length_without_crc != 3 + expected_data_bytes) {
+    auto validator = [output, register_count, expected_data_bytes](const FrameView& frame) {
+        const uint8_t* data = frame.data;
+        if (frame.length != 3 + expected_data_bytes) {
             return AttemptStatus::ProtocolError;
         }
         if (data[0] != TINYBMS_PREAMBLE || data[1] != CMD_READ_BLOCK) {
@@ -184,7 +299,11 @@ TransactionResult readRegisterBlock(hal::IHalUart& uart,
         return AttemptStatus::Success;
     };
 
-    result = performTransaction(uart, request.data(), frame_len, expected_response_len, options, delay, validator);
+    FrameParser::Expectation expectation{};
+    expectation.command = CMD_READ_BLOCK;
+    expectation.payload_length = static_cast<uint16_t>(expected_data_bytes);
+
+    result = performTransaction(uart, request.data(), frame_len, expectation, options, delay, validator);
     return result;
 }
 
@@ -232,8 +351,9 @@ TransactionResult readIndividualRegisters(hal::IHalUart& uart,
         return result;
     }
 
-    auto validator = [output, address_count, payload_len](const uint8_t* data, size_t length_without_crc) {
-        if (length_without_crc != 3 + payload_len) {
+    auto validator = [output, address_count, payload_len](const FrameView& frame) {
+        const uint8_t* data = frame.data;
+        if (frame.length != 3 + payload_len) {
             return AttemptStatus::ProtocolError;
         }
         if (data[0] != TINYBMS_PREAMBLE || data[1] != CMD_READ_LIST) {
@@ -250,7 +370,11 @@ TransactionResult readIndividualRegisters(hal::IHalUart& uart,
         return AttemptStatus::Success;
     };
 
-    result = performTransaction(uart, request.data(), frame_len, expected_response_len, options, delay, validator);
+    FrameParser::Expectation expectation{};
+    expectation.command = CMD_READ_LIST;
+    expectation.payload_length = static_cast<uint16_t>(payload_len);
+
+    result = performTransaction(uart, request.data(), frame_len, expectation, options, delay, validator);
     return result;
 }
 
@@ -292,10 +416,9 @@ TransactionResult writeRegisterBlock(hal::IHalUart& uart,
     request[frame_len_no_crc]     = static_cast<uint8_t>(crc & 0xFF);
     request[frame_len_no_crc + 1] = static_cast<uint8_t>((crc >> 8) & 0xFF);
 
-    constexpr size_t expected_response_len = 5; // AA 01 STATUS CRC_L CRC_H
-
-    auto validator = [](const uint8_t* data, size_t length_without_crc) {
-        if (length_without_crc != 3) {
+    auto validator = [](const FrameView& frame) {
+        const uint8_t* data = frame.data;
+        if (frame.length != 3) {
             return AttemptStatus::ProtocolError;
         }
         if (data[0] != TINYBMS_PREAMBLE) {
@@ -310,7 +433,8 @@ TransactionResult writeRegisterBlock(hal::IHalUart& uart,
         return AttemptStatus::ProtocolError;
     };
 
-    result = performTransaction(uart, request.data(), frame_len, expected_response_len, options, delay, validator);
+    // Reply is AA 01 STATUS CRC_L CRC_H (or a NACK): no length-prefixed command expected.
+    result = performTransaction(uart, request.data(), frame_len, FrameParser::Expectation{}, options, delay, validator);
     return result;
 }
 
@@ -352,10 +476,9 @@ TransactionResult writeIndividualRegisters(hal::IHalUart& uart,
     request[frame_len_no_crc]     = static_cast<uint8_t>(crc & 0xFF);
     request[frame_len_no_crc + 1] = static_cast<uint8_t>((crc >> 8) & 0xFF);
 
-    constexpr size_t expected_response_len = 5; // AA 01 STATUS CRC_L CRC_H
-
-    auto validator = [](const uint8_t* data, size_t length_without_crc) {
-        if (length_without_crc != 3) {
+    auto validator = [](const FrameView& frame) {
+        const uint8_t* data = frame.data;
+        if (frame.length != 3) {
             return AttemptStatus::ProtocolError;
         }
         if (data[0] != TINYBMS_PREAMBLE) {
@@ -370,7 +493,8 @@ TransactionResult writeIndividualRegisters(hal::IHalUart& uart,
         return AttemptStatus::ProtocolError;
     };
 
-    result = performTransaction(uart, request.data(), frame_len, expected_response_len, options, delay, validator);
+    // Reply is AA 01 STATUS CRC_L CRC_H (or a NACK): no length-prefixed command expected.
+    result = performTransaction(uart, request.data(), frame_len, FrameParser::Expectation{}, options, delay, validator);
     return result;
 }
 
@@ -0,0 +1,256 @@
+#include "uart/tinybms_uart_trace.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace tinybms {
+namespace {
+
+constexpr uint8_t kMagic[4] = {'T', 'B', 'U', 'T'};
+constexpr size_t kHeaderSize = sizeof(kMagic) + 1;
+
+void putVarint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool getVarint(const uint8_t* data, size_t length, size_t& offset, uint32_t& value) {
+    value = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7) {
+        if (offset >= length) {
+            return false;
+        }
+        const uint8_t byte = data[offset++];
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void putHeader(std::vector<uint8_t>& out) {
+    out.insert(out.end(), kMagic, kMagic + sizeof(kMagic));
+    out.push_back(kUartTraceVersion);
+}
+
+void putRecord(std::vector<uint8_t>& out, const UartTraceEvent& event, uint32_t delta_ms) {
+    out.push_back(static_cast<uint8_t>(event.direction));
+    putVarint(out, delta_ms);
+    putVarint(out, static_cast<uint32_t>(event.bytes.size()));
+    out.insert(out.end(), event.bytes.begin(), event.bytes.end());
+}
+
+bool isTraceNameChar(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+           c == '.' || c == '_' || c == '-';
+}
+
+} // namespace
+
+bool isUartTracePath(const std::string& path) {
+    constexpr size_t kMaxSpiffsName = 31;
+    const size_t prefix = std::strlen(kUartTraceDirectory);
+    if (path.size() <= prefix || path.size() > kMaxSpiffsName || path.compare(0, prefix, kUartTraceDirectory) != 0) {
+        return false;
+    }
+    return std::all_of(path.begin() + prefix, path.end(), isTraceNameChar);
+}
+
+UartTraceRecorder::UartTraceRecorder(size_t flush_threshold, size_t max_trace_bytes, size_t max_buffered_bytes)
+    : flush_threshold_(flush_threshold), max_trace_bytes_(max_trace_bytes), max_buffered_bytes_(max_buffered_bytes) {}
+
+bool UartTraceRecorder::start(hal::IHalStorage& storage, const std::string& path, uint32_t now_ms) {
+    if (!isUartTracePath(path) || storage.type() == hal::StorageType::NVS) {
+        return false;
+    }
+    stop();
+    std::lock_guard<std::mutex> lock(mutex_);
+    file_ = storage.open(path, hal::StorageOpenMode::Write);
+    if (!file_ || !file_->isOpen()) {
+        file_.reset();
+        return false;
+    }
+    path_ = path;
+    stats_ = UartTraceRecorderStats{};
+    encoded_.clear();
+    putHeader(encoded_);
+    record_open_ = false;
+    last_record_ms_ = now_ms;
+    recording_.store(true);
+    return true;
+}
+
+void UartTraceRecorder::stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    recording_.store(false);
+    if (!file_) {
+        return;
+    }
+    closeRecordLocked();
+    flushLocked();
+    if (file_) {
+        file_->close();
+        file_.reset();
+    }
+}
+
+bool UartTraceRecorder::active() const {
+    return recording_.load();
+}
+
+void UartTraceRecorder::record(UartTraceDirection direction,
+                               uint32_t now_ms,
+                               const uint8_t* data,
+                               size_t length) {
+    if (data == nullptr || length == 0 || !recording_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!file_) {
+        return;
+    }
+
+    if (record_open_ &&
+        (open_record_.direction != direction || open_record_.timestamp_ms != now_ms)) {
+        closeRecordLocked();
+    }
+    const size_t buffered = encoded_.size() + (record_open_ ? open_record_.bytes.size() : 0);
+    if (buffered + length > max_buffered_bytes_) {
+        stats_.dropped_bytes += static_cast<uint32_t>(length);
+        return;
+    }
+    if (!record_open_) {
+        open_record_.direction = direction;
+        open_record_.timestamp_ms = now_ms;
+        open_record_.bytes.clear();
+        record_open_ = true;
+    }
+    open_record_.bytes.insert(open_record_.bytes.end(), data, data + length);
+    if (direction == UartTraceDirection::Tx) {
+        stats_.tx_bytes += static_cast<uint32_t>(length);
+    } else {
+        stats_.rx_bytes += static_cast<uint32_t>(length);
+    }
+}
+
+bool UartTraceRecorder::flushIfDue() {
+    if (!recording_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!file_ || encoded_.size() + (record_open_ ? open_record_.bytes.size() : 0) < flush_threshold_) {
+        return false;
+    }
+    closeRecordLocked();
+    flushLocked();
+    return true;
+}
+
+void UartTraceRecorder::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!file_) {
+        return;
+    }
+    closeRecordLocked();
+    flushLocked();
+}
+
+std::string UartTraceRecorder::path() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return path_;
+}
+
+UartTraceRecorderStats UartTraceRecorder::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void UartTraceRecorder::closeRecordLocked() {
+    if (!record_open_) {
+        return;
+    }
+    putRecord(encoded_, open_record_, open_record_.timestamp_ms - last_record_ms_);
+    last_record_ms_ = open_record_.timestamp_ms;
+    record_open_ = false;
+    stats_.events++;
+}
+
+void UartTraceRecorder::flushLocked() {
+    if (encoded_.empty()) {
+        return;
+    }
+    if (stats_.trace_bytes + encoded_.size() > max_trace_bytes_) {
+        // Keep what fits on flash rather than a half-written record.
+        encoded_.clear();
+        stats_.truncated = true;
+        recording_.store(false);
+        file_->close();
+        file_.reset();
+        return;
+    }
+    const size_t written = file_->write(encoded_.data(), encoded_.size());
+    if (written != encoded_.size()) {
+        stats_.write_errors++;
+    }
+    stats_.trace_bytes += static_cast<uint32_t>(written);
+    encoded_.clear();
+}
+
+std::vector<uint8_t> encodeUartTrace(const std::vector<UartTraceEvent>& events) {
+    std::vector<uint8_t> out;
+    putHeader(out);
+    uint32_t previous_ms = 0;
+    for (const auto& event : events) {
+        putRecord(out, event, event.timestamp_ms - previous_ms);
+        previous_ms = event.timestamp_ms;
+    }
+    return out;
+}
+
+bool decodeUartTrace(const uint8_t* data, size_t length, std::vector<UartTraceEvent>& events) {
+    events.clear();
+    if (data == nullptr || length < kHeaderSize ||
+        !std::equal(kMagic, kMagic + sizeof(kMagic), data) ||
+        data[sizeof(kMagic)] != kUartTraceVersion) {
+        return false;
+    }
+
+    size_t offset = kHeaderSize;
+    uint32_t timestamp_ms = 0;
+    while (offset < length) {
+        const uint8_t direction = data[offset++];
+        uint32_t delta_ms = 0;
+        uint32_t size = 0;
+        if (direction > static_cast<uint8_t>(UartTraceDirection::Rx) ||
+            !getVarint(data, length, offset, delta_ms) ||
+            !getVarint(data, length, offset, size) ||
+            size > length - offset) {
+            return false;
+        }
+        timestamp_ms += delta_ms;
+        UartTraceEvent event;
+        event.timestamp_ms = timestamp_ms;
+        event.direction = static_cast<UartTraceDirection>(direction);
+        event.bytes.assign(data + offset, data + offset + size);
+        offset += size;
+        events.push_back(std::move(event));
+    }
+    return true;
+}
+
+bool loadUartTrace(hal::IHalStorage& storage, const std::string& path, std::vector<UartTraceEvent>& events) {
+    auto file = storage.open(path, hal::StorageOpenMode::Read);
+    if (!file || !file->isOpen()) {
+        return false;
+    }
+    std::vector<uint8_t> buffer(file->size());
+    const size_t read = buffer.empty() ? 0 : file->read(buffer.data(), buffer.size());
+    file->close();
+    return decodeUartTrace(buffer.data(), read, events);
+}
+
+} // namespace tinybms
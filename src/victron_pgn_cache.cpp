@@ -0,0 +1,95 @@
+#include "victron_pgn_cache.h"
+
+#include <cstring>
+
+namespace tinybms {
+
+void PgnCacheKey::append(const void* data, size_t length) {
+    if (overflowed_ || length > kCapacity - size_) {
+        overflowed_ = true;
+        return;
+    }
+    std::memcpy(bytes_ + size_, data, length);
+    size_ = static_cast<uint8_t>(size_ + length);
+}
+
+PgnCacheKey& PgnCacheKey::add(uint32_t value) {
+    append(&value, sizeof(value));
+    return *this;
+}
+
+PgnCacheKey& PgnCacheKey::add(float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return add(bits);
+}
+
+PgnCacheKey& PgnCacheKey::addText(const char* text, size_t length) {
+    const uint8_t prefix = length > 0xFF ? 0xFF : static_cast<uint8_t>(length);
+    append(&prefix, sizeof(prefix));
+    if (length > 0xFF) {
+        overflowed_ = true;
+    } else if (length > 0) {
+        append(text, length);
+    }
+    return *this;
+}
+
+bool PgnCacheKey::operator==(const PgnCacheKey& other) const {
+    if (overflowed_ || other.overflowed_ || size_ != other.size_) {
+        return false;
+    }
+    return std::memcmp(bytes_, other.bytes_, size_) == 0;
+}
+
+PgnPayloadCache::Entry& PgnPayloadCache::entryFor(uint16_t pgn) {
+    for (Entry& entry : entries_) {
+        if (entry.stats.pgn == pgn) {
+            return entry;
+        }
+    }
+    Entry entry{};
+    entry.stats.pgn = pgn;
+    entries_.push_back(entry);
+    return entries_.back();
+}
+
+bool PgnPayloadCache::lookup(uint16_t pgn, const PgnCacheKey& key, uint8_t* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entryFor(pgn);
+    if (!entry.valid || entry.key != key) {
+        ++entry.stats.misses;
+        return false;
+    }
+    ++entry.stats.hits;
+    std::memcpy(out, entry.payload, kPayloadSize);
+    return true;
+}
+
+void PgnPayloadCache::store(uint16_t pgn, const PgnCacheKey& key, const uint8_t* payload) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entryFor(pgn);
+    entry.key = key;
+    entry.valid = !key.overflowed();
+    std::memcpy(entry.payload, payload, kPayloadSize);
+}
+
+std::vector<PgnCacheStats> PgnPayloadCache::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<PgnCacheStats> result;
+    result.reserve(entries_.size());
+    for (const Entry& entry : entries_) {
+        result.push_back(entry.stats);
+    }
+    return result;
+}
+
+void PgnPayloadCache::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Entry& entry : entries_) {
+        entry.stats.hits = 0;
+        entry.stats.misses = 0;
+    }
+}
+
+} // namespace tinybms
@@ -0,0 +1,113 @@
+#include "victron_pgn_scheduler.h"
+
+#include <algorithm>
+
+namespace tinybms {
+
+void PgnScheduler::configure(const std::vector<PgnSlot>& slots, uint32_t now_ms, uint32_t miss_tolerance_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    miss_tolerance_ms_ = miss_tolerance_ms;
+    if (slots.empty()) {
+        return;
+    }
+
+    uint32_t shortest = UINT32_MAX;
+    for (const PgnSlot& slot : slots) {
+        shortest = std::min(shortest, std::max<uint32_t>(1, slot.period_ms));
+    }
+    const uint32_t step = shortest / static_cast<uint32_t>(slots.size());
+
+    entries_.reserve(slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        Entry entry{};
+        entry.stats.pgn = slots[i].pgn;
+        entry.stats.period_ms = std::max<uint32_t>(1, slots[i].period_ms);
+        entry.stats.phase_ms = (static_cast<uint32_t>(i) * step) % entry.stats.period_ms;
+        entry.next_due_ms = now_ms + entry.stats.phase_ms;
+        entries_.push_back(entry);
+    }
+}
+
+void PgnScheduler::restart(uint32_t start_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Entry& entry : entries_) {
+        entry.next_due_ms = start_ms + entry.stats.phase_ms;
+    }
+}
+
+bool PgnScheduler::nextDue(uint32_t now_ms, size_t& index) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool found = false;
+    uint32_t oldest_lateness = 0;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        const int32_t lateness = static_cast<int32_t>(now_ms - entries_[i].next_due_ms);
+        if (lateness < 0) {
+            continue;
+        }
+        if (!found || static_cast<uint32_t>(lateness) > oldest_lateness) {
+            found = true;
+            oldest_lateness = static_cast<uint32_t>(lateness);
+            index = i;
+        }
+    }
+    return found;
+}
+
+void PgnScheduler::markSent(size_t index, uint32_t now_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index >= entries_.size()) {
+        return;
+    }
+    Entry& entry = entries_[index];
+    PgnScheduleStats& stats = entry.stats;
+
+    const int32_t signed_lateness = static_cast<int32_t>(now_ms - entry.next_due_ms);
+    const uint32_t lateness = signed_lateness > 0 ? static_cast<uint32_t>(signed_lateness) : 0;
+    const uint32_t skipped = lateness / stats.period_ms;
+
+    ++stats.sent;
+    stats.last_sent_ms = now_ms;
+    stats.lateness_ms_last = lateness;
+    stats.lateness_ms_max = std::max(stats.lateness_ms_max, lateness);
+    stats.periods_skipped += skipped;
+    if (lateness > miss_tolerance_ms_) {
+        ++stats.deadline_misses;
+    }
+    entry.next_due_ms += (skipped + 1) * stats.period_ms;
+}
+
+size_t PgnScheduler::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+uint16_t PgnScheduler::pgnAt(size_t index) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return index < entries_.size() ? entries_[index].stats.pgn : 0;
+}
+
+uint32_t PgnScheduler::missToleranceMs() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return miss_tolerance_ms_;
+}
+
+std::vector<PgnScheduleStats> PgnScheduler::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<PgnScheduleStats> result;
+    result.reserve(entries_.size());
+    for (const Entry& entry : entries_) {
+        result.push_back(entry.stats);
+    }
+    return result;
+}
+
+void PgnScheduler::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Entry& entry : entries_) {
+        const PgnScheduleStats cleared{entry.stats.pgn, entry.stats.period_ms, entry.stats.phase_ms};
+        entry.stats = cleared;
+    }
+}
+
+} // namespace tinybms
@@ -30,6 +30,7 @@
 #include "watchdog_manager.h"
 #include "web_routes.h"
 #include "event/event_bus_v2.h"
+#include "event/event_journal.h"
 #include "hal/hal_manager.h"
 #include "hal/interfaces/ihal_can.h"
 #include "tinybms_victron_bridge.h"
@@ -43,6 +44,7 @@ extern SemaphoreHandle_t feedMutex;
 extern Logger logger;
 using tinybms::event::eventBus;
 extern TinyBMS_Victron_Bridge bridge;
+extern tinybms::event::EventJournal eventJournal;
 
 // External functions
 extern String getStatusJSON();
@@ -85,6 +87,46 @@ LogLevel parseLogLevelFromString(const String& levelStr) {
     return LOG_INFO;
 }
 
+constexpr size_t kStatisticsJournalEvents = 20;
+constexpr size_t kEventsDefaultLimit = 50;
+constexpr size_t kEventsMaxLimit = 200;
+
+void appendJournalRecords(JsonArray list, const std::vector<tinybms::event::JournalRecord>& records) {
+    for (const auto& record : records) {
+        JsonObject item = list.createNestedObject();
+        item["sequence"] = record.sequence;
+        item["time_ms"] = record.timestamp_ms;
+        item["type"] = tinybms::event::journalEventTypeName(record.type);
+        item["level"] = record.level;
+        item["code"] = record.code;
+        item["value"] = record.value;
+        item["text"] = record.text;
+    }
+}
+
+void appendJournalStats(JsonObject obj) {
+    const tinybms::event::EventJournalStats stats = eventJournal.stats();
+    obj["active"] = eventJournal.isActive();
+    obj["now_ms"] = stats.now_ms;
+    obj["stored"] = stats.stored;
+    obj["pending"] = stats.pending;
+    obj["first_sequence"] = stats.first_sequence;
+    obj["next_sequence"] = stats.next_sequence;
+    obj["flushes"] = stats.flushes;
+    obj["bytes_written"] = stats.bytes_written;
+    obj["write_errors"] = stats.write_errors;
+    obj["dropped"] = stats.dropped;
+    obj["repaired"] = stats.repaired;
+    obj["suppressed"] = stats.suppressed;
+}
+
+uint64_t parseUint64Param(WebRequestType* request, const char* name, uint64_t fallback) {
+    if (!request->hasParam(name)) {
+        return fallback;
+    }
+    return strtoull(request->getParam(name)->value().c_str(), nullptr, 10);
+}
+
 bool buildSettingsSnapshot(JsonObject configObj, String& errorMessage) {
     if (xSemaphoreTake(configMutex, pdMS_TO_TICKS(100)) != pdTRUE) {
         errorMessage = "config_mutex_timeout";
@@ -136,6 +178,8 @@ bool buildSettingsSnapshot(JsonObject configObj, String& errorMessage) {
     victron["manufacturer"] = config.victron.manufacturer_name;
     victron["battery_name"] = config.victron.battery_name;
     victron["pgn_interval_ms"] = config.victron.pgn_update_interval_ms;
+    victron["pgn_energy_interval_ms"] = config.victron.pgn_energy_interval_ms;
+    victron["pgn_identity_interval_ms"] = config.victron.pgn_identity_interval_ms;
     victron["cvl_interval_ms"] = config.victron.cvl_update_interval_ms;
     victron["keepalive_interval_ms"] = config.victron.keepalive_interval_ms;
     victron["keepalive_timeout_ms"] = config.victron.keepalive_timeout_ms;
@@ -176,7 +220,24 @@ bool buildSettingsSnapshot(JsonObject configObj, String& errorMessage) {
     tiny["poll_interval_ms"] = config.tinybms.poll_interval_ms;
     tiny["uart_retry_count"] = config.tinybms.uart_retry_count;
     tiny["uart_retry_delay_ms"] = config.tinybms.uart_retry_delay_ms;
+    tiny["uart_adaptive_timeouts"] = config.tinybms.uart_adaptive_timeouts;
+    tiny["uart_timeout_min_ms"] = config.tinybms.uart_timeout_min_ms;
+    tiny["uart_retry_delay_min_ms"] = config.tinybms.uart_retry_delay_min_ms;
     tiny["broadcast_expected"] = config.tinybms.broadcast_expected;
+    tiny["refresh_fast_ms"] = config.tinybms.refresh_fast_ms;
+    tiny["refresh_normal_ms"] = config.tinybms.refresh_normal_ms;
+    tiny["refresh_slow_ms"] = config.tinybms.refresh_slow_ms;
+    tiny["pack_capacity_ah"] = config.tinybms.pack_capacity_ah;
+    tiny["pack_stale_ms"] = config.tinybms.pack_stale_ms;
+    JsonArray extraPacks = tiny.createNestedArray("extra_packs");
+    for (uint8_t i = 0; i < config.tinybms.extra_pack_count; ++i) {
+        const auto& pack = config.tinybms.extra_packs[i];
+        JsonObject packObj = extraPacks.createNestedObject();
+        packObj["uart_port"] = pack.uart_port;
+        packObj["rx_pin"] = pack.rx_pin;
+        packObj["tx_pin"] = pack.tx_pin;
+        packObj["capacity_ah"] = pack.capacity_ah;
+    }
 
     JsonObject advanced = configObj.createNestedObject("advanced");
     advanced["enable_spiffs"] = config.advanced.enable_spiffs;
@@ -349,7 +410,31 @@ bool applySettingsPayload(const JsonObjectConst& settings,
             if (tinyObj.containsKey("poll_interval_ms")) config.tinybms.poll_interval_ms = tinyObj["poll_interval_ms"].as<uint32_t>();
             if (tinyObj.containsKey("uart_retry_count")) config.tinybms.uart_retry_count = tinyObj["uart_retry_count"].as<uint8_t>();
             if (tinyObj.containsKey("uart_retry_delay_ms")) config.tinybms.uart_retry_delay_ms = tinyObj["uart_retry_delay_ms"].as<uint32_t>();
+            if (tinyObj.containsKey("uart_adaptive_timeouts")) config.tinybms.uart_adaptive_timeouts = tinyObj["uart_adaptive_timeouts"].as<bool>();
+            if (tinyObj.containsKey("uart_timeout_min_ms")) config.tinybms.uart_timeout_min_ms = tinyObj["uart_timeout_min_ms"].as<uint32_t>();
+            if (tinyObj.containsKey("uart_retry_delay_min_ms")) config.tinybms.uart_retry_delay_min_ms = tinyObj["uart_retry_delay_min_ms"].as<uint32_t>();
             if (tinyObj.containsKey("broadcast_expected")) config.tinybms.broadcast_expected = tinyObj["broadcast_expected"].as<bool>();
+            if (tinyObj.containsKey("refresh_fast_ms")) config.tinybms.refresh_fast_ms = tinyObj["refresh_fast_ms"].as<uint32_t>();
+            if (tinyObj.containsKey("refresh_normal_ms")) config.tinybms.refresh_normal_ms = tinyObj["refresh_normal_ms"].as<uint32_t>();
+            if (tinyObj.containsKey("refresh_slow_ms")) config.tinybms.refresh_slow_ms = tinyObj["refresh_slow_ms"].as<uint32_t>();
+            if (tinyObj.containsKey("pack_capacity_ah")) config.tinybms.pack_capacity_ah = tinyObj["pack_capacity_ah"].as<float>();
+            if (tinyObj.containsKey("pack_stale_ms")) config.tinybms.pack_stale_ms = tinyObj["pack_stale_ms"].as<uint32_t>();
+            if (tinyObj.containsKey("extra_packs")) {
+                // Applied at the next restart (UARTs are opened in begin()).
+                auto& tiny = config.tinybms;
+                tiny.extra_pack_count = 0;
+                for (JsonObjectConst packObj : tinyObj["extra_packs"].as<JsonArrayConst>()) {
+                    if (tiny.extra_pack_count >= ConfigManager::TinyBMSConfig::kMaxExtraPacks) {
+                        break;
+                    }
+                    auto& pack = tiny.extra_packs[tiny.extra_pack_count++];
+                    pack = ConfigManager::TinyBMSConfig::ExtraPack{};
+                    pack.uart_port = packObj["uart_port"] | pack.uart_port;
+                    pack.rx_pin = packObj["rx_pin"] | pack.rx_pin;
+                    pack.tx_pin = packObj["tx_pin"] | pack.tx_pin;
+                    pack.capacity_ah = packObj["capacity_ah"] | pack.capacity_ah;
+                }
+            }
         }
     }
 
@@ -367,6 +452,8 @@ bool applySettingsPayload(const JsonObjectConst& settings,
             if (vicObj.containsKey("manufacturer_name")) config.victron.manufacturer_name = vicObj["manufacturer_name"].as<String>();
             if (vicObj.containsKey("battery_name")) config.victron.battery_name = vicObj["battery_name"].as<String>();
             if (vicObj.containsKey("pgn_interval_ms")) config.victron.pgn_update_interval_ms = vicObj["pgn_interval_ms"].as<uint32_t>();
+            if (vicObj.containsKey("pgn_energy_interval_ms")) config.victron.pgn_energy_interval_ms = vicObj["pgn_energy_interval_ms"].as<uint32_t>();
+            if (vicObj.containsKey("pgn_identity_interval_ms")) config.victron.pgn_identity_interval_ms = vicObj["pgn_identity_interval_ms"].as<uint32_t>();
             if (vicObj.containsKey("cvl_interval_ms")) config.victron.cvl_update_interval_ms = vicObj["cvl_interval_ms"].as<uint32_t>();
             if (vicObj.containsKey("keepalive_interval_ms")) config.victron.keepalive_interval_ms = vicObj["keepalive_interval_ms"].as<uint32_t>();
             if (vicObj.containsKey("keepalive_timeout_ms")) config.victron.keepalive_timeout_ms = vicObj["keepalive_timeout_ms"].as<uint32_t>();
@@ -454,6 +541,8 @@ bool applySettingsPayload(const JsonObjectConst& settings,
         }
     }
 
+    // The fields are live now, even if the save below fails or is not asked for.
+    config.markChanged();
     xSemaphoreGive(configMutex);
 
     if (persist) {
@@ -592,6 +681,42 @@ void setupAPIRoutes(WebServerType& server) {
         sendJsonResponse(request, 200, doc);
     });
 
+    // ===========================================
+    // GET /api/can/pgn
+    // ===========================================
+    server.on("/api/can/pgn", HTTP_GET, [](WebRequestType *request) {
+        const std::vector<tinybms::PgnScheduleStats> schedule = bridge.can_pgn_scheduler_.snapshot();
+        const std::vector<tinybms::PgnCacheStats> cache = bridge.can_pgn_cache_.snapshot();
+        DynamicJsonDocument doc(256 + schedule.size() * 448);
+        doc["success"] = true;
+        doc["miss_tolerance_ms"] = bridge.can_pgn_scheduler_.missToleranceMs();
+        JsonArray items = doc.createNestedArray("pgns");
+        for (const tinybms::PgnScheduleStats& entry : schedule) {
+            JsonObject item = items.createNestedObject();
+            char pgn[7];
+            snprintf(pgn, sizeof(pgn), "0x%03X", entry.pgn);
+            item["pgn"] = pgn;
+            item["period_ms"] = entry.period_ms;
+            item["phase_ms"] = entry.phase_ms;
+            item["sent"] = entry.sent;
+            item["deadline_misses"] = entry.deadline_misses;
+            item["periods_skipped"] = entry.periods_skipped;
+            item["lateness_ms_last"] = entry.lateness_ms_last;
+            item["lateness_ms_max"] = entry.lateness_ms_max;
+            item["last_sent_ms"] = entry.last_sent_ms;
+            // Payload cache (identity PGNs only): rebuilt when an input changes.
+            for (const tinybms::PgnCacheStats& cached : cache) {
+                if (cached.pgn == entry.pgn) {
+                    JsonObject cacheObj = item.createNestedObject("cache");
+                    cacheObj["hits"] = cached.hits;
+                    cacheObj["misses"] = cached.misses;
+                    cacheObj["hit_ratio"] = cached.hitRatio();
+                }
+            }
+        }
+        sendJsonResponse(request, 200, doc);
+    });
+
     // ===========================================
     // GET /api/config
     // ===========================================
@@ -972,6 +1097,10 @@ void setupAPIRoutes(WebServerType& server) {
     // ===========================================
     server.on("/api/stats/reset", HTTP_POST, [](WebRequestType *request) {
         eventBus.resetStats();
+        bridge.uart_queue_.resetStats();
+        bridge.uart_latency_.reset();
+        bridge.can_pgn_scheduler_.resetStats();
+        bridge.can_pgn_cache_.resetStats();
         StaticJsonDocument<128> resp;
         resp["success"] = true;
         resp["message"] = "Statistics reset";
@@ -983,8 +1112,17 @@ void setupAPIRoutes(WebServerType& server) {
     // ===========================================
     server.on("/api/statistics", HTTP_GET, [](WebRequestType *request) {
         tinybms::event::BusStatistics stats = eventBus.statistics();
+        const std::vector<tinybms::UartLatencyStats::EntrySnapshot> latency = bridge.uart_latency_.snapshot();
+        BridgeStats local_stats;
+        if (xSemaphoreTake(statsMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+            local_stats = bridge.stats;
+            xSemaphoreGive(statsMutex);
+        }
 
-        StaticJsonDocument<768> doc;
+        std::vector<tinybms::event::JournalRecord> journal_records;
+        eventJournal.query(0, UINT64_MAX, kStatisticsJournalEvents, journal_records);
+
+        DynamicJsonDocument doc(2048 + latency.size() * 384 + journal_records.size() * 256);
         doc["success"] = true;
 
         JsonObject data = doc.createNestedObject("data");
@@ -1016,20 +1154,322 @@ void setupAPIRoutes(WebServerType& server) {
         history.createNestedArray("temperature");
         history.createNestedArray("timestamps");
 
-        JsonArray events = data.createNestedArray("events");
-        (void)events;  // Placeholder to keep structure consistent
+        // Latest entries of the persistent event journal (see GET /api/events).
+        appendJournalRecords(data.createNestedArray("events"), journal_records);
+        appendJournalStats(data.createNestedObject("journal"));
 
         JsonObject eventBus = data.createNestedObject("event_bus");
         eventBus["total_events_published"] = stats.total_published;
         eventBus["total_events_dispatched"] = stats.total_delivered;
         eventBus["subscriber_count"] = stats.subscriber_count;
-        eventBus["queue_overruns"] = 0;
-        eventBus["dispatch_errors"] = 0;
-        eventBus["current_queue_depth"] = 0;
+        eventBus["queue_overruns"] = stats.queue_overruns;
+        eventBus["dispatch_errors"] = stats.dispatch_errors;
+        eventBus["current_queue_depth"] = stats.current_queue_depth;
+
+        // Attempt latency per command and outcome: time to first byte vs transfer.
+        JsonObject uartLatency = data.createNestedObject("uart_latency");
+        uartLatency["untimed_attempts"] = bridge.uart_latency_.untimedAttempts();
+        JsonArray entries = uartLatency.createNestedArray("entries");
+        for (const auto& entry : latency) {
+            JsonObject item = entries.createNestedObject();
+            char command[5];
+            snprintf(command, sizeof(command), "0x%02X", entry.command);
+            item["command"] = command;
+            item["outcome"] = tinybms::attemptStatusName(entry.outcome);
+            item["attempts"] = entry.attempts;
+            const tinybms::LatencySummary* parts[] = {&entry.first_byte, &entry.transfer};
+            const char* names[] = {"first_byte_us", "transfer_us"};
+            for (size_t i = 0; i < 2; ++i) {
+                JsonObject summary = item.createNestedObject(names[i]);
+                summary["count"] = parts[i]->count;
+                summary["p50"] = parts[i]->p50_us;
+                summary["p90"] = parts[i]->p90_us;
+                summary["p99"] = parts[i]->p99_us;
+                summary["max"] = parts[i]->max_us;
+            }
+        }
+
+        // RTT estimates driving the adaptive response timeout / retry delay.
+        JsonArray rtt = uartLatency.createNestedArray("rtt");
+        for (const UartRttStats& estimate : local_stats.uart_rtt) {
+            if (estimate.samples == 0) {
+                continue;
+            }
+            JsonObject item = rtt.createNestedObject();
+            char command[5];
+            snprintf(command, sizeof(command), "0x%02X", estimate.command);
+            item["command"] = command;
+            item["samples"] = estimate.samples;
+            item["srtt_us"] = estimate.srtt_us;
+            item["rttvar_us"] = estimate.rttvar_us;
+            item["timeout_ms"] = estimate.timeout_ms;
+            item["retry_delay_ms"] = estimate.retry_delay_ms;
+        }
 
         sendJsonResponse(request, 200, doc);
     });
 
+    // ===========================================
+    // GET /api/eventbus
+    // ===========================================
+    server.on("/api/eventbus", HTTP_GET, [](WebRequestType *request) {
+        const tinybms::event::BusStatistics stats = eventBus.statistics();
+        const std::vector<tinybms::event::EventTypeSnapshot> types = eventBus.typeStatistics();
+        DynamicJsonDocument doc(512 + types.size() * 768);
+
+        doc["total_published"] = stats.total_published;
+        doc["total_delivered"] = stats.total_delivered;
+        doc["subscriber_count"] = stats.subscriber_count;
+        doc["queue_overruns"] = stats.queue_overruns;
+        doc["dispatch_errors"] = stats.dispatch_errors;
+        doc["current_queue_depth"] = stats.current_queue_depth;
+        doc["slow_callback_threshold_us"] = eventBus.slowCallbackThresholdUs();
+        doc["callback_sample_every"] = eventBus.callbackSampleEvery();
+
+        // One entry per event type; callback time buckets are listed when non-empty.
+        JsonArray list = doc.createNestedArray("types");
+        for (const auto& type : types) {
+            JsonObject item = list.createNestedObject();
+            item["id"] = type.id;
+            item["name"] = type.name;
+            item["published"] = type.published;
+            item["delivered"] = type.delivered;
+            item["subscribers"] = type.subscribers;
+            item["slow_callbacks"] = type.slow_callbacks;
+            item["dropped"] = type.dropped;
+            item["latest_skipped"] = type.latest_skipped;
+            JsonObject callback = item.createNestedObject("callback_us");
+            callback["count"] = type.callback_count;
+            callback["p50"] = type.callback_p50_us;
+            callback["p99"] = type.callback_p99_us;
+            callback["max"] = type.callback_max_us;
+            JsonArray buckets = callback.createNestedArray("buckets");
+            for (size_t i = 0; i < type.callback_buckets.size(); ++i) {
+                if (type.callback_buckets[i] == 0) {
+                    continue;
+                }
+                JsonObject bucket = buckets.createNestedObject();
+                bucket["lt_us"] = tinybms::event::CallbackTimeHistogram::bucketUpperUs(i);
+                bucket["count"] = type.callback_buckets[i];
+            }
+        }
+
+        sendJsonResponse(request, 200, doc);
+    });
+
+    // ===========================================
+    // GET /api/events (?from_ms=&to_ms=&limit=, journal time)
+    // ===========================================
+    server.on("/api/events", HTTP_GET, [](WebRequestType *request) {
+        const uint64_t from_ms = parseUint64Param(request, "from_ms", 0);
+        const uint64_t to_ms = parseUint64Param(request, "to_ms", UINT64_MAX);
+        uint64_t limit = parseUint64Param(request, "limit", kEventsDefaultLimit);
+        if (limit == 0 || limit > kEventsMaxLimit) {
+            limit = kEventsMaxLimit;
+        }
+
+        std::vector<tinybms::event::JournalRecord> records;
+        eventJournal.query(from_ms, to_ms, static_cast<size_t>(limit), records);
+
+        DynamicJsonDocument doc(512 + records.size() * 256);
+        doc["success"] = true;
+        appendJournalStats(doc.createNestedObject("journal"));
+        appendJournalRecords(doc.createNestedArray("events"), records);
+        sendJsonResponse(request, 200, doc);
+    });
+
+    // ===========================================
+    // GET /api/uart/queue
+    // ===========================================
+    server.on("/api/uart/queue", HTTP_GET, [](WebRequestType *request) {
+        StaticJsonDocument<1536> doc;
+        doc["worker_running"] = bridge.uart_worker_running_.load();
+
+        JsonObject priorities = doc.createNestedObject("priorities");
+        for (size_t i = 0; i < tinybms::kTransactionPriorityCount; ++i) {
+            const auto priority = static_cast<tinybms::TransactionPriority>(i);
+            const tinybms::TransactionQueueStats stats = bridge.uart_queue_.stats(priority);
+            JsonObject entry = priorities.createNestedObject(tinybms::transactionPriorityName(priority));
+            entry["depth"] = stats.depth;
+            entry["depth_max"] = stats.depth_max;
+            entry["submitted"] = stats.submitted;
+            entry["completed"] = stats.completed;
+            entry["failed"] = stats.failed;
+            entry["cancelled"] = stats.cancelled;
+            entry["expired"] = stats.expired;
+            entry["rejected"] = stats.rejected;
+            entry["wait_ms_last"] = stats.wait_ms_last;
+            entry["wait_ms_max"] = stats.wait_ms_max;
+            entry["wait_ms_avg"] = stats.wait_ms_avg;
+        }
+
+        String output;
+        serializeJson(doc, output);
+        request->send(200, "application/json", output);
+    });
+
+    // ===========================================
+    // GET /api/uart/link
+    // ===========================================
+    server.on("/api/uart/link", HTTP_GET, [](WebRequestType *request) {
+        BridgeStats local_stats;
+        if (xSemaphoreTake(statsMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+            local_stats = bridge.stats;
+            xSemaphoreGive(statsMutex);
+        }
+
+        StaticJsonDocument<384> doc;
+        doc["sleep_threshold_ms"] = local_stats.uart_sleep_threshold_ms;
+        doc["wakeups_sent"] = local_stats.uart_wakeups_sent;
+        doc["wakeups_skipped"] = local_stats.uart_wakeups_skipped;
+        doc["skip_failures"] = local_stats.uart_wakeup_skip_failures;
+        doc["latency_saved_ms"] = local_stats.uart_wakeup_saved_ms;
+
+        String output;
+        serializeJson(doc, output);
+        request->send(200, "application/json", output);
+    });
+
+    // ===========================================
+    // GET /api/packs
+    // ===========================================
+    server.on("/api/packs", HTTP_GET, [](WebRequestType *request) {
+        const uint32_t now = millis();
+        const std::vector<tinybms::PackStatus> packs = bridge.packs_.status(now);
+
+        StaticJsonDocument<1536> doc;
+        doc["pack_count"] = packs.size();
+        doc["stale_ms"] = bridge.packs_.staleMs();
+        size_t online = 0;
+        JsonArray items = doc.createNestedArray("packs");
+        for (const tinybms::PackStatus& pack : packs) {
+            online += pack.fresh ? 1 : 0;
+            JsonObject item = items.createNestedObject();
+            item["index"] = pack.index;
+            item["online"] = pack.fresh;
+            item["age_ms"] = pack.age_ms;
+            item["updates"] = pack.updates;
+            item["capacity_ah"] = pack.capacity_ah;
+            item["voltage"] = pack.voltage;
+            item["current"] = pack.current;
+            item["soc_percent"] = pack.soc_percent;
+            item["min_cell_mv"] = pack.min_cell_mv;
+            item["max_cell_mv"] = pack.max_cell_mv;
+            item["ccl_a"] = pack.max_charge_current / 10.0f;
+            item["dcl_a"] = pack.max_discharge_current / 10.0f;
+            for (const auto& link : bridge.extra_packs_) {
+                if (link->index == pack.index) {
+                    item["poll_cycles"] = link->poller->stats().cycles;
+                    item["poll_failures"] = link->poller->stats().failures;
+                }
+            }
+        }
+        doc["packs_online"] = online;
+
+        String output;
+        serializeJson(doc, output);
+        request->send(200, "application/json", output);
+    });
+
+    // ===========================================
+    // GET /api/uart/trace
+    // ===========================================
+    server.on("/api/uart/trace", HTTP_GET, [](WebRequestType *request) {
+        const tinybms::UartTraceRecorderStats stats = bridge.uart_trace_.stats();
+
+        StaticJsonDocument<384> doc;
+        doc["recording"] = bridge.uart_trace_.active();
+        doc["path"] = String(bridge.uart_trace_.path().c_str());
+        doc["events"] = stats.events;
+        doc["tx_bytes"] = stats.tx_bytes;
+        doc["rx_bytes"] = stats.rx_bytes;
+        doc["trace_bytes"] = stats.trace_bytes;
+        doc["write_errors"] = stats.write_errors;
+        doc["dropped_bytes"] = stats.dropped_bytes;
+        doc["truncated"] = stats.truncated;
+
+        String output;
+        serializeJson(doc, output);
+        request->send(200, "application/json", output);
+    });
+
+    // ===========================================
+    // POST /api/uart/trace/start (?path=/traces/uart.bin)
+    // ===========================================
+    server.on("/api/uart/trace/start", HTTP_POST, [](WebRequestType *request) {
+        String path = String(tinybms::kUartTraceDirectory) + "uart.bin";
+        if (request->hasParam("path")) {
+            path = request->getParam("path")->value();
+        }
+
+        StaticJsonDocument<192> resp;
+        // Never truncate configuration or journal files: captures live under /traces/.
+        if (!tinybms::isUartTracePath(std::string(path.c_str()))) {
+            resp["success"] = false;
+            resp["message"] = "Path must be /traces/<name> ([A-Za-z0-9._-], 23 chars max)";
+            sendJsonResponse(request, 400, resp);
+            return;
+        }
+        hal::IHalStorage& storage = hal::HalManager::instance().storage();
+        if (storage.type() == hal::StorageType::NVS) {
+            resp["success"] = false;
+            resp["message"] = "UART trace needs SPIFFS storage";
+            sendJsonResponse(request, 409, resp);
+            return;
+        }
+
+        const bool ok = bridge.uart_trace_.start(storage, std::string(path.c_str()), millis());
+        resp["success"] = ok;
+        resp["path"] = path;
+        resp["message"] = ok ? "UART trace started" : "Failed to open trace file";
+        sendJsonResponse(request, ok ? 200 : 500, resp);
+    });
+
+    // ===========================================
+    // POST /api/uart/trace/stop
+    // ===========================================
+    server.on("/api/uart/trace/stop", HTTP_POST, [](WebRequestType *request) {
+        bridge.uart_trace_.stop();
+        const tinybms::UartTraceRecorderStats stats = bridge.uart_trace_.stats();
+
+        StaticJsonDocument<192> resp;
+        resp["success"] = true;
+        resp["events"] = stats.events;
+        resp["trace_bytes"] = stats.trace_bytes;
+        resp["truncated"] = stats.truncated;
+        sendJsonResponse(request, 200, resp);
+    });
+
+    // ===========================================
+    // GET /api/uart/broadcast
+    // ===========================================
+    server.on("/api/uart/broadcast", HTTP_GET, [](WebRequestType *request) {
+        StaticJsonDocument<1024> doc;
+        doc["enabled"] = bridge.uart_broadcast_enabled_.load();
+        {
+            std::lock_guard<std::mutex> lock(bridge.uart_broadcast_mutex_);
+            const uint32_t now = millis();
+            const tinybms::BroadcastStats& stats = bridge.uart_broadcast_.stats();
+            const tinybms::FrameParserStats& parser = bridge.uart_broadcast_.parserStats();
+            doc["active"] = bridge.uart_broadcast_.active(now);
+            doc["frames"] = stats.frames;
+            doc["words"] = stats.words;
+            doc["ignored_frames"] = stats.ignored_frames;
+            doc["last_frame_age_ms"] = stats.frames > 0 ? now - stats.last_frame_ms : 0;
+            doc["garbage_bytes"] = parser.garbage_bytes;
+            doc["crc_errors"] = parser.crc_errors;
+
+            JsonArray covered = doc.createNestedArray("covered_registers");
+            for (uint16_t address : bridge.uart_broadcast_.coveredAddresses(now)) {
+                covered.add(address);
+            }
+        }
+
+        String output;
+        serializeJson(doc, output);
+        request->send(200, "application/json", output);
+    });
+
     // ===========================================
     // GET|PUT /api/watchdog
     // ===========================================
@@ -1103,6 +1543,7 @@ void setupAPIRoutes(WebServerType& server) {
         if (updated) {
             if (xSemaphoreTake(configMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
                 config.advanced.watchdog_timeout_s = Watchdog.getTimeout() / 1000;
+                config.markChanged();
                 xSemaphoreGive(configMutex);
                 config.save();
             }
@@ -160,7 +160,7 @@ void buildStatusJSON(String& output, const TinyBMS_LiveData& data) {
 
         const TinyRegisterRuntimeBinding* binding = findTinyRegisterBinding(snap.address);
         if (binding && binding->value_type == TinyRegisterValueType::String && snap.has_text) {
-            reg["value"] = snap.text_value;
+            reg["value"] = snap.text_value.c_str();
         } else {
             float scaled_value = static_cast<float>(snap.raw_value);
             if (binding) {
@@ -170,7 +170,7 @@ void buildStatusJSON(String& output, const TinyBMS_LiveData& data) {
         }
         reg["valid"] = snap.raw_word_count > 0;
         if (snap.has_text) {
-            reg["text"] = snap.text_value;
+            reg["text"] = snap.text_value.c_str();
         }
 
         const TinyRegisterMetadata* meta = findTinyRegisterMetadata(snap.address);
@@ -266,13 +266,18 @@ void websocketTask(void *pvParameters) {
 
         if (now - last_update_ms >= interval_ms) {
 
-            LiveDataUpdate latest{};
-            // Phase 3: Use Event Bus cache instead of legacy queue
-            if (eventBus.getLatest(latest)) {
-                TinyBMS_LiveData data = latest.data;
-
-                String json;
-                buildStatusJSON(json, data);
+            // Phase 3: Use Event Bus cache instead of legacy queue.
+            // The JSON is built on the cached snapshot in place (no LiveData copy on this stack).
+            String json;
+            float voltage = 0.0f;
+            float current = 0.0f;
+            float soc_percent = 0.0f;
+            if (eventBus.borrowLatest<LiveDataUpdate>([&](const LiveDataUpdate& latest) {
+                    buildStatusJSON(json, latest.data);
+                    voltage = latest.data.voltage;
+                    current = latest.data.current;
+                    soc_percent = latest.data.soc_percent;
+                })) {
 
                 if (!json.isEmpty()) {
                     const size_t payload_size = static_cast<size_t>(json.length());
@@ -286,9 +291,9 @@ void websocketTask(void *pvParameters) {
 
                         if (logging_config.log_can_traffic) {
                             logger.log(LOG_DEBUG,
-                                "WebSocket TX: V=" + String(data.voltage) +
-                                " I=" + String(data.current) +
-                                " SOC=" + String(data.soc_percent) + "%"
+                                "WebSocket TX: V=" + String(voltage) +
+                                " I=" + String(current) +
+                                " SOC=" + String(soc_percent) + "%"
                             );
                         }
                     } else {
@@ -0,0 +1,189 @@
+// Event bus publish benchmark: the previous publish path (subscriber vector
+// copied under the channel mutex) vs the copy-on-write subscriber lists of
+// EventBusV2, with 1, 4 and 16 subscribers; allocations and time per publish.
+// The async row includes dispatchPending(): steady-state delivery must not
+// allocate. The filter rows give each subscriber its own register address,
+// one of which matches: a predicate is evaluated per subscriber, the key
+// index only visits the matching one.
+// Built by scripts/run_native_tests.sh, executed when RUN_NATIVE_BENCHMARKS=1.
+
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <vector>
+
+#include "event/event_bus_v2.h"
+#include "event/event_types_v2.h"
+
+namespace {
+size_t g_allocations = 0;
+} // namespace
+
+void* operator new(size_t size) {
+    g_allocations++;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+using tinybms::event::AsyncSubscriptionOptions;
+using tinybms::event::EventBusV2;
+using tinybms::event::EventSubscriber;
+using tinybms::event::KeyFilter;
+using tinybms::events::MqttRegisterValue;
+
+constexpr int kIterations = 200000;
+
+struct PublishResult {
+    double allocations_per_publish = 0.0;
+    double ns_per_publish = 0.0;
+};
+
+// EventBusV2::publish() before copy-on-write lists (metadata, statistics,
+// latest cache, subscriber vector copied under the channel mutex).
+class LegacyChannel {
+public:
+    struct Subscription {
+        std::function<void(const MqttRegisterValue&)> callback;
+    };
+
+    void subscribe(std::function<void(const MqttRegisterValue&)> callback) {
+        auto subscription = std::make_shared<Subscription>();
+        subscription->callback = std::move(callback);
+        std::lock_guard<std::mutex> lock(mutex_);
+        subscribers_.push_back(subscription);
+    }
+
+    void publish(MqttRegisterValue event) {
+        event.metadata.timestamp_ms = millis();
+        event.metadata.sequence = sequence_.fetch_add(1, std::memory_order_relaxed);
+        std::vector<std::shared_ptr<Subscription>> subscribers;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            latest_ = event;
+            subscribers = subscribers_;
+        }
+        published_.fetch_add(1, std::memory_order_relaxed);
+        uint32_t delivered = 0;
+        for (const auto& sub : subscribers) {
+            if (sub && sub->callback) {
+                sub->callback(event);
+                ++delivered;
+            }
+        }
+        if (delivered > 0) {
+            delivered_.fetch_add(delivered, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::atomic<uint32_t> sequence_{0};
+    std::atomic<uint32_t> published_{0};
+    std::atomic<uint32_t> delivered_{0};
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<Subscription>> subscribers_;
+    std::optional<MqttRegisterValue> latest_;
+};
+
+template <typename Publish>
+PublishResult runPublishes(Publish&& publish) {
+    MqttRegisterValue event{};
+    event.payload.address = 36;
+    PublishResult result;
+    g_allocations = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        event.payload.raw_value = i;
+        publish(event);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    result.allocations_per_publish = static_cast<double>(g_allocations) / kIterations;
+    result.ns_per_publish = std::chrono::duration<double, std::nano>(stop - start).count() / kIterations;
+    return result;
+}
+
+} // namespace
+
+int main() {
+    std::printf("%-12s | %-26s | %14s | %10s\n", "subscribers", "path", "allocs/publish", "ns/publish");
+    uint64_t sink = 0;
+    for (size_t count : {1U, 4U, 16U}) {
+        LegacyChannel legacy;
+        for (size_t i = 0; i < count; ++i) {
+            legacy.subscribe([&sink](const MqttRegisterValue& evt) { sink += static_cast<uint64_t>(evt.payload.raw_value); });
+        }
+        const PublishResult before = runPublishes([&](const MqttRegisterValue& evt) { legacy.publish(evt); });
+
+        EventBusV2 bus;
+        std::vector<EventSubscriber> subscribers;
+        for (size_t i = 0; i < count; ++i) {
+            subscribers.push_back(bus.subscribe<MqttRegisterValue>(
+                [&sink](const MqttRegisterValue& evt) { sink += static_cast<uint64_t>(evt.payload.raw_value); }));
+        }
+        const PublishResult after = runPublishes([&](const MqttRegisterValue& evt) { bus.publish(evt); });
+
+        std::printf("%-12zu | %-26s | %14.2f | %10.1f\n", count, "vector copy under mutex",
+                    before.allocations_per_publish, before.ns_per_publish);
+        subscribers.clear();
+        AsyncSubscriptionOptions options;
+        options.capacity = 4;
+        for (size_t i = 0; i < count; ++i) {
+            subscribers.push_back(bus.subscribeAsync<MqttRegisterValue>(
+                [&sink](const MqttRegisterValue& evt) { sink += static_cast<uint64_t>(evt.payload.raw_value); },
+                options));
+        }
+        const PublishResult async = runPublishes([&](const MqttRegisterValue& evt) {
+            bus.publish(evt);
+            bus.dispatchPending(0);
+        });
+
+        std::printf("%-12zu | %-26s | %14.2f | %10.1f\n", count, "copy-on-write list",
+                    after.allocations_per_publish, after.ns_per_publish);
+        std::printf("%-12zu | %-26s | %14.2f | %10.1f\n", count, "async + dispatchPending",
+                    async.allocations_per_publish, async.ns_per_publish);
+
+        subscribers.clear();
+        for (size_t i = 0; i < count; ++i) {
+            const uint16_t address = static_cast<uint16_t>(36 + i);
+            subscribers.push_back(bus.subscribe<MqttRegisterValue>(
+                [address](const MqttRegisterValue& evt) { return evt.payload.address == address; },
+                [&sink](const MqttRegisterValue& evt) { sink += static_cast<uint64_t>(evt.payload.raw_value); }));
+        }
+        const PublishResult predicate = runPublishes([&](const MqttRegisterValue& evt) { bus.publish(evt); });
+
+        subscribers.clear();
+        for (size_t i = 0; i < count; ++i) {
+            subscribers.push_back(bus.subscribe<MqttRegisterValue>(
+                KeyFilter{static_cast<uint32_t>(36 + i)},
+                [&sink](const MqttRegisterValue& evt) { sink += static_cast<uint64_t>(evt.payload.raw_value); }));
+        }
+        const PublishResult keyed = runPublishes([&](const MqttRegisterValue& evt) { bus.publish(evt); });
+        subscribers.clear();
+
+        std::printf("%-12zu | %-26s | %14.2f | %10.1f\n", count, "predicate filter, 1 match",
+                    predicate.allocations_per_publish, predicate.ns_per_publish);
+        std::printf("%-12zu | %-26s | %14.2f | %10.1f\n", count, "key index, 1 match",
+                    keyed.allocations_per_publish, keyed.ns_per_publish);
+    }
+    std::printf("\n(%llu)\n", static_cast<unsigned long long>(sink));
+    return 0;
+}
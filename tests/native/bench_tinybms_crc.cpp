@@ -0,0 +1,59 @@
+// CRC16/MODBUS micro-benchmark: bitwise reference vs table-driven modes.
+// Built by scripts/run_native_tests.sh, executed when RUN_NATIVE_BENCHMARKS=1.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "uart/tinybms_crc.h"
+
+using tinybms::crc::Crc16Mode;
+
+namespace {
+
+volatile uint16_t g_sink = 0;
+
+template <typename Fn>
+double nsPerByte(size_t frame_len, size_t iterations, Fn&& fn) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        g_sink = static_cast<uint16_t>(g_sink ^ fn());
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    return ns / static_cast<double>(frame_len * iterations);
+}
+
+} // namespace
+
+int main() {
+    // 7 = block read request, 83 = 39-register list response, 256 = max frame.
+    const size_t frame_sizes[] = {7, 83, 256};
+    constexpr size_t kBytesPerRun = 8u * 1024u * 1024u;
+
+    std::printf("%-10s %12s %12s %12s %12s\n", "frame", "bitwise", "bytewise", "slice4", "slice8");
+    for (size_t frame_len : frame_sizes) {
+        std::vector<uint8_t> frame(frame_len);
+        for (size_t i = 0; i < frame_len; ++i) {
+            frame[i] = static_cast<uint8_t>(i * 31u + 7u);
+        }
+        const size_t iterations = kBytesPerRun / frame_len;
+
+        const double bitwise = nsPerByte(frame_len, iterations, [&]() {
+            return tinybms::crc::computeBitwise(frame.data(), frame.size());
+        });
+        double modes[3] = {};
+        const Crc16Mode mode_list[3] = {Crc16Mode::Bytewise, Crc16Mode::SliceBy4, Crc16Mode::SliceBy8};
+        for (size_t m = 0; m < 3; ++m) {
+            modes[m] = nsPerByte(frame_len, iterations, [&]() {
+                return tinybms::crc::update(tinybms::crc::kModbusInitialState, frame.data(), frame.size(), mode_list[m]);
+            });
+        }
+
+        std::printf("%-10zu %9.3f ns %9.3f ns %9.3f ns %9.3f ns  (per byte)\n",
+                    frame_len, bitwise, modes[0], modes[1], modes[2]);
+    }
+
+    return 0;
+}
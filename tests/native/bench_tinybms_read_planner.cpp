@@ -0,0 +1,68 @@
+// Read planner benchmark: planned block/list mix vs the legacy 39-address 0x09 poll.
+// Built by scripts/run_native_tests.sh, executed when RUN_NATIVE_BENCHMARKS=1.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_read_planner.h"
+
+namespace {
+
+// Address list hard-coded in uartTask before the planner existed.
+const std::vector<uint16_t> kLegacyAddresses = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029,
+    0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033,
+    0x0034, 0x0066, 0x0067, 0x0071, 0x0072, 0x0131, 0x0132, 0x0133, 0x013B, 0x013C,
+    0x013D, 0x013E, 0x013F, 0x01F4, 0x01F5, 0x01F6, 0x01F7, 0x01F8, 0x01F9
+};
+
+size_t countKind(const tinybms::ReadPlan& plan, tinybms::ReadOperationKind kind) {
+    size_t count = 0;
+    for (const auto& op : plan.operations) {
+        count += (op.kind == kind) ? 1 : 0;
+    }
+    return count;
+}
+
+} // namespace
+
+int main() {
+    const std::vector<uint16_t> mapped = tinybms::collectPollAddresses(getTinyRegisterBindings());
+    const uint32_t bauds[] = {19200, 115200};
+    const uint32_t overheads_us[] = {500, 2000, 5000, 12000};
+
+    std::printf("mapped registers: %zu, legacy list: %zu\n\n", mapped.size(), kLegacyAddresses.size());
+    std::printf("%-8s %-10s | %-22s | %-30s\n", "baud", "overhead", "legacy 0x09 (bytes, ms)", "planned (blk+lst, bytes, ms)");
+    for (uint32_t baud : bauds) {
+        for (uint32_t overhead : overheads_us) {
+            tinybms::ReadPlanCostModel model{};
+            model.baud_rate = baud;
+            model.transaction_overhead_us = overhead;
+
+            const tinybms::ReadPlan legacy = tinybms::buildSingleListPlan(kLegacyAddresses, model);
+            const tinybms::ReadPlan planned = tinybms::buildReadPlan(mapped, model);
+
+            std::printf("%-8u %7.1f ms | %6u B %10.2f ms | %zu+%zu %6u B %10.2f ms\n",
+                        baud, overhead / 1000.0,
+                        legacy.wire_bytes, legacy.estimated_cycle_us / 1000.0,
+                        countKind(planned, tinybms::ReadOperationKind::Block),
+                        countKind(planned, tinybms::ReadOperationKind::List),
+                        planned.wire_bytes, planned.estimated_cycle_us / 1000.0);
+        }
+    }
+
+    constexpr int kIterations = 2000;
+    size_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        sink += tinybms::buildReadPlan(mapped).operations.size();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const double us = std::chrono::duration<double, std::micro>(stop - start).count() / kIterations;
+    std::printf("\nplan build: %.2f us per rebuild (%zu)\n", us, sink);
+
+    return 0;
+}
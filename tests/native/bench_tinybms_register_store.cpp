@@ -0,0 +1,196 @@
+// Register store benchmark: flat RegisterStore vs the std::map cache of the
+// poll path, per-binding decoding vs the precompiled DecodePlan; allocations
+// and time per poll cycle (fill + decode).
+// Built by scripts/run_native_tests.sh, executed when RUN_NATIVE_BENCHMARKS=1.
+
+#include <Arduino.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_decode_plan.h"
+#include "uart/tinybms_decoder.h"
+#include "uart/tinybms_read_planner.h"
+#include "uart/tinybms_register_store.h"
+
+namespace {
+size_t g_allocations = 0;
+} // namespace
+
+void* operator new(size_t size) {
+    g_allocations++;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+constexpr int kIterations = 20000;
+
+struct CycleResult {
+    double allocations_per_cycle = 0.0;
+    double us_per_cycle = 0.0;
+    size_t sink = 0;
+};
+
+// Response words of one poll cycle, as the UART client hands them over.
+std::vector<uint16_t> responseWords(const std::vector<uint16_t>& addresses, int cycle) {
+    std::vector<uint16_t> words(addresses.size());
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        words[i] = static_cast<uint16_t>(addresses[i] * 7U + static_cast<unsigned>(cycle));
+    }
+    return words;
+}
+
+template <typename Fill, typename Decode>
+CycleResult runCycles(const std::vector<uint16_t>& addresses, Fill&& fill, Decode&& decode) {
+    const std::vector<uint16_t> words = responseWords(addresses, 1);
+    CycleResult result;
+    g_allocations = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        fill(words);
+        result.sink += decode();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    result.allocations_per_cycle = static_cast<double>(g_allocations) / kIterations;
+    result.us_per_cycle = std::chrono::duration<double, std::micro>(stop - start).count() / kIterations;
+    return result;
+}
+
+// Numeric bindings only: string snapshots allocate in TinyBMS_LiveData itself,
+// whatever the register container.
+std::vector<TinyRegisterRuntimeBinding> numericBindings() {
+    std::vector<TinyRegisterRuntimeBinding> bindings;
+    for (const auto& binding : getTinyRegisterBindings()) {
+        if (binding.value_type != TinyRegisterValueType::String && binding.metadata_address != 501) {
+            bindings.push_back(binding);
+        }
+    }
+    return bindings;
+}
+
+} // namespace
+
+int main() {
+    const auto& all_bindings = getTinyRegisterBindings();
+    const std::vector<TinyRegisterRuntimeBinding> bindings = numericBindings();
+    const std::vector<uint16_t> addresses = tinybms::collectPollAddresses(all_bindings);
+
+    // Legacy cache: cleared each cycle as a fresh local map used to be.
+    std::map<uint16_t, uint16_t> map_cache;
+    tinybms::RegisterStore store;
+    store.ensureLayout(all_bindings, getTinyReadMappingVersion());
+    TinyBMS_LiveData live{};
+
+    auto decode_map = [&]() {
+        size_t decoded = 0;
+        live.resetSnapshots();
+        for (const auto& binding : bindings) {
+            decoded += tinybms::uart::detail::decodeAndApplyBinding(binding, map_cache, live, 0, nullptr) ? 1 : 0;
+        }
+        return decoded;
+    };
+    auto decode_store = [&]() {
+        size_t decoded = 0;
+        live.resetSnapshots();
+        for (const auto& binding : bindings) {
+            decoded += tinybms::uart::detail::decodeAndApplyBinding(binding, store, live, 0, nullptr) ? 1 : 0;
+        }
+        return decoded;
+    };
+
+    std::printf("registers per cycle: %zu, store: %zu windows / %zu slots, numeric bindings: %zu\n\n",
+                addresses.size(), store.windowCount(), store.slotCount(), bindings.size());
+    std::printf("%-26s | %12s | %10s\n", "path", "allocs/cycle", "us/cycle");
+
+    const CycleResult map_fresh = runCycles(addresses, [&](const std::vector<uint16_t>& words) {
+        map_cache.clear();
+        for (size_t i = 0; i < words.size(); ++i) {
+            map_cache[addresses[i]] = words[i];
+        }
+    }, decode_map);
+    std::printf("%-26s | %12.2f | %10.3f\n", "std::map (fresh per cycle)", map_fresh.allocations_per_cycle,
+                map_fresh.us_per_cycle);
+
+    const CycleResult map_kept = runCycles(addresses, [&](const std::vector<uint16_t>& words) {
+        for (size_t i = 0; i < words.size(); ++i) {
+            map_cache[addresses[i]] = words[i];
+        }
+    }, decode_map);
+    std::printf("%-26s | %12.2f | %10.3f\n", "std::map (kept cache)", map_kept.allocations_per_cycle,
+                map_kept.us_per_cycle);
+
+    const CycleResult flat = runCycles(addresses, [&](const std::vector<uint16_t>& words) {
+        for (size_t i = 0; i < words.size(); ++i) {
+            store.set(addresses[i], words[i]);
+        }
+    }, decode_store);
+    std::printf("%-26s | %12.2f | %10.3f\n", "RegisterStore", flat.allocations_per_cycle, flat.us_per_cycle);
+
+    // Same numeric bindings, compiled once against the store layout.
+    tinybms::DecodePlan plan;
+    plan.compile(bindings, store);
+    auto decode_plan = [&]() {
+        live.resetSnapshots();
+        return plan.apply(store, live, 0);
+    };
+    const CycleResult compiled = runCycles(addresses, [&](const std::vector<uint16_t>& words) {
+        for (size_t i = 0; i < words.size(); ++i) {
+            store.set(addresses[i], words[i]);
+        }
+    }, decode_plan);
+    std::printf("%-26s | %12.2f | %10.3f\n", "RegisterStore + DecodePlan", compiled.allocations_per_cycle,
+                compiled.us_per_cycle);
+
+    // Fill + word lookups alone, without the LiveData decode on top.
+    auto lookup_map = [&]() {
+        size_t sum = 0;
+        for (uint16_t address : addresses) {
+            auto it = map_cache.find(address);
+            sum += (it != map_cache.end()) ? it->second : 0;
+        }
+        return sum;
+    };
+    auto lookup_store = [&]() {
+        size_t sum = 0;
+        uint16_t value = 0;
+        for (uint16_t address : addresses) {
+            sum += store.get(address, value) ? value : 0;
+        }
+        return sum;
+    };
+    const CycleResult map_words = runCycles(addresses, [&](const std::vector<uint16_t>& words) {
+        for (size_t i = 0; i < words.size(); ++i) {
+            map_cache[addresses[i]] = words[i];
+        }
+    }, lookup_map);
+    std::printf("%-26s | %12.2f | %10.3f\n", "std::map words only", map_words.allocations_per_cycle,
+                map_words.us_per_cycle);
+    const CycleResult flat_words = runCycles(addresses, [&](const std::vector<uint16_t>& words) {
+        for (size_t i = 0; i < words.size(); ++i) {
+            store.set(addresses[i], words[i]);
+        }
+    }, lookup_store);
+    std::printf("%-26s | %12.2f | %10.3f\n", "RegisterStore words only", flat_words.allocations_per_cycle,
+                flat_words.us_per_cycle);
+
+    std::printf("\n(%zu %zu %zu %zu %zu %zu)\n", map_fresh.sink, map_kept.sink, flat.sink, compiled.sink,
+                map_words.sink, flat_words.sink);
+    return (flat.allocations_per_cycle == 0.0 && compiled.allocations_per_cycle == 0.0) ? 0 : 1;
+}
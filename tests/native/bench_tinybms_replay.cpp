@@ -0,0 +1,150 @@
+// UART replay benchmark: re-runs the recorded requests of a trace through the
+// TinyBMS client against hal::ReplayUart and reports link time and host cost.
+// Built by scripts/run_native_tests.sh, executed when RUN_NATIVE_BENCHMARKS=1.
+//
+//   bench_tinybms_replay [trace.bin [speed]]
+//
+// Without a trace, a synthetic session (block reads, 1 in 20 answers lost)
+// is generated. Recorded wake-up pulses replay as timeouts.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "hal/replay_uart.h"
+#include "uart/tinybms_crc.h"
+#include "uart/tinybms_uart_client.h"
+#include "uart/tinybms_uart_trace.h"
+
+using tinybms::UartTraceDirection;
+using tinybms::UartTraceEvent;
+
+namespace {
+
+std::vector<uint8_t> withCrc(std::vector<uint8_t> frame) {
+    const uint16_t crc = tinybms::crc::compute(frame.data(), frame.size());
+    frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+    frame.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF));
+    return frame;
+}
+
+std::vector<UartTraceEvent> syntheticSession(size_t polls) {
+    std::vector<UartTraceEvent> events;
+    uint32_t t = 0;
+    for (size_t i = 0; i < polls; ++i) {
+        const uint8_t count = 16;
+        UartTraceEvent tx;
+        tx.timestamp_ms = t;
+        tx.direction = UartTraceDirection::Tx;
+        tx.bytes = withCrc({0xAA, 0x07, count, 0x20, 0x00});
+        events.push_back(tx);
+
+        if (i % 20 == 19) {
+            t += 100;                        // lost answer, the client timed out
+            continue;
+        }
+        std::vector<uint8_t> response{0xAA, 0x07, static_cast<uint8_t>(count * 2)};
+        for (uint8_t r = 0; r < count; ++r) {
+            response.push_back(static_cast<uint8_t>(i + r));
+            response.push_back(0x0D);
+        }
+        UartTraceEvent rx;
+        rx.timestamp_ms = t + 12;
+        rx.direction = UartTraceDirection::Rx;
+        rx.bytes = withCrc(response);
+        events.push_back(rx);
+        t += 100;
+    }
+    return events;
+}
+
+void advanceReplay(uint32_t delay_ms, void* context) {
+    static_cast<hal::ReplayUart*>(context)->advance(delay_ms);
+}
+
+struct ReplaySummary {
+    size_t requests = 0;
+    size_t successes = 0;
+    uint32_t timeouts = 0;
+    uint32_t crc_errors = 0;
+    uint32_t link_ms = 0;
+    double host_us = 0.0;
+};
+
+ReplaySummary replay(const std::vector<UartTraceEvent>& events, float speed) {
+    hal::ReplayUart uart(events, speed);
+    tinybms::TransactionOptions options{};
+    options.attempt_count = 1;              // recorded retries are their own TX records
+    options.response_timeout_ms = 100;
+    tinybms::DelayConfig delay{advanceReplay, &uart};
+
+    ReplaySummary summary;
+    std::vector<uint16_t> words(128);
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& event : events) {
+        if (event.direction != UartTraceDirection::Tx || event.bytes.size() < 5 || event.bytes[0] != 0xAA) {
+            continue;
+        }
+        const std::vector<uint8_t>& tx = event.bytes;
+        tinybms::TransactionResult result{};
+        if (tx[1] == 0x07 && tx.size() == 7) {
+            result = tinybms::readRegisterBlock(uart, static_cast<uint16_t>(tx[3] | (tx[4] << 8)), tx[2],
+                                                words.data(), options, delay);
+        } else if (tx[1] == 0x09 && tx.size() == static_cast<size_t>(tx[2]) + 5U) {
+            std::vector<uint16_t> addresses;
+            for (size_t i = 3; i + 1 < tx.size() - 2; i += 2) {
+                addresses.push_back(static_cast<uint16_t>(tx[i] | (tx[i + 1] << 8)));
+            }
+            result = tinybms::readIndividualRegisters(uart, addresses.data(), addresses.size(),
+                                                      words.data(), options, delay);
+        } else {
+            // Writes and other commands: keep the trace aligned, do not time them.
+            uart.write(tx.data(), tx.size());
+            continue;
+        }
+        summary.requests++;
+        summary.successes += result.success ? 1 : 0;
+        summary.timeouts += result.timeout_count;
+        summary.crc_errors += result.crc_error_count;
+    }
+    summary.host_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    summary.link_ms = uart.nowMs();
+    return summary;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<UartTraceEvent> events;
+    float speed = 1.0f;
+    if (argc > 1) {
+        std::ifstream file(argv[1], std::ios::binary);
+        const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (!tinybms::decodeUartTrace(bytes.data(), bytes.size(), events)) {
+            std::fprintf(stderr, "cannot decode trace %s\n", argv[1]);
+            return 1;
+        }
+        if (argc > 2) {
+            speed = static_cast<float>(std::atof(argv[2]));
+        }
+        std::printf("trace %s: %zu records, %u ms recorded\n", argv[1], events.size(),
+                    events.empty() ? 0U : events.back().timestamp_ms);
+    } else {
+        events = syntheticSession(2000);
+        std::printf("synthetic trace: %zu records, %u ms recorded\n", events.size(), events.back().timestamp_ms);
+    }
+
+    std::printf("%-8s | %-9s %-9s %-9s %-6s | %-12s %-10s\n",
+                "speed", "requests", "success", "timeouts", "crc", "link time", "host time");
+    for (float s : {speed, 0.0f}) {
+        const ReplaySummary summary = replay(events, s);
+        std::printf("%-8.2f | %-9zu %-9zu %-9u %-6u | %9u ms %7.2f ms\n",
+                    s, summary.requests, summary.successes, summary.timeouts, summary.crc_errors,
+                    summary.link_ms, summary.host_us / 1000.0);
+    }
+    return 0;
+}
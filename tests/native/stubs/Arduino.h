@@ -21,12 +21,22 @@ inline void resetMillis(uint32_t value = 0) {
 inline void advanceMillis(uint32_t delta) {
     current_millis += delta;
 }
+
+inline uint32_t current_micros = 0;
+
+inline void advanceMicros(uint32_t delta) {
+    current_micros += delta;
+}
 } // namespace arduino_stub
 
 inline uint32_t millis() {
     return arduino_stub::current_millis;
 }
 
+inline uint32_t micros() {
+    return arduino_stub::current_micros;
+}
+
 inline void delay(uint32_t) {}
 
 class String {
@@ -45,7 +45,9 @@ public:
                 available_bytes_ = active_response_.size();
                 read_index_ = 0;
             }
+            response_armed_ = true;
         } else {
+            response_armed_ = false;
             last_request_matches_ = false;
             active_response_.clear();
             available_bytes_ = 0;
@@ -57,18 +59,23 @@ public:
 
     void flush() override {}
 
+    // The first read after a write consumes the queued exchange; later reads
+    // keep draining the same response so callers may read it in chunks.
     size_t readBytes(uint8_t* buffer, size_t length) override {
-        if (exchanges_.empty()) {
-            return 0;
-        }
+        if (response_armed_) {
+            response_armed_ = false;
+            const auto exchange = exchanges_.front();
+            exchanges_.pop();
 
-        const auto exchange = exchanges_.front();
-        exchanges_.pop();
+            if (exchange.drop_response) {
+                available_bytes_ = 0;
+                read_index_ = 0;
+                active_response_.clear();
+                return 0;
+            }
+        }
 
-        if (exchange.drop_response) {
-            available_bytes_ = 0;
-            read_index_ = 0;
-            active_response_.clear();
+        if (read_index_ >= active_response_.size()) {
             return 0;
         }
 
@@ -107,6 +114,7 @@ private:
     std::vector<uint8_t> active_response_;
     std::vector<uint8_t> last_write_;
     bool last_request_matches_ = false;
+    bool response_armed_ = false;
     uint32_t timeout_ms_;
     size_t available_bytes_;
     size_t read_index_;
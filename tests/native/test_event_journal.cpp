@@ -0,0 +1,335 @@
+#include <Arduino.h>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "event/event_bus_v2.h"
+#include "event/event_journal.h"
+#include "event/event_types_v2.h"
+#include "hal/interfaces/ihal_storage.h"
+
+namespace hal {
+std::unique_ptr<IHalStorage> createMockStorage();
+}
+
+using tinybms::event::EventBusV2;
+using tinybms::event::EventJournal;
+using tinybms::event::EventJournalConfig;
+using tinybms::event::EventJournalStats;
+using tinybms::event::JournalEventType;
+using tinybms::event::JournalRecord;
+
+namespace {
+
+JournalRecord status(const char* text) {
+    JournalRecord record{};
+    record.type = JournalEventType::StatusMessage;
+    std::strncpy(record.text, text, sizeof(record.text) - 1);
+    return record;
+}
+
+std::vector<uint8_t> readFile(hal::IHalStorage& storage, const std::string& path) {
+    auto file = storage.open(path, hal::StorageOpenMode::Read);
+    std::vector<uint8_t> bytes(file->size());
+    bytes.resize(file->read(bytes.data(), bytes.size()));
+    return bytes;
+}
+
+void writeFile(hal::IHalStorage& storage, const std::string& path, const std::vector<uint8_t>& bytes,
+               hal::StorageOpenMode mode) {
+    auto file = storage.open(path, mode);
+    file->write(bytes.data(), bytes.size());
+    file->close();
+}
+
+std::vector<uint32_t> sequences(EventJournal& journal) {
+    std::vector<JournalRecord> records;
+    journal.query(0, UINT64_MAX, 1000, records);
+    std::vector<uint32_t> result;
+    for (const JournalRecord& record : records) {
+        result.push_back(record.sequence);
+    }
+    return result;
+}
+
+std::vector<uint32_t> range(uint32_t first, uint32_t last) {
+    std::vector<uint32_t> result;
+    for (uint32_t sequence = first; sequence <= last; ++sequence) {
+        result.push_back(sequence);
+    }
+    return result;
+}
+
+} // namespace
+
+int main() {
+    EventBusV2 bus;
+    EventJournalConfig small;
+    small.records_per_segment = 4;
+    small.segment_count = 3;
+    small.batch_records = 2;
+    small.flush_interval_ms = 1000;
+
+    // Batched appends: nothing reaches flash until a batch fills or ages out.
+    {
+        auto storage = hal::createMockStorage();
+        assert(storage->mount(hal::StorageConfig{}) == hal::Status::Ok);
+        EventJournal journal(bus, small);
+        assert(journal.begin(*storage, 100));
+        assert(journal.stats().index_writes == 1);   // fresh journal: empty index
+
+        assert(journal.append(status("boot"), 100));
+        assert(journal.stats().flushes == 0 && journal.stats().pending == 1);
+        assert(!journal.flushIfDue(1099));
+        assert(journal.flushIfDue(1100));
+        assert(journal.stats().flushes == 1 && journal.stats().written == 1);
+
+        for (uint32_t t = 2000; t < 2008; ++t) {
+            journal.append(status("tick"), t);
+            assert(journal.stats().pending <= small.batch_records);   // append() never writes
+            journal.flushIfDue(t);
+        }
+        EventJournalStats stats = journal.stats();
+        assert(stats.flushes == 7 && stats.written == 9 && stats.pending == 0);   // batches split at segment ends
+        assert(stats.bytes_written == 9 * sizeof(JournalRecord));
+        assert(stats.index_writes == 3);   // one per filled segment
+        assert(stats.stored == 9 && stats.first_sequence == 1 && stats.next_sequence == 10);
+
+        // Buffered records are visible to queries.
+        journal.append(status("pending"), 2100);
+        std::vector<JournalRecord> records;
+        assert(journal.query(0, UINT64_MAX, 2, records) == 2);
+        assert(records[0].sequence == 9 && records[1].sequence == 10);
+        assert(std::string(records[1].text) == "pending");
+        journal.end();
+        assert(!journal.isActive() && !journal.append(status("late"), 2200));
+    }
+
+    // Ring of segments: the oldest segment is overwritten.
+    {
+        auto storage = hal::createMockStorage();
+        storage->mount(hal::StorageConfig{});
+        EventJournal journal(bus, small);
+        assert(journal.begin(*storage, 0));
+        for (uint32_t t = 0; t < 30; ++t) {
+            journal.append(status("x"), t * 10);
+        }
+        journal.flush();
+        // 30 records, 3 segments of 4: the two sealed ones plus the active one.
+        assert((sequences(journal) == range(21, 30)));
+        assert(journal.stats().stored == 10 && journal.stats().first_sequence == 21);
+    }
+
+    // Time range queries read only the overlapping segments.
+    {
+        auto storage = hal::createMockStorage();
+        storage->mount(hal::StorageConfig{});
+        EventJournal journal(bus, small);
+        assert(journal.begin(*storage, 0));
+        for (uint32_t i = 0; i < 11; ++i) {
+            journal.append(status("t"), 1000 * i);   // journal time 0, 1000, ... 10000
+        }
+        journal.flush();
+        std::vector<JournalRecord> records;
+        const uint32_t before = journal.stats().segments_read;
+        assert(journal.query(4500, 7000, 100, records) == 3);
+        assert(records[0].timestamp_ms == 5000 && records[2].timestamp_ms == 7000);
+        assert(journal.stats().segments_read == before + 1);   // segment [4000, 7000] only
+
+        assert(journal.query(0, 2000, 100, records) == 3);
+        assert(journal.query(3000, 8000, 2, records) == 2);   // newest two kept
+        assert(records[0].timestamp_ms == 7000 && records[1].timestamp_ms == 8000);
+        assert(journal.query(20000, 30000, 100, records) == 0);
+    }
+
+    // Crash consistency: torn tail, lost index, reboot continuity.
+    {
+        auto storage = hal::createMockStorage();
+        storage->mount(hal::StorageConfig{});
+        {
+            EventJournal journal(bus, small);
+            assert(journal.begin(*storage, 0));
+            for (uint32_t i = 0; i < 6; ++i) {
+                journal.append(status("before crash"), 100 * i);
+            }
+            journal.flush();
+        }
+        // Records 1-4 fill segment 0, 5-6 are in segment 1 (active). A write
+        // cut mid-record leaves a partial record behind.
+        const std::string active = "/evj1.bin";
+        JournalRecord torn = status("torn");
+        torn.sequence = 7;
+        std::vector<uint8_t> partial(reinterpret_cast<const uint8_t*>(&torn),
+                                     reinterpret_cast<const uint8_t*>(&torn) + 40);
+        writeFile(*storage, active, partial, hal::StorageOpenMode::Append);
+        assert(readFile(*storage, active).size() == 2 * sizeof(JournalRecord) + 40);
+
+        EventJournal rebooted(bus, small);
+        assert(rebooted.begin(*storage, 50));
+        EventJournalStats stats = rebooted.stats();
+        assert(stats.repaired == 1 && stats.stored == 6 && stats.next_sequence == 7);
+        assert(readFile(*storage, active).size() == 2 * sizeof(JournalRecord));
+
+        // Journal time continues after the newest record, sequences too.
+        rebooted.append(status("after reboot"), 60);
+        rebooted.flush();
+        std::vector<JournalRecord> records;
+        rebooted.query(0, UINT64_MAX, 100, records);
+        assert(records.size() == 7);
+        assert(records.back().sequence == 7 && records.back().timestamp_ms == 500 + 1 + 10);
+        rebooted.end();
+
+        // A bit flip in a record cuts the segment there.
+        std::vector<uint8_t> bytes = readFile(*storage, active);
+        bytes[sizeof(JournalRecord) + 30] ^= 0x01;   // record 6
+        writeFile(*storage, active, bytes, hal::StorageOpenMode::Write);
+        // Lost index: rebuilt by scanning every segment.
+        writeFile(*storage, "/evj.idx", {0x00, 0x01}, hal::StorageOpenMode::Write);
+
+        EventJournal rescanned(bus, small);
+        assert(rescanned.begin(*storage, 0));
+        stats = rescanned.stats();
+        assert(stats.repaired == 2 && stats.index_writes == 1);
+        assert((sequences(rescanned) == range(1, 5)));
+        assert(stats.next_sequence == 6);
+        rescanned.end();
+
+        // Crash after a rollover was indexed but before the reused segment
+        // was truncated: its old records do not match the indexed sequence.
+        auto fresh = hal::createMockStorage();
+        fresh->mount(hal::StorageConfig{});
+        EventJournal filler(bus, small);
+        assert(filler.begin(*fresh, 0));
+        for (uint32_t i = 0; i < 4; ++i) {
+            filler.append(status("fill"), i);
+            filler.flushIfDue(i);
+        }
+        const std::vector<uint8_t> stale = readFile(*fresh, "/evj0.bin");   // sequences 1-4
+        for (uint32_t i = 4; i < 12; ++i) {
+            filler.append(status("fill"), i);
+            filler.flushIfDue(i);   // segment 2 fills: rollover to segment 0
+        }
+        filler.end();
+        assert(!fresh->exists("/evj0.bin"));
+        writeFile(*fresh, "/evj0.bin", stale, hal::StorageOpenMode::Write);
+
+        EventJournal recovered(bus, small);
+        assert(recovered.begin(*fresh, 0));
+        assert(recovered.stats().repaired == 4 && recovered.stats().next_sequence == 13);
+        assert(!fresh->exists("/evj0.bin"));
+        assert((sequences(recovered) == range(5, 12)));
+    }
+
+    // Bus integration: async subscriptions, flushed from the dispatcher side.
+    {
+        using tinybms::events::AlarmRaised;
+        using tinybms::events::ConfigChanged;
+        using tinybms::events::StatusMessage;
+
+        auto storage = hal::createMockStorage();
+        storage->mount(hal::StorageConfig{});
+        EventJournal journal(bus, small);
+        arduino_stub::resetMillis(5000);
+        assert(journal.begin(*storage, millis()));
+
+        AlarmRaised alarm{};
+        alarm.alarm.alarm_code = static_cast<uint16_t>(tinybms::events::AlarmCode::OverVoltage);
+        alarm.alarm.value = 58.2f;
+        std::strncpy(alarm.alarm.message, "Pack over voltage", sizeof(alarm.alarm.message) - 1);
+        bus.publish(alarm);
+        ConfigChanged change{};
+        std::strncpy(change.change.config_path, "cvl.enabled", sizeof(change.change.config_path) - 1);
+        std::strncpy(change.change.new_value, "true", sizeof(change.change.new_value) - 1);
+        bus.publish(change);
+        assert(journal.stats().appended == 0);   // enqueued only
+        bus.dispatchPending(0);
+        assert(journal.stats().appended == 2 && journal.stats().flushes == 0);   // not from the callback
+        assert(journal.flushIfDue(millis()));
+        assert(journal.stats().flushes == 1);
+
+        // The bus's slow-subscriber reports are not journaled, other status messages are.
+        StatusMessage slow{};
+        slow.metadata.source = tinybms::events::EventSource::EventBus;
+        std::strncpy(slow.message, "Slow StatusMessage subscriber: 12000 us", sizeof(slow.message) - 1);
+        bus.publish(slow);
+        StatusMessage info{};
+        info.metadata.source = tinybms::events::EventSource::System;
+        std::strncpy(info.message, "Started", sizeof(info.message) - 1);
+        bus.publish(info);
+        bus.dispatchPending(0);
+        assert(journal.stats().appended == 3);
+
+        std::vector<JournalRecord> records;
+        assert(journal.query(0, UINT64_MAX, 10, records) == 3);
+        assert(records[0].type == JournalEventType::AlarmRaised && records[0].code == 1);
+        assert(records[0].value == 58.2f && std::string(records[0].text) == "Pack over voltage");
+        assert(std::string(tinybms::event::journalEventTypeName(records[0].type)) == "AlarmRaised");
+        assert(records[1].type == JournalEventType::ConfigChanged);
+        assert(std::string(records[1].text) == "cvl.enabled=true");
+        assert(std::string(records[2].text) == "Started");
+
+        journal.end();
+        assert(!bus.hasSubscribers<AlarmRaised>());
+    }
+
+    // Alarms re-raised every poll cycle are journaled once per transition.
+    {
+        using tinybms::events::AlarmCleared;
+        using tinybms::events::AlarmRaised;
+
+        auto storage = hal::createMockStorage();
+        storage->mount(hal::StorageConfig{});
+        EventJournalConfig config = small;
+        config.alarm_repeat_ms = 10000;
+        EventJournal journal(bus, config);
+        arduino_stub::resetMillis(1000);
+        assert(journal.begin(*storage, millis()));
+
+        AlarmRaised uart_error{};
+        uart_error.alarm.alarm_code = static_cast<uint16_t>(tinybms::events::AlarmCode::UartError);
+        std::strncpy(uart_error.alarm.message, "TinyBMS UART read failed", sizeof(uart_error.alarm.message) - 1);
+        for (int cycle = 0; cycle < 3; ++cycle) {
+            bus.publish(uart_error);
+            bus.dispatchPending(0);
+            arduino_stub::advanceMillis(1000);
+        }
+        assert(journal.stats().appended == 1 && journal.stats().suppressed == 2);
+
+        // Another code is its own transition.
+        AlarmRaised over_voltage = uart_error;
+        over_voltage.alarm.alarm_code = static_cast<uint16_t>(tinybms::events::AlarmCode::OverVoltage);
+        bus.publish(over_voltage);
+        bus.dispatchPending(0);
+        assert(journal.stats().appended == 2);
+
+        // A clear re-arms the code.
+        AlarmCleared cleared{};
+        cleared.alarm.alarm_code = uart_error.alarm.alarm_code;
+        bus.publish(cleared);
+        bus.dispatchPending(0);   // one queue per event type: no ordering across types
+        bus.publish(uart_error);
+        bus.dispatchPending(0);
+        assert(journal.stats().appended == 4 && journal.stats().suppressed == 2);
+
+        // So does alarm_repeat_ms without a new raise; raises within it keep the code active.
+        arduino_stub::advanceMillis(9000);
+        bus.publish(uart_error);
+        bus.dispatchPending(0);
+        assert(journal.stats().appended == 4 && journal.stats().suppressed == 3);
+        arduino_stub::advanceMillis(10000);
+        bus.publish(uart_error);
+        bus.dispatchPending(0);
+        assert(journal.stats().appended == 5);
+
+        std::vector<JournalRecord> records;
+        assert(journal.query(0, UINT64_MAX, 10, records) == 5);
+        assert(records[0].type == JournalEventType::AlarmRaised && records[1].code == 1);
+        assert(records[2].type == JournalEventType::AlarmCleared && records[3].type == JournalEventType::AlarmRaised);
+        journal.end();
+    }
+
+    return 0;
+}
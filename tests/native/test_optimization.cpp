@@ -33,6 +33,87 @@ int main() {
         assert(poller.currentInterval() >= 100);
     }
 
+    {
+        AdaptivePollingConfig config{};
+        config.response_timeout_min_ms = 20;
+        config.response_timeout_max_ms = 500;
+        config.retry_delay_min_ms = 5;
+        config.retry_delay_max_ms = 50;
+        AdaptivePoller poller(config);
+
+        // No sample yet: the configured ceilings apply.
+        assert(poller.rttEstimate(0x07) == nullptr);
+        assert(poller.responseTimeoutMs(0x07) == 500);
+        assert(poller.retryDelayMs(0x07) == 50);
+
+        // First sample: SRTT = R, RTTVAR = R / 2.
+        poller.recordRtt(0x07, 12000);
+        const RttEstimate* estimate = poller.rttEstimate(0x07);
+        assert(estimate != nullptr);
+        assert(estimate->srtt_us == 12000 && estimate->rttvar_us == 6000);
+        assert(poller.responseTimeoutMs(0x07) == 36);        // 12 + 4 * 6 ms
+        assert(poller.retryDelayMs(0x07) == 24);
+
+        // A steady link shrinks the variance, down to the floors.
+        for (int i = 0; i < 40; ++i) {
+            poller.recordRtt(0x07, 12000);
+        }
+        assert(estimate->srtt_us == 12000);
+        assert(estimate->rttvar_us < 100);
+        assert(poller.responseTimeoutMs(0x07) == 20);        // 13 ms clamped to the floor
+        assert(poller.retryDelayMs(0x07) == 5);
+
+        // Consecutive timeouts double the timeout (x8 at most), a sample resets it.
+        AdaptivePollingConfig wide = config;
+        wide.response_timeout_min_ms = 1;
+        AdaptivePoller backoff(wide);
+        for (int i = 0; i < 40; ++i) {
+            backoff.recordRtt(0x09, 30000);
+        }
+        const uint32_t base = backoff.responseTimeoutMs(0x09);
+        assert(base == 31);
+        backoff.recordRttTimeout(0x09);
+        assert(backoff.responseTimeoutMs(0x09) == base * 2);
+        for (int i = 0; i < 5; ++i) {
+            backoff.recordRttTimeout(0x09);
+        }
+        assert(backoff.responseTimeoutMs(0x09) == 248);
+        for (int i = 0; i < 3; ++i) {
+            backoff.recordRttTimeout(0x09);
+        }
+        assert(backoff.rttEstimate(0x09)->backoff == 3);
+        backoff.recordRtt(0x09, 30000);
+        assert(backoff.responseTimeoutMs(0x09) == base);
+
+        // The estimate is the turnaround: a long response adds its transfer
+        // time (87 us per byte at 115200 baud) on top of the shared RTO.
+        assert(poller.responseTimeoutMs(0x07, 300) == 40);    // 13 ms + 26.1 ms of transfer
+        assert(poller.responseTimeoutMs(0x07, 7) == 20);
+
+        // Estimates are per command; the ceiling caps a slow one.
+        poller.recordRtt(0x0B, 400000);
+        assert(poller.responseTimeoutMs(0x0B) == 500);
+        assert(poller.retryDelayMs(0x0B) == 50);
+        assert(poller.responseTimeoutMs(0x07) == 20);
+
+        // Only kRttSlots commands are tracked; others keep the ceilings.
+        poller.recordRtt(0x09, 10000);
+        poller.recordRtt(0x0D, 10000);
+        poller.recordRtt(0x42, 10000);
+        assert(poller.rttEstimate(0x42) == nullptr);
+        assert(poller.responseTimeoutMs(0x42) == 500);
+
+        // Disabled: fixed configured values, estimates still kept.
+        AdaptivePollingConfig fixed = config;
+        fixed.adaptive_timeouts = false;
+        poller.configure(fixed);
+        assert(poller.rttEstimate(0x07) == nullptr);          // configure() resets
+        poller.recordRtt(0x07, 12000);
+        assert(poller.rttEstimate(0x07) != nullptr);
+        assert(poller.responseTimeoutMs(0x07) == 500);
+        assert(poller.retryDelayMs(0x07) == 50);
+    }
+
     {
         ByteRingBuffer buffer(8);
         uint8_t data[4] = {1, 2, 3, 4};
@@ -16,7 +16,9 @@ int main() {
                 "tiny_name": "Battery Pack Current",
                 "tiny_type": "FLOAT",
                 "tiny_scale_unit": "0.1 A",
-                "comment": "Sample entry"
+                "comment": "Sample entry",
+                "report_deadband": "2%",
+                "report_heartbeat_ms": 5000
             }
         }
     })JSON";
@@ -35,6 +37,10 @@ int main() {
     const TinyRegisterMetadata* current = findTinyRegisterMetadata(38);
     assert(current != nullptr);
     assert(current->unit.toStdString() == std::string("0.1 A"));
+    assert(current->report_deadband == 2.0f && current->report_deadband_percent);
+    assert(current->report_heartbeat_ms == 5000);
+    assert(voltage->report_deadband == 0.0f && !voltage->report_deadband_percent);
+    assert(voltage->report_heartbeat_ms == 60000);
 
     bool binding_found = false;
     for (const auto& binding : getTinyRegisterBindings()) {
@@ -0,0 +1,170 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_broadcast.h"
+#include "uart/tinybms_crc.h"
+#include "uart/tinybms_poll_scheduler.h"
+
+using tinybms::BroadcastListener;
+
+namespace {
+
+bool hasWord(const tinybms::RegisterStore& registers, uint16_t address) {
+    uint16_t value = 0;
+    return registers.get(address, value);
+}
+
+uint16_t wordAt(const tinybms::RegisterStore& registers, uint16_t address) {
+    uint16_t value = 0;
+    const bool found = registers.get(address, value);
+    assert(found);
+    (void)found;
+    return value;
+}
+
+std::vector<uint8_t> withCrc(std::vector<uint8_t> frame) {
+    const uint16_t crc = tinybms::crc::compute(frame.data(), frame.size());
+    frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+    frame.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF));
+    return frame;
+}
+
+void putU16(std::vector<uint8_t>& out, uint16_t v) {
+    out.push_back(static_cast<uint8_t>(v & 0xFF));
+    out.push_back(static_cast<uint8_t>(v >> 8));
+}
+
+void putU32(std::vector<uint8_t>& out, uint32_t v) {
+    putU16(out, static_cast<uint16_t>(v & 0xFFFF));
+    putU16(out, static_cast<uint16_t>(v >> 16));
+}
+
+std::vector<uint8_t> floatFrame(uint8_t command, float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    std::vector<uint8_t> frame{0xAA, command};
+    putU32(frame, bits);
+    return withCrc(frame);
+}
+
+std::vector<uint8_t> u16Frame(uint8_t command, uint16_t value) {
+    std::vector<uint8_t> frame{0xAA, command};
+    putU16(frame, value);
+    return withCrc(frame);
+}
+
+std::vector<uint8_t> u32Frame(uint8_t command, uint32_t value) {
+    std::vector<uint8_t> frame{0xAA, command};
+    putU32(frame, value);
+    return withCrc(frame);
+}
+
+std::vector<uint8_t> arrayFrame(uint8_t command, const std::vector<uint16_t>& values) {
+    std::vector<uint8_t> frame{0xAA, command, static_cast<uint8_t>(values.size() * 2U)};
+    for (uint16_t v : values) {
+        putU16(frame, v);
+    }
+    return withCrc(frame);
+}
+
+void append(std::vector<uint8_t>& stream, const std::vector<uint8_t>& frame) {
+    stream.insert(stream.end(), frame.begin(), frame.end());
+}
+
+} // namespace
+
+int main() {
+    // One broadcast burst, with line noise and a corrupted frame in the middle.
+    std::vector<uint8_t> stream{0x00, 0x13};
+    append(stream, floatFrame(0x14, 53.12f));
+    append(stream, floatFrame(0x15, -12.3f));
+    std::vector<uint8_t> corrupted = u16Frame(0x16, 3650);
+    corrupted[3] ^= 0x40;
+    append(stream, corrupted);
+    append(stream, u16Frame(0x17, 3301));
+    append(stream, u16Frame(0x18, 0x97));
+    append(stream, u32Frame(0x19, 0x00012345));
+    append(stream, u32Frame(0x1A, 87654321));          // 87.654321 %
+    append(stream, arrayFrame(0x1B, {251, static_cast<uint16_t>(-45), 198}));
+    append(stream, arrayFrame(0x1C, {33012, 33007, 32995, 33020}));
+
+    // Byte-at-a-time delivery must give the same result as one chunk.
+    for (size_t chunk : {stream.size(), static_cast<size_t>(1), static_cast<size_t>(7)}) {
+        BroadcastListener listener;
+        for (size_t offset = 0; offset < stream.size(); offset += chunk) {
+            const size_t n = std::min(chunk, stream.size() - offset);
+            listener.feed(stream.data() + offset, n, 1000);
+        }
+
+        assert(listener.stats().frames == 8);
+        assert(listener.parserStats().crc_errors >= 1);
+
+        // Layout over the mapped registers plus the cell voltages (0..3).
+        std::vector<uint16_t> layout = tinybms::collectPollAddresses(getTinyRegisterBindings());
+        layout.insert(layout.begin(), {0, 1, 2, 3});
+        tinybms::RegisterStore registers;
+        registers.configure(layout);
+        const uint8_t mask = listener.takeUpdates(registers);
+        assert(mask & tinybms::refreshClassBit(TinyRegisterRefreshClass::Fast));
+        assert(mask & tinybms::refreshClassBit(TinyRegisterRefreshClass::Normal));
+
+        // Scaled exactly as the register map decodes them.
+        assert(wordAt(registers, 36) == 5312);
+        assert(static_cast<int16_t>(wordAt(registers, 38)) == -123);
+        assert(!hasWord(registers, 41));             // its frame was corrupted
+        assert(wordAt(registers, 40) == 3301);
+        assert(wordAt(registers, 50) == 0x97);
+        assert(wordAt(registers, 32) == 0x2345 && wordAt(registers, 33) == 0x0001);
+        assert(wordAt(registers, 46) == 877);
+        assert(wordAt(registers, 48) == 251);
+        assert(static_cast<int16_t>(wordAt(registers, 42)) == -45);
+        assert(wordAt(registers, 43) == 198);
+        assert(wordAt(registers, 0) == 33012 && wordAt(registers, 3) == 33020);
+
+        // Drained once.
+        tinybms::RegisterStore again;
+        again.configure(layout);
+        assert(listener.takeUpdates(again) == 0 && again.validCount() == 0);
+    }
+
+    // Coverage follows each frame type's own period and goes stale.
+    {
+        BroadcastListener listener;
+        assert(!listener.active(0));
+        const std::vector<uint8_t> voltage = floatFrame(0x14, 50.0f);
+        const std::vector<uint8_t> soc = u32Frame(0x1A, 50000000);
+        listener.feed(voltage.data(), voltage.size(), 1000);
+        listener.feed(soc.data(), soc.size(), 1000);
+        listener.feed(voltage.data(), voltage.size(), 1200);
+        listener.feed(voltage.data(), voltage.size(), 1400);
+
+        assert((listener.coveredAddresses(1500) == std::vector<uint16_t>{36, 46}));
+        // Voltage (period 200 ms) goes stale after 2.5 periods; SOC has a single
+        // frame and keeps its first-frame grace.
+        assert((listener.coveredAddresses(2000) == std::vector<uint16_t>{46}));
+        assert(listener.active(2000));
+        assert(listener.coveredAddresses(3000).empty());
+        assert(!listener.active(3000));
+    }
+
+    // Broadcast registers drop out of the poll plan; the rest is still polled.
+    {
+        tinybms::PollScheduler scheduler;
+        tinybms::ReadPlanCostModel model{};
+        const uint8_t fast = tinybms::refreshClassBit(TinyRegisterRefreshClass::Fast);
+        const tinybms::ReadPlan full = scheduler.planFor(fast, model);
+        assert((full.addresses == std::vector<uint16_t>{36, 38, 40, 41, 46, 51}));
+
+        scheduler.setExcludedAddresses({46, 36, 38, 40, 41});
+        assert((scheduler.planFor(fast, model).addresses == std::vector<uint16_t>{51}));
+        assert(scheduler.planFor(fast, model).wire_bytes < full.wire_bytes);
+
+        scheduler.setExcludedAddresses({});
+        assert(scheduler.planFor(fast, model).addresses == full.addresses);
+    }
+
+    return 0;
+}
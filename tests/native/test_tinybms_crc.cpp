@@ -0,0 +1,113 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "uart/tinybms_crc.h"
+
+using tinybms::crc::Crc16Mode;
+
+namespace {
+
+constexpr Crc16Mode kModes[] = {Crc16Mode::Bytewise, Crc16Mode::SliceBy4, Crc16Mode::SliceBy8};
+
+uint16_t computeWith(Crc16Mode mode, const std::vector<uint8_t>& data) {
+    return tinybms::crc::update(tinybms::crc::kModbusInitialState, data.data(), data.size(), mode);
+}
+
+// 39-register 0x09 poll frame documented in docs/tinybms_uart_request_plan.md (CRC = 0x55BB).
+std::vector<uint8_t> buildDocumentedPollFrame() {
+    const uint16_t addresses[] = {
+        0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029,
+        0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033,
+        0x0034, 0x0066, 0x0067, 0x0071, 0x0072, 0x0131, 0x0132, 0x0133, 0x013B, 0x013C,
+        0x013D, 0x013E, 0x013F, 0x01F4, 0x01F5, 0x01F6, 0x01F7, 0x01F8, 0x01F9
+    };
+    std::vector<uint8_t> frame{0xAA, 0x09, 0x4E};
+    for (uint16_t addr : addresses) {
+        frame.push_back(static_cast<uint8_t>(addr & 0xFF));
+        frame.push_back(static_cast<uint8_t>((addr >> 8) & 0xFF));
+    }
+    return frame;
+}
+
+} // namespace
+
+int main() {
+    static_assert(tinybms::crc::kModbusTable[0] == 0x0000, "table[0]");
+    static_assert(tinybms::crc::kModbusTable[1] == 0xC0C1, "table[1]");
+    static_assert(tinybms::crc::kModbusTable[255] == 0x4040, "table[255]");
+
+    // Golden vectors
+    {
+        const char* check = "123456789";
+        std::vector<uint8_t> data(check, check + std::strlen(check));
+        for (Crc16Mode mode : kModes) {
+            assert(computeWith(mode, data) == 0x4B37);
+        }
+        assert(tinybms::crc::computeBitwise(data.data(), data.size()) == 0x4B37);
+    }
+
+    {
+        std::vector<uint8_t> modbus_request{0x01, 0x03, 0x00, 0x00, 0x00, 0x01};
+        for (Crc16Mode mode : kModes) {
+            assert(computeWith(mode, modbus_request) == 0x0A84);
+        }
+    }
+
+    {
+        std::vector<uint8_t> frame = buildDocumentedPollFrame();
+        for (Crc16Mode mode : kModes) {
+            assert(computeWith(mode, frame) == 0x55BB);
+        }
+    }
+
+    {
+        assert(tinybms::crc::compute(nullptr, 0) == tinybms::crc::kModbusInitialState);
+        const uint8_t byte = 0x42;
+        assert(tinybms::crc::update(0x1234, &byte, 0) == 0x1234);
+    }
+
+    // Every mode and every split point must match the bitwise reference.
+    {
+        std::vector<uint8_t> data(256);
+        uint32_t seed = 0x12345678u;
+        for (auto& b : data) {
+            seed = seed * 1103515245u + 12345u;
+            b = static_cast<uint8_t>(seed >> 16);
+        }
+
+        for (size_t length = 0; length <= data.size(); ++length) {
+            const uint16_t expected = tinybms::crc::computeBitwise(data.data(), length);
+            for (Crc16Mode mode : kModes) {
+                assert(tinybms::crc::update(tinybms::crc::kModbusInitialState, data.data(), length, mode) == expected);
+            }
+
+            for (size_t split = 0; split <= length; split += 7) {
+                for (Crc16Mode mode : kModes) {
+                    uint16_t state = tinybms::crc::kModbusInitialState;
+                    state = tinybms::crc::update(state, data.data(), split, mode);
+                    state = tinybms::crc::update(state, data.data() + split, length - split, mode);
+                    assert(state == expected);
+                }
+            }
+
+            uint16_t state = tinybms::crc::kModbusInitialState;
+            for (size_t i = 0; i < length; ++i) {
+                state = tinybms::crc::updateByte(state, data[i]);
+            }
+            assert(state == expected);
+        }
+    }
+
+    // Appending the CRC (LSB first) yields a zero residue.
+    {
+        std::vector<uint8_t> frame{0xAA, 0x07, 0x02, 0x2C, 0x01};
+        const uint16_t crc = tinybms::crc::compute(frame.data(), frame.size());
+        frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+        frame.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF));
+        assert(tinybms::crc::compute(frame.data(), frame.size()) == 0x0000);
+    }
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+#include <Arduino.h>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "event/event_types_v2.h"
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_decode_plan.h"
+#include "uart/tinybms_decoder.h"
+#include "uart/tinybms_read_planner.h"
+#include "uart/tinybms_register_store.h"
+
+using tinybms::DecodePlan;
+using tinybms::RegisterStore;
+using tinybms::events::MqttRegisterEvent;
+
+namespace {
+
+const std::map<uint16_t, uint16_t> kRegisters{
+    {32, 0xABCD}, {33, 0x0001},
+    {36, 5200},
+    {38, static_cast<uint16_t>(static_cast<int16_t>(-85))},
+    {40, 3100}, {41, 3275},
+    {42, static_cast<uint16_t>(static_cast<int16_t>(-45))}, {43, 198},
+    {45, 940}, {46, 815},
+    {48, static_cast<uint16_t>(static_cast<int16_t>(-52))},
+    {50, 0x0097}, {51, 0x0003}, {52, 0x0010},
+    {102, 450}, {103, 320},
+    {113, static_cast<uint16_t>((static_cast<uint8_t>(-3) << 8) | 4)},   // max -3 °C, min 4 °C
+    {305, 16}, {306, 28000}, {307, 3},
+    {315, 3400}, {316, 2800}, {317, 120}, {318, 100}, {319, 55},
+    {500, static_cast<uint16_t>(('T' << 8) | 'i')},
+    {501, static_cast<uint16_t>(('n' << 8) | 'y')},
+    {502, static_cast<uint16_t>(('B' << 8) | 'M')},
+    {503, static_cast<uint16_t>(('S' << 8) | '\0')},
+    {504, 2}, {505, 7},
+};
+
+bool sameSnapshots(const TinyBMS_LiveData& a, const TinyBMS_LiveData& b) {
+    if (a.snapshotCount() != b.snapshotCount()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.snapshotCount(); ++i) {
+        const TinyRegisterSnapshot& x = a.snapshotAt(i);
+        const TinyRegisterSnapshot& y = b.snapshotAt(i);
+        if (x.address != y.address || x.raw_value != y.raw_value || x.type != y.type ||
+            x.raw_word_count != y.raw_word_count || x.has_text != y.has_text ||
+            std::strcmp(x.text_value.c_str(), y.text_value.c_str()) != 0 ||
+            std::memcmp(x.raw_words, y.raw_words, sizeof(x.raw_words)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool sameFields(const TinyBMS_LiveData& a, const TinyBMS_LiveData& b) {
+    return a.voltage == b.voltage && a.current == b.current &&
+           a.min_cell_mv == b.min_cell_mv && a.max_cell_mv == b.max_cell_mv &&
+           a.soc_raw == b.soc_raw && a.soh_raw == b.soh_raw &&
+           a.soc_percent == b.soc_percent && a.soh_percent == b.soh_percent &&
+           a.temperature == b.temperature &&
+           a.pack_temp_min == b.pack_temp_min && a.pack_temp_max == b.pack_temp_max &&
+           a.online_status == b.online_status && a.balancing_bits == b.balancing_bits &&
+           a.max_charge_current == b.max_charge_current && a.max_discharge_current == b.max_discharge_current &&
+           a.cell_imbalance_mv == b.cell_imbalance_mv &&
+           a.cell_overvoltage_mv == b.cell_overvoltage_mv && a.cell_undervoltage_mv == b.cell_undervoltage_mv &&
+           a.discharge_overcurrent_a == b.discharge_overcurrent_a &&
+           a.charge_overcurrent_a == b.charge_overcurrent_a && a.overheat_cutoff_c == b.overheat_cutoff_c;
+}
+
+} // namespace
+
+int main() {
+    const auto& bindings = getTinyRegisterBindings();
+
+    // Same LiveData, snapshots and MQTT events as the per-binding decoder.
+    {
+        RegisterStore store;
+        store.ensureLayout(bindings, getTinyReadMappingVersion());
+        for (const auto& entry : kRegisters) {
+            store.set(entry.first, entry.second);
+        }
+        DecodePlan plan;
+        assert(plan.ensureCompiled(bindings, store));
+        assert(!plan.ensureCompiled(bindings, store));
+        assert(plan.size() == bindings.size());
+
+        TinyBMS_LiveData legacy{};
+        legacy.resetSnapshots();
+        std::vector<MqttRegisterEvent> legacy_events;
+        for (const auto& binding : bindings) {
+            MqttRegisterEvent event{};
+            if (tinybms::uart::detail::decodeAndApplyBinding(binding, kRegisters, legacy, 42, &event)) {
+                legacy_events.push_back(event);
+            }
+        }
+
+        TinyBMS_LiveData compiled{};
+        compiled.resetSnapshots();
+        std::vector<MqttRegisterEvent> events;
+        assert(plan.apply(store, compiled, 42, tinybms::kAllRefreshClasses, &events) == legacy_events.size());
+
+        assert(sameFields(legacy, compiled));
+        assert(sameSnapshots(legacy, compiled));
+        assert(events.size() == legacy_events.size());
+        for (size_t i = 0; i < events.size(); ++i) {
+            assert(events[i].address == legacy_events[i].address);
+            assert(events[i].raw_value == legacy_events[i].raw_value);
+            assert(events[i].value_type == legacy_events[i].value_type);
+            assert(events[i].raw_word_count == legacy_events[i].raw_word_count);
+            assert(events[i].timestamp_ms == 42);
+            assert(events[i].has_text == legacy_events[i].has_text);
+            assert(std::strcmp(events[i].text_value, legacy_events[i].text_value) == 0);
+        }
+
+        assert(std::fabs(compiled.current + 8.5f) < 1e-6f);
+        assert(compiled.pack_temp_min == 40 && compiled.pack_temp_max == -30);
+        assert(compiled.temperature == -52);
+        const TinyRegisterSnapshot* name = compiled.findSnapshot(500);
+        assert(name != nullptr && std::string(name->text_value.c_str()) == "TinyBMS");
+
+        // Events only for the requested refresh classes.
+        const uint8_t fast = tinybms::refreshClassBit(TinyRegisterRefreshClass::Fast);
+        std::vector<MqttRegisterEvent> fast_events;
+        compiled.resetSnapshots();
+        plan.apply(store, compiled, 43, fast, &fast_events);
+        assert(!fast_events.empty() && fast_events.size() < events.size());
+        for (const auto& event : fast_events) {
+            const TinyRegisterRuntimeBinding* binding = findTinyRegisterBinding(event.address);
+            assert(binding != nullptr && binding->refresh_class == TinyRegisterRefreshClass::Fast);
+        }
+        assert(compiled.snapshotCount() == events.size());   // decoding itself is not filtered
+
+        // Cycle batch: same events in one contiguous array; overflow is counted, not written.
+        tinybms::events::RegisterCycleBatch batch;
+        compiled.resetSnapshots();
+        assert(plan.apply(store, compiled, 42, tinybms::kAllRefreshClasses, &batch) == events.size());
+        assert(batch.size() == events.size() && batch.dropped == 0);
+        size_t index = 0;
+        for (const auto& entry : batch) {
+            assert(entry.address == events[index].address && entry.raw_value == events[index].raw_value);
+            assert(std::strcmp(entry.text_value, events[index].text_value) == 0);
+            index++;
+        }
+        batch.count = static_cast<uint16_t>(tinybms::events::kRegisterCycleCapacity - 1);
+        compiled.resetSnapshots();
+        plan.apply(store, compiled, 44, tinybms::kAllRefreshClasses, &batch);
+        assert(batch.size() == tinybms::events::kRegisterCycleCapacity);
+        assert(batch.dropped == events.size() - 1);
+        batch.clear();
+        assert(batch.empty() && batch.dropped == 0);
+    }
+
+    // Missing words skip their step only; a new layout recompiles the plan.
+    {
+        RegisterStore store;
+        store.ensureLayout(bindings, getTinyReadMappingVersion());
+        DecodePlan plan;
+        plan.ensureCompiled(bindings, store);
+
+        TinyBMS_LiveData live{};
+        live.resetSnapshots();
+        assert(plan.apply(store, live, 0) == 0);
+        assert(live.snapshotCount() == 0);
+
+        store.set(36, 5310);
+        store.set(32, 1);   // lifetime counter: 33 still missing
+        live.resetSnapshots();
+        assert(plan.apply(store, live, 0) == 1);
+        assert(std::fabs(live.voltage - 53.1f) < 1e-4f);
+        assert(live.findSnapshot(32) == nullptr);
+
+        store.configure({36, 38});
+        assert(plan.ensureCompiled(bindings, store));
+        assert(plan.size() == 2);
+        live.resetSnapshots();
+        assert(plan.apply(store, live, 0) == 1);               // 36 kept across the new layout
+    }
+
+    // Destination table mirrors TinyBMS_LiveData::applyField().
+    {
+        using tinybms::LiveFieldWrite;
+        assert(tinybms::liveFieldDestination(TinyLiveDataField::None).write == LiveFieldWrite::None);
+        assert(tinybms::liveFieldDestination(TinyLiveDataField::NeedBalancing).write == LiveFieldWrite::None);
+        assert(tinybms::liveFieldDestination(TinyLiveDataField::SocPercent).write == LiveFieldWrite::ScaledWithRaw);
+        assert(tinybms::liveFieldDestination(TinyLiveDataField::OverheatCutoffC).write == LiveFieldWrite::Raw);
+        assert(tinybms::liveFieldDestination(static_cast<TinyLiveDataField>(200)).write == LiveFieldWrite::None);
+    }
+
+    return 0;
+}
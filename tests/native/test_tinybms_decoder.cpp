@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <string>
 #include <vector>
@@ -78,11 +79,11 @@ int main() {
 
         const TinyRegisterSnapshot* manufacturer = live.findSnapshot(500);
         assert(manufacturer != nullptr);
-        assert(manufacturer->text_value.toStdString() == std::string("TinyBMS"));
+        assert(std::string(manufacturer->text_value.c_str()) == std::string("TinyBMS"));
 
         const TinyRegisterSnapshot* firmware = live.findSnapshot(501);
         assert(firmware != nullptr);
-        assert(firmware->text_value.toStdString() == std::string("28281.16973"));
+        assert(std::string(firmware->text_value.c_str()) == std::string("28281.16973"));
 
         bool saw_soc_event = false;
         for (const auto& evt : events) {
@@ -99,6 +100,31 @@ int main() {
         assert(saw_soc_event);
 
         assert(live.snapshotCount() >= events.size());
+
+        // Text is stored inline: a plain memcpy is a complete, independent copy.
+        TinyBMS_LiveData copy;
+        std::memcpy(&copy, &live, sizeof(copy));
+        std::memset(&live, 0, sizeof(live));
+        const TinyRegisterSnapshot* copied = copy.findSnapshot(500);
+        assert(copied != nullptr && copied->has_text);
+        assert(std::strcmp(copied->text_value.c_str(), "TinyBMS") == 0);
+        assert(String(copied->text_value).toStdString() == std::string("TinyBMS"));   // String shim
+    }
+
+    // Inline text truncates at TINY_REGISTER_TEXT_CAPACITY; the String overload goes through it.
+    {
+        TinyBMS_LiveData live{};
+        live.resetSnapshots();
+        const String long_text("0123456789ABCDEFGHIJ");
+        assert(live.appendSnapshot(500, TinyRegisterValueType::String, 0, 8, &long_text, nullptr));
+        const TinyRegisterSnapshot& snap = live.snapshotAt(0);
+        assert(snap.has_text);
+        assert(snap.text_value.length() == TINY_REGISTER_TEXT_CAPACITY);
+        assert(std::strcmp(snap.text_value.c_str(), "0123456789ABCDEF") == 0);
+
+        const String empty;
+        assert(live.appendSnapshot(501, TinyRegisterValueType::String, 0, 1, &empty, nullptr));
+        assert(!live.snapshotAt(1).has_text && live.snapshotAt(1).text_value.length() == 0);
     }
 
     {
@@ -0,0 +1,174 @@
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "optimization/ring_buffer.h"
+#include "uart/tinybms_crc.h"
+#include "uart/tinybms_frame_parser.h"
+
+using tinybms::FrameParser;
+using tinybms::FrameView;
+
+namespace {
+
+std::vector<uint8_t> withCrc(std::vector<uint8_t> frame) {
+    const uint16_t crc = tinybms::crc::compute(frame.data(), frame.size());
+    frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+    frame.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF));
+    return frame;
+}
+
+std::vector<uint8_t> buildListResponse(const std::vector<uint16_t>& values) {
+    std::vector<uint8_t> frame{0xAA, 0x09, static_cast<uint8_t>(values.size() * 2U)};
+    for (uint16_t v : values) {
+        frame.push_back(static_cast<uint8_t>(v & 0xFF));
+        frame.push_back(static_cast<uint8_t>((v >> 8) & 0xFF));
+    }
+    return withCrc(frame);
+}
+
+FrameParser::Expectation listExpectation(size_t register_count) {
+    FrameParser::Expectation expectation{};
+    expectation.command = 0x09;
+    expectation.payload_length = static_cast<uint16_t>(register_count * 2U);
+    return expectation;
+}
+
+void assertListFrame(const FrameParser& parser, const std::vector<uint16_t>& values) {
+    assert(parser.frameReady());
+    FrameView view = parser.frame();
+    assert(view.data != nullptr);
+    assert(view.length == 3 + values.size() * 2U);
+    assert(view.data[0] == 0xAA && view.data[1] == 0x09);
+    for (size_t i = 0; i < values.size(); ++i) {
+        const uint16_t word = static_cast<uint16_t>(view.data[3 + i * 2] | (view.data[4 + i * 2] << 8));
+        assert(word == values[i]);
+    }
+}
+
+} // namespace
+
+int main() {
+    const std::vector<uint16_t> values{0x1234, 0xAAAA, 0x00AA};
+    const std::vector<uint8_t> frame = buildListResponse(values);
+
+    // Whole frame in one chunk; bytesNeeded() equals the frame length up front.
+    {
+        FrameParser parser;
+        parser.reset(listExpectation(values.size()));
+        assert(parser.bytesNeeded() == frame.size());
+        assert(parser.feed(frame.data(), frame.size()) == frame.size());
+        assertListFrame(parser, values);
+        assert(parser.bytesNeeded() == 0);
+        assert(parser.stats().frames_ok == 1);
+        assert(parser.stats().garbage_bytes == 0);
+    }
+
+    // Byte-at-a-time delivery.
+    {
+        FrameParser parser;
+        parser.reset(listExpectation(values.size()));
+        for (size_t i = 0; i < frame.size(); ++i) {
+            assert(!parser.frameReady());
+            assert(parser.bytesNeeded() == frame.size() - i);
+            parser.feed(&frame[i], 1);
+        }
+        assertListFrame(parser, values);
+    }
+
+    // Line noise, including a stray preamble, ahead of the real frame.
+    {
+        std::vector<uint8_t> stream{0x00, 0xFF, 0xAA, 0x13, 0x37};
+        stream.insert(stream.end(), frame.begin(), frame.end());
+        stream.push_back(0x55); // trailing byte is left to the caller
+
+        FrameParser parser;
+        parser.reset(listExpectation(values.size()));
+        const size_t consumed = parser.feed(stream.data(), stream.size());
+        assert(consumed == stream.size() - 1);
+        assertListFrame(parser, values);
+        assert(parser.stats().resync_count == 1);
+        assert(parser.stats().garbage_bytes == 5);
+        assert(parser.stats().crc_errors == 0);
+    }
+
+    // Corrupted frame immediately followed by a good one: CRC failure, resync,
+    // and the second copy is recovered from the same stream.
+    {
+        std::vector<uint8_t> corrupted = frame;
+        corrupted[4] ^= 0x01;
+        std::vector<uint8_t> stream = corrupted;
+        stream.insert(stream.end(), frame.begin(), frame.end());
+
+        FrameParser parser;
+        parser.reset(listExpectation(values.size()));
+        parser.feed(stream.data(), stream.size());
+        assertListFrame(parser, values);
+        assert(parser.stats().crc_errors >= 1);
+        assert(parser.stats().resync_count >= 1);
+    }
+
+    // Wrong payload length for the expected command is treated as a false sync.
+    {
+        std::vector<uint8_t> shorter = buildListResponse({0x0101});
+        std::vector<uint8_t> stream = shorter;
+        stream.insert(stream.end(), frame.begin(), frame.end());
+
+        FrameParser parser;
+        parser.reset(listExpectation(values.size()));
+        parser.feed(stream.data(), stream.size());
+        assertListFrame(parser, values);
+        assert(parser.stats().resync_count >= 1);
+    }
+
+    // Rev D NACK (AA 00 CMD ERR) is framed so the caller can fail fast.
+    {
+        std::vector<uint8_t> nack = withCrc({0xAA, 0x00, 0x09, 0x01});
+        FrameParser parser;
+        parser.reset(listExpectation(values.size()));
+        parser.feed(nack.data(), nack.size());
+        assert(parser.frameReady());
+        assert(parser.frame().length == 4);
+        assert(parser.frame().data[1] == 0x00);
+    }
+
+    // ACK for write commands.
+    {
+        std::vector<uint8_t> ack = withCrc({0xAA, 0x01, 0x00});
+        FrameParser parser;
+        parser.reset(FrameParser::Expectation{});
+        assert(parser.bytesNeeded() == 5);
+        parser.feed(ack.data(), ack.size());
+        assert(parser.frameReady());
+        assert(parser.frame().length == 3);
+    }
+
+    // Partial frame abandoned on timeout.
+    {
+        FrameParser parser;
+        parser.reset(listExpectation(values.size()));
+        parser.feed(frame.data(), 4);
+        assert(parser.hasPartialFrame());
+        assert(parser.bytesNeeded() == frame.size() - 4);
+        assert(parser.abandonPartialFrame());
+        assert(!parser.hasPartialFrame());
+        assert(parser.stats().partial_frames == 1);
+        assert(!parser.abandonPartialFrame());
+    }
+
+    // Bytes staged in a ByteRingBuffer.
+    {
+        optimization::ByteRingBuffer ring(64);
+        const uint8_t noise[] = {0x01, 0x02};
+        ring.push(noise, sizeof(noise));
+        ring.push(frame.data(), frame.size());
+
+        FrameParser parser;
+        parser.reset(listExpectation(values.size()));
+        assert(parser.feed(ring) == sizeof(noise) + frame.size());
+        assertListFrame(parser, values);
+        assert(ring.empty());
+    }
+
+    return 0;
+}
@@ -0,0 +1,200 @@
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "hal/replay_uart.h"
+#include "uart/tinybms_crc.h"
+#include "uart/tinybms_latency_histogram.h"
+#include "uart/tinybms_uart_client.h"
+
+using tinybms::AttemptStatus;
+using tinybms::LatencyHistogram;
+using tinybms::UartLatencyStats;
+using tinybms::UartTraceDirection;
+using tinybms::UartTraceEvent;
+
+namespace {
+
+std::vector<uint8_t> withCrc(std::vector<uint8_t> frame) {
+    const uint16_t crc = tinybms::crc::compute(frame.data(), frame.size());
+    frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+    frame.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF));
+    return frame;
+}
+
+UartTraceEvent event(uint32_t t, UartTraceDirection direction, std::vector<uint8_t> bytes) {
+    UartTraceEvent e;
+    e.timestamp_ms = t;
+    e.direction = direction;
+    e.bytes = std::move(bytes);
+    return e;
+}
+
+struct Harness {
+    hal::ReplayUart* uart;
+    UartLatencyStats* stats;
+};
+
+void advance(uint32_t delay_ms, void* context) {
+    static_cast<Harness*>(context)->uart->advance(delay_ms);
+}
+
+uint32_t clockUs(void* context) {
+    return static_cast<Harness*>(context)->uart->nowUs();
+}
+
+void recordAttempt(const tinybms::AttemptTiming& timing, void* context) {
+    static_cast<Harness*>(context)->stats->record(timing);
+}
+
+} // namespace
+
+int main() {
+    // Bucket layout: 4 sub-buckets per octave above 128 us.
+    assert(LatencyHistogram::bucketIndex(0) == 0);
+    assert(LatencyHistogram::bucketIndex(127) == 0);
+    assert(LatencyHistogram::bucketIndex(128) == 1);
+    assert(LatencyHistogram::bucketIndex(159) == 1);
+    assert(LatencyHistogram::bucketIndex(160) == 2);
+    assert(LatencyHistogram::bucketIndex(256) == 5);
+    assert(LatencyHistogram::bucketIndex(UINT32_MAX) == LatencyHistogram::kBucketCount - 1);
+    for (uint32_t v : {130u, 1000u, 20000u, 1500000u}) {
+        const size_t index = LatencyHistogram::bucketIndex(v);
+        assert(v < LatencyHistogram::bucketUpperUs(index));
+        assert(index == 0 || v >= LatencyHistogram::bucketUpperUs(index - 1));
+    }
+
+    // Percentiles: nearest rank, reported as the bucket's upper bound.
+    {
+        LatencyHistogram histogram;
+        assert(histogram.percentileUs(50.0f) == 0);
+        for (int i = 0; i < 98; ++i) {
+            histogram.record(10000);                  // bucket [8192, 10240)
+        }
+        histogram.record(90000);
+        histogram.record(250000);
+        assert(histogram.count() == 100);
+        assert(histogram.percentileUs(50.0f) == 10240);
+        assert(histogram.percentileUs(98.0f) == 10240);
+        assert(histogram.percentileUs(99.0f) == 98304);
+        assert(histogram.percentileUs(100.0f) == 250000);   // capped by the max
+        assert(histogram.maxUs() == 250000);
+        histogram.reset();
+        assert(histogram.count() == 0 && histogram.maxUs() == 0);
+    }
+
+    // Client attempts split into first byte and transfer time per outcome.
+    {
+        const std::vector<uint8_t> request = withCrc({0xAA, 0x07, 0x02, 0x24, 0x00});
+        const std::vector<uint8_t> response = withCrc({0xAA, 0x07, 0x04, 0xC0, 0x14, 0x85, 0xFF});
+        const std::vector<uint8_t> header(response.begin(), response.begin() + 3);
+        const std::vector<uint8_t> body(response.begin() + 3, response.end());
+
+        const std::vector<UartTraceEvent> trace{
+            event(0, UartTraceDirection::Tx, request),                 // lost: timeout
+            event(100, UartTraceDirection::Tx, request),
+            event(120, UartTraceDirection::Rx, header),                // 20 ms to first byte
+            event(126, UartTraceDirection::Rx, body),                  // 6 ms transfer
+        };
+        hal::ReplayUart uart(trace, 1.0f);
+        UartLatencyStats stats;
+        Harness harness{&uart, &stats};
+
+        tinybms::TransactionOptions options{};
+        options.attempt_count = 2;
+        options.response_timeout_ms = 100;
+        tinybms::DelayConfig delay{advance, &harness, clockUs, recordAttempt};
+
+        uint16_t values[2] = {};
+        const tinybms::TransactionResult result = tinybms::readRegisterBlock(uart, 0x24, 2, values, options, delay);
+        assert(result.success);
+        assert(values[0] == 0x14C0);
+
+        const auto snapshot = stats.snapshot();
+        assert(snapshot.size() == 2);
+        assert(snapshot[0].command == 0x07 && snapshot[0].outcome == AttemptStatus::Success);
+        assert(snapshot[0].attempts == 1);
+        assert(snapshot[0].first_byte.count == 1);
+        assert(snapshot[0].first_byte.max_us == 20000);
+        assert(snapshot[0].transfer.max_us == 6000);
+        assert(snapshot[1].outcome == AttemptStatus::Timeout);
+        assert(snapshot[1].attempts == 1);
+        assert(snapshot[1].first_byte.count == 0);   // nothing arrived, nothing to time
+
+        // Unknown commands are counted, not binned.
+        tinybms::AttemptTiming odd{};
+        odd.command = 0x42;
+        odd.status = AttemptStatus::Success;
+        stats.record(odd);
+        assert(stats.untimedAttempts() == 1);
+
+        stats.reset();
+        assert(stats.snapshot().empty());
+        assert(stats.untimedAttempts() == 0);
+    }
+
+    // tune_fn overrides the response timeout and retry delay per command.
+    {
+        const std::vector<uint8_t> request = withCrc({0xAA, 0x07, 0x01, 0x24, 0x00});
+        hal::ReplayUart uart({event(0, UartTraceDirection::Tx, request),
+                              event(50, UartTraceDirection::Tx, request)}, 1.0f);
+        UartLatencyStats stats;
+        Harness harness{&uart, &stats};
+        tinybms::TransactionOptions options{};
+        options.attempt_count = 2;
+        options.response_timeout_ms = 100;
+        options.retry_delay_ms = 50;
+        tinybms::DelayConfig delay{advance, &harness, clockUs, recordAttempt,
+                                   [](uint8_t command, size_t response_bytes, uint32_t& timeout_ms,
+                                      uint32_t& retry_delay_ms, void*) {
+                                       assert(command == 0x07);
+                                       assert(response_bytes == 7);   // AA 07 02 + 1 word + CRC
+                                       assert(timeout_ms == 100 && retry_delay_ms == 50);
+                                       timeout_ms = 30;
+                                       retry_delay_ms = 5;
+                                   }};
+        uint16_t value = 0;
+        const tinybms::TransactionResult result = tinybms::readRegisterBlock(uart, 0x24, 1, &value, options, delay);
+        assert(!result.success);
+        assert(result.timeout_count == 2);
+        assert(uart.nowMs() == 30 + 5 + 30);
+        assert(uart.getTimeout() == 100);                 // restored after the transaction
+    }
+
+    // A response trickling in chunks cannot stretch an attempt past its
+    // timeout: each read only gets the time left.
+    {
+        const std::vector<uint8_t> request = withCrc({0xAA, 0x07, 0x01, 0x24, 0x00});
+        const std::vector<uint8_t> response = withCrc({0xAA, 0x07, 0x02, 0x34, 0x12});
+        hal::ReplayUart uart({event(0, UartTraceDirection::Tx, request),
+                              event(60, UartTraceDirection::Rx, {response.begin(), response.begin() + 3}),
+                              event(150, UartTraceDirection::Rx, {response.begin() + 3, response.end()})},
+                             1.0f);
+        UartLatencyStats stats;
+        Harness harness{&uart, &stats};
+        tinybms::TransactionOptions options{};
+        options.attempt_count = 1;
+        options.response_timeout_ms = 100;
+        tinybms::DelayConfig delay{advance, &harness, clockUs, recordAttempt};
+        uint16_t value = 0;
+        const tinybms::TransactionResult result = tinybms::readRegisterBlock(uart, 0x24, 1, &value, options, delay);
+        assert(!result.success);
+        assert(result.timeout_count == 1);
+        assert(uart.nowMs() == 100);
+    }
+
+    // Without a clock the client does not report attempts.
+    {
+        const std::vector<uint8_t> request = withCrc({0xAA, 0x07, 0x01, 0x24, 0x00});
+        hal::ReplayUart uart({event(0, UartTraceDirection::Tx, request)}, 0.0f);
+        UartLatencyStats stats;
+        Harness harness{&uart, &stats};
+        tinybms::TransactionOptions options{};
+        tinybms::DelayConfig delay{advance, &harness};
+        uint16_t value = 0;
+        tinybms::readRegisterBlock(uart, 0x24, 1, &value, options, delay);
+        assert(stats.snapshot().empty());
+    }
+
+    return 0;
+}
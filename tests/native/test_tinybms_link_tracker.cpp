@@ -0,0 +1,158 @@
+#include <cassert>
+#include <cstdint>
+
+#include "uart/tinybms_link_tracker.h"
+
+using tinybms::LinkTracker;
+using tinybms::TransactionResult;
+
+namespace {
+
+TransactionResult ok() {
+    TransactionResult result{};
+    result.success = true;
+    result.last_status = tinybms::AttemptStatus::Success;
+    return result;
+}
+
+// First attempt of the first request timed out, the retry worked.
+TransactionResult okAfterTimeout() {
+    TransactionResult result = ok();
+    result.timeout_count = 1;
+    result.retries_performed = 1;
+    result.first_attempt_timed_out = true;
+    return result;
+}
+
+// A later request of the cycle needed a retry: says nothing about sleep.
+TransactionResult okAfterLateTimeout() {
+    TransactionResult result = ok();
+    result.timeout_count = 1;
+    result.retries_performed = 1;
+    return result;
+}
+
+TransactionResult failed() {
+    TransactionResult result{};
+    result.timeout_count = 3;
+    result.retries_performed = 2;
+    result.last_status = tinybms::AttemptStatus::Timeout;
+    result.first_attempt_timed_out = true;
+    return result;
+}
+
+} // namespace
+
+int main() {
+    tinybms::LinkTrackerConfig config{};
+    config.initial_sleep_threshold_ms = 1000;
+    config.min_sleep_threshold_ms = 20;
+    LinkTracker link(config);
+
+    // Nothing received yet: always wake.
+    assert(link.wakeupNeeded(0));
+    link.recordTransaction(0, 15, true, 10, ok());
+
+    // Back-to-back polls skip the pulse.
+    assert(!link.wakeupNeeded(115));
+    link.recordTransaction(115, 120, false, 10, ok());
+    assert(!link.wakeupNeeded(220));
+    link.recordTransaction(220, 225, false, 10, ok());
+
+    auto stats = link.stats();
+    assert(stats.wakeups_sent == 1);
+    assert(stats.wakeups_skipped == 2);
+    assert(stats.latency_saved_ms == 20);
+    assert(stats.sleep_threshold_ms == 1000);
+
+    // Idle longer than the threshold: wake.
+    assert(link.wakeupNeeded(225 + 1001));
+    assert(!link.wakeupNeeded(225 + 1000));
+
+    // A timeout on a later request of the cycle is not a sleep failure.
+    link.recordTransaction(825, 1000, false, 10, okAfterLateTimeout());
+    stats = link.stats();
+    assert(stats.skip_failures == 0);
+    assert(stats.sleep_threshold_ms == 1000);
+    assert(stats.latency_saved_ms == 30);
+
+    // Three pulse-free sleep failures in a row: threshold learned as 3/4 of
+    // the longest idle gap.
+    link.recordTransaction(1600, 1700, false, 10, okAfterTimeout());   // 600 ms idle
+    assert(link.sleepThresholdMs() == 1000);
+    link.recordTransaction(2340, 2400, false, 10, okAfterTimeout());   // 640 ms idle
+    assert(link.sleepThresholdMs() == 1000);
+    link.recordTransaction(3020, 3100, false, 10, okAfterTimeout());   // 620 ms idle
+    stats = link.stats();
+    assert(stats.skip_failures == 3);
+    assert(stats.sleep_threshold_ms == 480);
+    assert(stats.latency_saved_ms == 30);
+    assert(link.wakeupNeeded(3100 + 481));
+    assert(!link.wakeupNeeded(3100 + 480));
+
+    // A clean pulse-free wake-up breaks the streak.
+    link.recordTransaction(3500, 3550, false, 10, okAfterTimeout());
+    link.recordTransaction(3950, 4000, false, 10, okAfterTimeout());
+    link.recordTransaction(4400, 4410, false, 10, ok());
+    link.recordTransaction(4810, 4820, false, 10, okAfterTimeout());
+    assert(link.sleepThresholdMs() == 480);
+    assert(link.stats().skip_failures == 6);
+
+    // A retry after a pulse says nothing about sleep: no learning.
+    link.recordTransaction(4900, 5000, true, 10, okAfterTimeout());
+    assert(link.sleepThresholdMs() == 480);
+    assert(link.stats().skip_failures == 6);
+
+    // A failed transaction forces the next wake-up, without learning.
+    link.recordTransaction(5100, 5400, false, 10, failed());
+    assert(link.sleepThresholdMs() == 480);
+    assert(link.wakeupNeeded(5450));
+    link.recordTransaction(5450, 5460, true, 10, ok());
+    assert(!link.wakeupNeeded(5500));
+
+    // Broadcast traffic keeps the link marked awake.
+    link.noteActivity(5900);
+    assert(!link.wakeupNeeded(6300));
+
+    // A stray lowering below the poll interval recovers through probes.
+    config.failures_to_lower = 1;
+    config.probe_interval = 4;
+    LinkTracker fast(config);
+    fast.recordTransaction(0, 10, true, 10, ok());
+    fast.recordTransaction(110, 120, false, 10, okAfterTimeout());     // 100 ms idle -> 75
+    assert(fast.sleepThresholdMs() == 75);
+    uint32_t now = 120;
+    for (int i = 0; i < 3; ++i) {                                       // four pulses with the first
+        now += 100;
+        assert(fast.wakeupNeeded(now));
+        fast.recordTransaction(now, now, true, 10, ok());
+    }
+    now += 100;
+    assert(!fast.wakeupNeeded(now));                                    // probe
+    fast.recordTransaction(now, now, false, 10, ok());
+    assert(fast.sleepThresholdMs() == 100 + 900 / 16);
+    now += 100;
+    assert(!fast.wakeupNeeded(now));
+
+    // A failed probe confirms the threshold instead of lowering it.
+    for (int i = 0; i < 4; ++i) {
+        fast.recordTransaction(now, now, true, 10, ok());
+        now += 10;
+    }
+    now += 180;                                                         // 190 ms idle: 3/4 is below 156
+    assert(!fast.wakeupNeeded(now));
+    fast.recordTransaction(now, now + 10, false, 10, okAfterTimeout());
+    assert(fast.sleepThresholdMs() == 156);
+    now += 10;
+    assert(fast.wakeupNeeded(now + 300));                               // next probe is 4 wake-ups away
+
+    // The threshold never drops below the configured floor.
+    fast.noteActivity(now);
+    fast.recordTransaction(now + 10, now + 20, false, 10, okAfterTimeout());   // 10 ms idle -> floor
+    assert(fast.sleepThresholdMs() == 20);
+
+    fast.resetStats();
+    assert(fast.stats().wakeups_sent == 0);
+    assert(fast.stats().sleep_threshold_ms == 20);
+    return 0;
+}
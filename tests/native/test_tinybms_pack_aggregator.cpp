@@ -0,0 +1,242 @@
+#include <Arduino.h>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "hal/interfaces/ihal_uart.h"
+#include "uart/tinybms_crc.h"
+#include "uart/tinybms_pack_aggregator.h"
+#include "uart/tinybms_pack_poller.h"
+
+using tinybms::PackAggregator;
+using tinybms::PackPoller;
+
+namespace {
+
+/**
+ * Answers 0x07 block reads and 0x09 list reads from a register map, the way a
+ * TinyBMS on its own UART would.
+ */
+class SimulatedTinyBms : public hal::IHalUart {
+public:
+    explicit SimulatedTinyBms(std::map<uint16_t, uint16_t> registers) : registers_(std::move(registers)) {}
+
+    hal::Status initialize(const hal::UartConfig&) override { return hal::Status::Ok; }
+    void setTimeout(uint32_t timeout_ms) override { timeout_ms_ = timeout_ms; }
+    uint32_t getTimeout() const override { return timeout_ms_; }
+
+    size_t write(const uint8_t* buffer, size_t size) override {
+        requests++;
+        if (silent || size < 5 || buffer[0] != 0xAA) {
+            return size;
+        }
+        std::vector<uint16_t> addresses;
+        if (buffer[1] == 0x07 && size == 7) {
+            const uint16_t start = static_cast<uint16_t>(buffer[3] | (buffer[4] << 8));
+            for (uint8_t i = 0; i < buffer[2]; ++i) {
+                addresses.push_back(static_cast<uint16_t>(start + i));
+            }
+        } else if (buffer[1] == 0x09 && size == static_cast<size_t>(buffer[2]) + 5U) {
+            for (size_t i = 3; i + 1 < size - 2; i += 2) {
+                addresses.push_back(static_cast<uint16_t>(buffer[i] | (buffer[i + 1] << 8)));
+            }
+        } else {
+            return size;
+        }
+        std::vector<uint8_t> response{0xAA, buffer[1], static_cast<uint8_t>(addresses.size() * 2)};
+        for (uint16_t address : addresses) {
+            const auto it = registers_.find(address);
+            const uint16_t word = (it != registers_.end()) ? it->second : 0;
+            response.push_back(static_cast<uint8_t>(word & 0xFF));
+            response.push_back(static_cast<uint8_t>(word >> 8));
+        }
+        const uint16_t crc = tinybms::crc::compute(response.data(), response.size());
+        response.push_back(static_cast<uint8_t>(crc & 0xFF));
+        response.push_back(static_cast<uint8_t>(crc >> 8));
+        rx_.insert(rx_.end(), response.begin(), response.end());
+        return size;
+    }
+
+    void flush() override {}
+
+    size_t readBytes(uint8_t* buffer, size_t length) override {
+        size_t read = 0;
+        while (read < length && !rx_.empty()) {
+            buffer[read++] = rx_.front();
+            rx_.pop_front();
+        }
+        return read;
+    }
+
+    int available() override { return static_cast<int>(rx_.size()); }
+
+    int read() override {
+        if (rx_.empty()) {
+            return -1;
+        }
+        const int value = rx_.front();
+        rx_.pop_front();
+        return value;
+    }
+
+    void set(uint16_t address, uint16_t value) { registers_[address] = value; }
+
+    bool silent = false;
+    uint32_t requests = 0;
+
+private:
+    std::map<uint16_t, uint16_t> registers_;
+    std::deque<uint8_t> rx_;
+    uint32_t timeout_ms_ = 100;
+};
+
+std::map<uint16_t, uint16_t> packRegisters(uint16_t voltage_cv, int16_t current_da, uint16_t min_cell,
+                                           uint16_t max_cell, uint16_t soc_pm, uint16_t ccl_da,
+                                           uint16_t dcl_da, uint16_t capacity_cah) {
+    return {
+        {36, voltage_cv},
+        {38, static_cast<uint16_t>(current_da)},
+        {40, min_cell},
+        {41, max_cell},
+        {45, 1000},                       // SOH 100 %
+        {46, soc_pm},
+        {48, 250},
+        {50, 0x91},
+        {102, dcl_da},
+        {103, ccl_da},
+        {113, static_cast<uint16_t>((20 << 8) | 10)},
+        {306, capacity_cah},
+        {315, 3650},
+        {316, 2800},
+    };
+}
+
+bool near(float a, float b) {
+    return std::fabs(a - b) < 0.01f;
+}
+
+} // namespace
+
+int main() {
+    // Three packs, each polled over its own link, merged into one battery.
+    {
+        SimulatedTinyBms pack_a(packRegisters(5320, -100, 3301, 3330, 800, 1000, 2000, 28000));
+        SimulatedTinyBms pack_b(packRegisters(5330, -50, 3290, 3345, 600, 500, 2000, 28000));
+        SimulatedTinyBms pack_c(packRegisters(5310, -200, 3310, 3320, 900, 2000, 1500, 14000));
+        PackPoller pollers[3] = {PackPoller(pack_a), PackPoller(pack_b), PackPoller(pack_c)};
+
+        PackAggregator aggregator(3, 1000);
+        tinybms::TransactionOptions options{};
+        const tinybms::DelayConfig delay{};
+        for (size_t i = 0; i < 3; ++i) {
+            TinyBMS_LiveData live{};
+            assert(pollers[i].poll(0, 50, options, delay, live));
+            assert(pollers[i].stats().cycles == 1 && pollers[i].stats().failures == 0);
+            aggregator.update(i, live, 0);
+        }
+        assert(pack_a.requests > 0 && pack_b.requests > 0 && pack_c.requests > 0);
+
+        TinyBMS_LiveData combined{};
+        assert(aggregator.combine(10, combined) == 3);
+        assert(near(combined.voltage, 53.2f));
+        assert(near(combined.current, -35.0f));             // summed
+        assert(combined.min_cell_mv == 3290);
+        assert(combined.max_cell_mv == 3345);
+        assert(combined.cell_imbalance_mv == 55);
+        // Capacity-weighted SOC: (80 * 280 + 60 * 280 + 90 * 140) / 700
+        assert(near(combined.soc_percent, 74.0f));
+        // Weakest pack: B (50 A, 280 of 700 Ah) caps charge at 125 A,
+        // A and B (200 A, 280 of 700 Ah) cap discharge at 500 A.
+        assert(combined.max_charge_current == 1250);
+        assert(combined.max_discharge_current == 5000);
+        const TinyRegisterSnapshot* capacity = combined.findSnapshot(306);
+        assert(capacity != nullptr && capacity->raw_value == 70000);   // 700 Ah
+
+        // Only the fast class is due 100 ms later.
+        TinyBMS_LiveData live{};
+        const uint32_t before = pack_a.requests;
+        pack_a.set(36, 5340);
+        assert(pollers[0].poll(100, 50, options, delay, live));
+        assert(pack_a.requests == before + 1);
+        assert(near(live.voltage, 53.4f));
+        assert(live.findSnapshot(306) != nullptr);            // still decoded from the cache
+        assert(!pollers[0].poll(110, 0, options, delay, live));   // nothing due
+
+        // A silent pack fails its poll and drops out once stale.
+        pack_c.silent = true;
+        assert(!pollers[2].poll(1000, 50, options, delay, live));
+        assert(pollers[2].stats().failures == 1);
+        assert(pollers[2].stats().last_result.timeout_count > 0);
+        TinyBMS_LiveData pack_b_live{};
+        assert(pollers[1].poll(1000, 50, options, delay, pack_b_live));
+        aggregator.update(0, live, 1000);
+        aggregator.update(1, pack_b_live, 1000);
+        assert(aggregator.combine(1500, combined) == 2);
+        assert(near(combined.current, -15.0f));
+        assert(combined.max_charge_current == 1000);          // 2 x 50 A
+        assert(combined.findSnapshot(306)->raw_value == 56000);
+
+        const std::vector<tinybms::PackStatus> status = aggregator.status(1500);
+        assert(status.size() == 3);
+        assert(status[0].fresh && status[1].fresh && !status[2].fresh);
+        assert(status[2].age_ms == 1500 && status[2].updates == 1);
+        assert(near(status[2].capacity_ah, 140.0f));
+
+        assert(aggregator.combine(5000, combined) == 0);
+    }
+
+    // Unknown capacities weigh equally; faults and extremes propagate.
+    {
+        PackAggregator aggregator(2, 1000);
+        TinyBMS_LiveData a{};
+        a.soc_percent = 50.0f;
+        a.soc_raw = 500;
+        a.max_charge_current = 400;
+        a.temperature = 250;
+        a.pack_temp_min = 50;
+        a.pack_temp_max = 200;
+        a.online_status = 0x91;
+        a.cell_overvoltage_mv = 3650;
+        TinyBMS_LiveData b = a;
+        b.soc_percent = 70.0f;
+        b.soc_raw = 700;
+        b.max_charge_current = 300;
+        b.temperature = 310;
+        b.pack_temp_min = 20;
+        b.online_status = PackAggregator::kFaultStatus;
+        b.cell_overvoltage_mv = 3600;
+
+        TinyBMS_LiveData combined{};
+        assert(aggregator.combine(0, combined) == 0);         // nothing received yet
+        aggregator.update(0, a, 0);
+        aggregator.update(1, b, 0);
+        aggregator.update(2, b, 0);                           // beyond pack_count: ignored
+        assert(aggregator.combine(0, combined) == 2);
+        assert(near(combined.soc_percent, 60.0f));
+        assert(combined.soc_raw == 600);                      // primary's raw scale
+        assert(combined.max_charge_current == 600);           // 2 x 30 A
+        assert(combined.temperature == 310);
+        assert(combined.pack_temp_min == 20 && combined.pack_temp_max == 200);
+        assert(combined.online_status == PackAggregator::kFaultStatus);
+        assert(combined.cell_overvoltage_mv == 3600);
+
+        // The configured fallback capacity weighs a pack without register 306.
+        aggregator.setFallbackCapacityAh(0, 300.0f);
+        aggregator.setFallbackCapacityAh(1, 100.0f);
+        assert(aggregator.combine(0, combined) == 2);
+        assert(near(combined.soc_percent, 55.0f));
+        assert(combined.max_charge_current == 533);           // A: 40 A x 400 / 300
+
+        // A single configured pack passes through unchanged.
+        aggregator.configure(1, 1000);
+        assert(aggregator.packCount() == 1);
+        aggregator.update(0, b, 0);
+        assert(aggregator.combine(0, combined) == 1);
+        assert(combined.max_charge_current == 300 && near(combined.soc_percent, 70.0f));
+    }
+
+    return 0;
+}
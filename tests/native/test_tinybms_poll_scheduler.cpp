@@ -0,0 +1,94 @@
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_poll_scheduler.h"
+
+using tinybms::PollScheduler;
+using tinybms::refreshClassBit;
+
+namespace {
+
+constexpr uint8_t kFast = refreshClassBit(TinyRegisterRefreshClass::Fast);
+constexpr uint8_t kNormal = refreshClassBit(TinyRegisterRefreshClass::Normal);
+constexpr uint8_t kSlow = refreshClassBit(TinyRegisterRefreshClass::Slow);
+constexpr uint8_t kOnce = refreshClassBit(TinyRegisterRefreshClass::Once);
+
+} // namespace
+
+int main() {
+    PollScheduler scheduler;
+    tinybms::RefreshPeriods periods{};
+    periods.fast_ms = 100;
+    periods.normal_ms = 1000;
+    periods.slow_ms = 10000;
+    scheduler.setPeriods(periods);
+
+    // Everything is read on the first cycle, identification strings included.
+    uint32_t requests = 0;
+    assert(scheduler.dueMask(0, 50, requests) == tinybms::kAllRefreshClasses);
+    scheduler.markRefreshed(tinybms::kAllRefreshClasses, 0, requests);
+    assert(scheduler.dueMask(10, 50) == 0);
+
+    // Periodic classes, with tolerance for tick jitter.
+    assert(scheduler.dueMask(60, 50) == kFast);
+    assert(scheduler.dueMask(100, 0) == kFast);
+    assert(scheduler.dueMask(1000, 50) == (kFast | kNormal));
+    assert(scheduler.dueMask(10000, 50) == (kFast | kNormal | kSlow));
+
+    // "Once" is never periodic.
+    assert((scheduler.dueMask(1000000, 50) & kOnce) == 0);
+
+    // A fast-only cycle leaves the other classes due.
+    scheduler.dueMask(1000, 50, requests);
+    scheduler.markRefreshed(kFast, 1000, requests);
+    assert(scheduler.dueMask(1000, 50) == kNormal);
+
+    // On-demand refresh by address (e.g. after a configuration write).
+    scheduler.dueMask(2000, 0, requests);
+    scheduler.markRefreshed(tinybms::kAllRefreshClasses, 2000, requests);
+    scheduler.requestRefreshForAddress(316);
+    assert(scheduler.dueMask(2000, 0) == kSlow);
+    scheduler.requestRefreshForAddress(503);   // inside Manufacturer Name / Battery Family
+    assert(scheduler.dueMask(2000, 0, requests) == (kSlow | kOnce));
+    scheduler.markRefreshed(kSlow | kOnce, 2000, requests);
+
+    // A request made while the read is in flight outlives that read, even
+    // for a class the read already covers.
+    scheduler.requestRefreshForAddress(503);
+    assert(scheduler.dueMask(2000, 0, requests) == kOnce);
+    scheduler.requestRefreshForAddress(503);   // web write during the read
+    scheduler.markRefreshed(kOnce, 2000, requests);
+    assert(scheduler.dueMask(2000, 0, requests) == kOnce);
+    scheduler.markRefreshed(kOnce, 2000, requests);
+    assert(scheduler.dueMask(2000, 0) == 0);
+    scheduler.requestRefreshForAddress(9999);  // unmapped
+    assert(scheduler.dueMask(2000, 0) == 0);
+    scheduler.requestFullRefresh();
+    assert(scheduler.dueMask(2000, 0) == tinybms::kAllRefreshClasses);
+
+    // Fast plan only carries the fast registers and is much cheaper than the full cycle.
+    tinybms::ReadPlanCostModel model{};
+    const tinybms::ReadPlan& fast_plan = scheduler.planFor(kFast, model);
+    const std::vector<uint16_t> expected_fast{36, 38, 40, 41, 46, 51};
+    assert(fast_plan.addresses == expected_fast);
+    const uint32_t fast_bytes = fast_plan.wire_bytes;
+    const tinybms::ReadPlan& full_plan = scheduler.planFor(tinybms::kAllRefreshClasses, model);
+    assert(full_plan.addresses.size() > fast_plan.addresses.size());
+    assert(fast_bytes * 3 < full_plan.wire_bytes);
+    assert(scheduler.maxOperationWords() >= full_plan.max_operation_words);
+
+    // Plans are cached per mask and rebuilt after a mapping reload.
+    assert(&scheduler.planFor(kFast, model) == &fast_plan);
+    const uint32_t version_before = fast_plan.mapping_version;
+    const char* json = R"JSON({
+        "tiny_read_registers": {
+            "36": { "tiny_name": "Battery Pack Voltage", "tiny_type": "FLOAT" }
+        }
+    })JSON";
+    assert(loadTinyReadMappingFromJson(json, nullptr));
+    assert(scheduler.planFor(kFast, model).mapping_version != version_before);
+
+    return 0;
+}
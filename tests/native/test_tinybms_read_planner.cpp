@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_read_planner.h"
+
+using tinybms::ReadOperationKind;
+using tinybms::ReadPlan;
+using tinybms::ReadPlanCostModel;
+
+namespace {
+
+// Every required address is returned by exactly one operation, blocks respect
+// the register limit and the bookkeeping matches the operations.
+void assertCovers(const ReadPlan& plan, const std::vector<uint16_t>& required, uint8_t max_registers) {
+    std::vector<uint16_t> covered;
+    uint32_t wire_bytes = 0;
+    for (const auto& op : plan.operations) {
+        assert(op.register_count > 0 && op.register_count <= max_registers);
+        wire_bytes += tinybms::operationWireBytes(op);
+        if (op.kind == ReadOperationKind::Block) {
+            assert(op.addresses.empty());
+            for (uint16_t i = 0; i < op.register_count; ++i) {
+                const uint16_t address = static_cast<uint16_t>(op.start_address + i);
+                if (std::binary_search(required.begin(), required.end(), address)) {
+                    covered.push_back(address);
+                }
+            }
+        } else {
+            assert(op.addresses.size() == op.register_count);
+            covered.insert(covered.end(), op.addresses.begin(), op.addresses.end());
+        }
+    }
+    std::sort(covered.begin(), covered.end());
+    assert(covered == required);
+    assert(wire_bytes == plan.wire_bytes);
+}
+
+uint64_t planCostNs(const ReadPlan& plan, const ReadPlanCostModel& model) {
+    const uint64_t byte_ns = (static_cast<uint64_t>(model.bits_per_byte) * 1000000000ULL) / model.baud_rate;
+    return plan.wire_bytes * byte_ns + plan.operations.size() * model.transaction_overhead_us * 1000ULL;
+}
+
+// Exhaustive search: each address is either appended to the shared list or
+// starts a block that ends on a later required address. The list is split
+// every max_registers entries.
+void bruteForce(const std::vector<uint16_t>& a, size_t i, uint32_t bytes, uint32_t ops, size_t listed,
+                const ReadPlanCostModel& model, uint64_t& best) {
+    const uint64_t byte_ns = (static_cast<uint64_t>(model.bits_per_byte) * 1000000000ULL) / model.baud_rate;
+    if (i == a.size()) {
+        uint32_t total_bytes = bytes;
+        uint32_t total_ops = ops;
+        if (listed > 0) {
+            const uint32_t lists = static_cast<uint32_t>((listed + model.max_registers_per_read - 1) /
+                                                         model.max_registers_per_read);
+            total_bytes += 10 * lists + 4 * static_cast<uint32_t>(listed);
+            total_ops += lists;
+        }
+        best = std::min<uint64_t>(best, total_bytes * byte_ns + total_ops * model.transaction_overhead_us * 1000ULL);
+        return;
+    }
+    bruteForce(a, i + 1, bytes, ops, listed + 1, model, best);
+    for (size_t j = i; j < a.size() && a[j] - a[i] + 1U <= model.max_registers_per_read; ++j) {
+        const uint32_t span = static_cast<uint32_t>(a[j] - a[i]) + 1U;
+        bruteForce(a, j + 1, bytes + 12 + 2 * span, ops + 1, listed, model, best);
+    }
+}
+
+} // namespace
+
+int main() {
+    // Poll set derived from the built-in bindings: multi-word registers are
+    // expanded, unmapped addresses of the legacy list (e.g. 0x0072) disappear.
+    const std::vector<uint16_t> mapped = tinybms::collectPollAddresses(getTinyRegisterBindings());
+    assert(std::is_sorted(mapped.begin(), mapped.end()));
+    assert(std::adjacent_find(mapped.begin(), mapped.end()) == mapped.end());
+    assert(std::binary_search(mapped.begin(), mapped.end(), 33));     // Lifetime Counter high word
+    assert(std::binary_search(mapped.begin(), mapped.end(), 505));    // Battery Family last word
+    assert(!std::binary_search(mapped.begin(), mapped.end(), 34));
+    assert(!std::binary_search(mapped.begin(), mapped.end(), 114));
+    assert(mapped.size() == 31);
+
+    // Expensive transactions (wake-up pulse on every exchange): one list read.
+    {
+        ReadPlanCostModel model{};
+        model.transaction_overhead_us = 50000;
+        ReadPlan plan = tinybms::buildReadPlan(mapped, model);
+        assertCovers(plan, mapped, model.max_registers_per_read);
+        assert(plan.operations.size() == 1);
+        assert(plan.operations[0].kind == ReadOperationKind::List);
+        assert(plan.wire_bytes == 10 + 4 * mapped.size());
+    }
+
+    // Cheap transactions: the dense 32..52 run becomes a block read and the plan
+    // moves fewer bytes than the legacy single list read.
+    {
+        ReadPlanCostModel model{};
+        model.transaction_overhead_us = 0;
+        ReadPlan plan = tinybms::buildReadPlan(mapped, model);
+        ReadPlan legacy = tinybms::buildSingleListPlan(mapped, model);
+        assertCovers(plan, mapped, model.max_registers_per_read);
+        assert(plan.wire_bytes < legacy.wire_bytes);
+        assert(plan.estimated_cycle_us <= legacy.estimated_cycle_us);
+        bool has_block = false;
+        for (const auto& op : plan.operations) {
+            has_block = has_block || op.kind == ReadOperationKind::Block;
+        }
+        assert(has_block);
+    }
+
+    // Optimality against exhaustive search on small address sets.
+    {
+        const std::vector<std::vector<uint16_t>> cases = {
+            {10},
+            {10, 11, 12, 13},
+            {10, 12, 14, 16, 18},
+            {1, 2, 3, 40, 41, 42, 43, 300},
+            {5, 6, 20, 21, 22, 23, 24, 25},
+            {0, 200, 201},
+            // More addresses than max_registers: the extra list reads are paid for.
+            {0, 10, 20, 30, 40, 50, 60, 70, 80, 90},
+            {0, 3, 6, 9, 12, 15, 18, 21, 24, 27},
+            {0, 2, 4, 6, 8, 100, 102, 104, 106, 108, 300},
+        };
+        const uint32_t overheads[] = {0, 300, 2000, 12000};
+        for (const auto& addresses : cases) {
+            for (uint32_t overhead : overheads) {
+                ReadPlanCostModel model{};
+                model.transaction_overhead_us = overhead;
+                model.max_registers_per_read = 8;
+                ReadPlan plan = tinybms::buildReadPlan(addresses, model);
+                assertCovers(plan, addresses, model.max_registers_per_read);
+
+                uint64_t best = std::numeric_limits<uint64_t>::max();
+                bruteForce(addresses, 0, 0, 0, 0, model, best);
+                assert(planCostNs(plan, model) == best);
+            }
+        }
+    }
+
+    // Lists larger than the register limit are split into several reads.
+    {
+        std::vector<uint16_t> sparse;
+        for (uint16_t i = 0; i < 10; ++i) {
+            sparse.push_back(static_cast<uint16_t>(i * 100));
+        }
+        ReadPlanCostModel model{};
+        model.max_registers_per_read = 4;
+        ReadPlan plan = tinybms::buildReadPlan(sparse, model);
+        assertCovers(plan, sparse, 4);
+        assert(plan.operations.size() == 3);
+        assert(plan.max_operation_words == 4);
+    }
+
+    // A list whose split pays an extra transaction loses to a block.
+    {
+        ReadPlanCostModel model{};
+        model.max_registers_per_read = 4;
+        model.transaction_overhead_us = 2000;
+        const std::vector<uint16_t> addresses = {0, 1, 100, 200, 300};   // 5 > 4 list slots
+        ReadPlan plan = tinybms::buildReadPlan(addresses, model);
+        assertCovers(plan, addresses, 4);
+        assert(plan.operations.size() == 2);
+        assert(plan.operations[0].kind == ReadOperationKind::Block && plan.operations[0].start_address == 0);
+        assert(plan.operations[1].kind == ReadOperationKind::List && plan.operations[1].register_count == 3);
+    }
+
+    // The legacy baseline reads each address once, in order.
+    {
+        ReadPlanCostModel model{};
+        ReadPlan legacy = tinybms::buildSingleListPlan({40, 36, 38, 36, 40}, model);
+        assert(legacy.operations.size() == 1);
+        assert((legacy.operations[0].addresses == std::vector<uint16_t>{36, 38, 40}));
+        assert(legacy.wire_bytes == 10 + 4 * 3);
+    }
+
+    // Empty mapping -> empty plan.
+    {
+        ReadPlan plan = tinybms::buildReadPlan({});
+        assert(plan.empty());
+        assert(plan.wire_bytes == 0);
+    }
+
+    // Reloading the mapping bumps the version so cached plans are rebuilt.
+    {
+        ReadPlan before = tinybms::buildReadPlanFromMapping();
+        const char* json = R"JSON({
+            "tiny_read_registers": {
+                "36": { "tiny_name": "Battery Pack Voltage", "tiny_type": "FLOAT" }
+            }
+        })JSON";
+        assert(loadTinyReadMappingFromJson(json, nullptr));
+        assert(getTinyReadMappingVersion() != before.mapping_version);
+        ReadPlan after = tinybms::buildReadPlanFromMapping();
+        assert(after.mapping_version == getTinyReadMappingVersion());
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <Arduino.h>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_decoder.h"
+#include "uart/tinybms_read_planner.h"
+#include "uart/tinybms_register_store.h"
+
+using tinybms::RegisterStore;
+
+int main() {
+    // Layout over the default mapping: a few dense windows, nothing valid yet.
+    {
+        const auto& bindings = getTinyRegisterBindings();
+        const std::vector<uint16_t> addresses = tinybms::collectPollAddresses(bindings);
+        RegisterStore store;
+        assert(store.ensureLayout(bindings, 1));
+        assert(!store.ensureLayout(bindings, 1));
+        assert(store.mappingVersion() == 1);
+        assert(store.windowCount() >= 1 && store.windowCount() < addresses.size());
+        assert(store.slotCount() >= addresses.size());
+        assert(store.validCount() == 0);
+        for (uint16_t address : addresses) {
+            assert(store.covers(address));
+        }
+        assert(!store.covers(0));
+        assert(!store.covers(0xFFFF));
+    }
+
+    // Windows, gaps, block fills across window edges.
+    {
+        RegisterStore store;
+        store.configure({10, 11, 14, 40, 41, 42, 100}, 4);
+        assert(store.windowCount() == 3);           // 10..14, 40..42, 100
+        assert(store.slotCount() == 5 + 3 + 1);
+        assert(store.covers(12));                   // gap slot inside a window
+        assert(!store.covers(9) && !store.covers(15) && !store.covers(43) && !store.covers(101));
+
+        uint16_t value = 0;
+        assert(!store.get(12, value));              // covered but never filled
+        assert(store.set(11, 7));
+        assert(store.get(11, value) && value == 7);
+        assert(!store.set(20, 1));
+
+        const uint16_t block[] = {1, 2, 3, 4, 5, 6, 7, 8};
+        assert(store.setRange(38, block, 8) == 3);  // 40..42 only
+        assert(store.get(40, value) && value == 3);
+        assert(store.get(42, value) && value == 5);
+        assert(store.setRange(8, block, 8) == 5);   // 10..14 (8 and 9 dropped)
+        assert(store.get(10, value) && value == 3);
+        assert(store.get(14, value) && value == 7);
+        assert(store.setRange(0, nullptr, 4) == 0);
+        assert(store.validCount() == 8);
+
+        // A new layout keeps what it still covers.
+        store.configure({10, 11, 100, 101});
+        assert(store.get(11, value) && value == 4);
+        assert(!store.get(14, value));
+        assert(!store.get(40, value));
+
+        store.invalidate();
+        assert(store.validCount() == 0);
+        assert(store.covers(11) && !store.get(11, value));
+    }
+
+    // The decoder gives the same snapshot from the store as from a map.
+    {
+        const std::map<uint16_t, uint16_t> registers{
+            {32, 0xABCD}, {33, 0x0001}, {36, 5200},
+            {38, static_cast<uint16_t>(static_cast<int16_t>(-85))},
+            {40, 3100}, {41, 3275}, {45, 940}, {46, 815}, {48, 250},
+            {102, 450}, {103, 320}, {113, static_cast<uint16_t>((15 << 8) | 4)},
+            {315, 3400}, {316, 2800},
+            {500, static_cast<uint16_t>(('T' << 8) | 'i')},
+            {501, static_cast<uint16_t>(('n' << 8) | 'y')},
+        };
+        const auto& bindings = getTinyRegisterBindings();
+        RegisterStore store;
+        store.ensureLayout(bindings, getTinyReadMappingVersion());
+        for (const auto& entry : registers) {
+            assert(store.set(entry.first, entry.second));
+        }
+
+        TinyBMS_LiveData from_map{};
+        TinyBMS_LiveData from_store{};
+        from_map.resetSnapshots();
+        from_store.resetSnapshots();
+        for (const auto& binding : bindings) {
+            const bool a = tinybms::uart::detail::decodeAndApplyBinding(binding, registers, from_map, 5, nullptr);
+            const bool b = tinybms::uart::detail::decodeAndApplyBinding(binding, store, from_store, 5, nullptr);
+            assert(a == b);
+        }
+        assert(from_store.snapshotCount() == from_map.snapshotCount());
+        assert(from_store.snapshotCount() > 0);
+        assert(std::fabs(from_store.voltage - 52.0f) < 1e-6f);
+        assert(std::fabs(from_store.current + 8.5f) < 1e-6f);
+        assert(from_store.max_cell_mv == 3275);
+        assert(from_store.pack_temp_max == 150);
+        const TinyRegisterSnapshot* lifetime = from_store.findSnapshot(32);
+        assert(lifetime != nullptr && lifetime->raw_value == 0x0001ABCD);
+    }
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+#include <Arduino.h>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "event/event_types_v2.h"
+#include "tiny_read_mapping.h"
+#include "uart/tinybms_decode_plan.h"
+#include "uart/tinybms_read_planner.h"
+#include "uart/tinybms_register_store.h"
+#include "uart/tinybms_report_filter.h"
+
+using tinybms::DecodePlan;
+using tinybms::RegisterStore;
+using tinybms::ReportFilter;
+using tinybms::ReportPolicy;
+using tinybms::events::MqttRegisterEvent;
+
+namespace {
+
+ReportPolicy policy(float deadband, bool percent = false, uint32_t heartbeat_ms = 0) {
+    ReportPolicy result;
+    result.deadband = deadband;
+    result.percent = percent;
+    result.heartbeat_ms = heartbeat_ms;
+    return result;
+}
+
+// Admit and, like the decode plan once the event is accepted, commit.
+bool admitWord(ReportFilter& filter, size_t step, const ReportPolicy& p, uint16_t word, float scale, uint32_t now) {
+    const float scaled = static_cast<float>(word) * scale;
+    if (!filter.admit(step, p, scaled, &word, 1, now)) {
+        return false;
+    }
+    filter.commit(step, scaled, &word, 1, now);
+    return true;
+}
+
+size_t countEvents(const std::vector<MqttRegisterEvent>& events, uint16_t address) {
+    size_t count = 0;
+    for (const auto& event : events) {
+        if (event.address == address) {
+            count++;
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+int main() {
+    // Exact change (deadband 0): first value, then only word changes.
+    {
+        ReportFilter filter;
+        filter.bind(1, 1);
+        const ReportPolicy exact = policy(0.0f);
+        assert(admitWord(filter, 0, exact, 100, 1.0f, 0));
+        assert(!admitWord(filter, 0, exact, 100, 1.0f, 10));
+        assert(admitWord(filter, 0, exact, 101, 1.0f, 20));
+        assert(filter.stats().reported == 2 && filter.stats().suppressed == 1);
+    }
+
+    // Absolute deadband measured from the last reported value: slow drift is published.
+    {
+        ReportFilter filter;
+        filter.bind(1, 1);
+        const ReportPolicy band = policy(0.05f);   // 0.05 V on a 0.01 V register
+        assert(admitWord(filter, 0, band, 5200, 0.01f, 0));
+        assert(!admitWord(filter, 0, band, 5203, 0.01f, 1));
+        assert(!admitWord(filter, 0, band, 5205, 0.01f, 2));
+        assert(admitWord(filter, 0, band, 5207, 0.01f, 3));    // +0.07 V since 52.00 V
+        assert(!admitWord(filter, 0, band, 5203, 0.01f, 4));   // -0.04 V since 52.07 V
+        assert(admitWord(filter, 0, band, 5190, 0.01f, 5));
+    }
+
+    // Percent deadband of the last reported value.
+    {
+        ReportFilter filter;
+        filter.bind(1, 1);
+        const ReportPolicy percent = policy(2.0f, true);
+        assert(admitWord(filter, 0, percent, 1000, 1.0f, 0));
+        assert(!admitWord(filter, 0, percent, 1015, 1.0f, 1));
+        assert(admitWord(filter, 0, percent, 1025, 1.0f, 2));
+        assert(!admitWord(filter, 0, percent, 1005, 1.0f, 3));   // 2 % of 1025 = 20.5
+        assert(admitWord(filter, 0, percent, 1000, 1.0f, 4));
+    }
+
+    // Heartbeat republishes an unchanged value; deadband < 0 reports every refresh.
+    {
+        ReportFilter filter;
+        filter.bind(1, 2);
+        const ReportPolicy heartbeat = policy(0.0f, false, 1000);
+        assert(admitWord(filter, 0, heartbeat, 7, 1.0f, 0xFFFFFF00u));
+        assert(!admitWord(filter, 0, heartbeat, 7, 1.0f, 0xFFFFFFF0u));
+        assert(admitWord(filter, 0, heartbeat, 7, 1.0f, 0x000002F0u));   // millis() wrapped
+        assert(!admitWord(filter, 0, heartbeat, 7, 1.0f, 0x00000300u));
+
+        const ReportPolicy always = policy(-1.0f);
+        assert(admitWord(filter, 1, always, 7, 1.0f, 0));
+        assert(admitWord(filter, 1, always, 7, 1.0f, 0));
+    }
+
+    // forceNext() and a new plan generation report everything again.
+    {
+        ReportFilter filter;
+        filter.bind(1, 1);
+        const ReportPolicy exact = policy(0.0f);
+        assert(admitWord(filter, 0, exact, 5, 1.0f, 0));
+        assert(!admitWord(filter, 0, exact, 5, 1.0f, 1));
+        filter.forceNext();
+        assert(admitWord(filter, 0, exact, 5, 1.0f, 2));
+        filter.bind(1, 1);
+        assert(!admitWord(filter, 0, exact, 5, 1.0f, 3));
+        filter.bind(2, 1);
+        assert(admitWord(filter, 0, exact, 5, 1.0f, 4));
+        assert(admitWord(filter, 3, exact, 5, 1.0f, 5));   // out of range: never filtered
+    }
+
+    // Nothing is remembered until commit(); forceNext(step) only resets one step.
+    {
+        ReportFilter filter;
+        filter.bind(1, 2);
+        const ReportPolicy exact = policy(0.0f);
+        uint16_t word = 9;
+        assert(filter.admit(0, exact, 9.0f, &word, 1, 0));
+        assert(filter.admit(0, exact, 9.0f, &word, 1, 1));        // event never accepted
+        assert(filter.stats().reported == 0);
+        assert(admitWord(filter, 0, exact, 9, 1.0f, 2));
+        assert(admitWord(filter, 1, exact, 9, 1.0f, 2));
+        filter.forceNext(1);
+        assert(!admitWord(filter, 0, exact, 9, 1.0f, 3));
+        assert(admitWord(filter, 1, exact, 9, 1.0f, 3));
+        assert(filter.stats().reported == 3 && filter.stats().suppressed == 1);
+    }
+
+    // Decode plan: policies from the mapping metadata, unchanged registers are not re-emitted.
+    {
+        const char* mapping_json = R"JSON({
+            "tiny_read_registers": {
+                "36": { "tiny_name": "Battery Pack Voltage", "tiny_type": "FLOAT", "report_deadband": 0.05 },
+                "38": { "tiny_name": "Battery Pack Current", "tiny_type": "FLOAT", "report_deadband": "-1" },
+                "40": { "tiny_name": "Min Cell Voltage", "tiny_type": "UINT16" }
+            }
+        })JSON";
+        assert(loadTinyReadMappingFromJson(mapping_json, nullptr));
+        const auto& bindings = getTinyRegisterBindings();
+
+        const TinyRegisterRuntimeBinding* voltage = findTinyRegisterBinding(36);
+        assert(voltage != nullptr);
+        const ReportPolicy voltage_policy = tinybms::reportPolicyFor(*voltage);
+        assert(voltage_policy.deadband == 0.05f && !voltage_policy.percent);
+        assert(voltage_policy.heartbeat_ms == tinybms::kDefaultReportHeartbeatMs);
+        const TinyRegisterRuntimeBinding* lifetime = findTinyRegisterBinding(32);
+        assert(lifetime != nullptr && lifetime->metadata == nullptr);
+        assert(tinybms::reportPolicyFor(*lifetime).deadband == 0.0f);
+
+        RegisterStore store;
+        store.ensureLayout(bindings, getTinyReadMappingVersion());
+        store.set(36, 5200);
+        store.set(38, 25);
+        store.set(40, 3300);
+        DecodePlan plan;
+        plan.ensureCompiled(bindings, store);
+        ReportFilter filter;
+
+        std::vector<MqttRegisterEvent> events;
+        TinyBMS_LiveData live{};
+        live.resetSnapshots();
+        plan.apply(store, live, 0, tinybms::kAllRefreshClasses, &events, &filter);
+        assert(events.size() == 3);
+
+        store.set(36, 5202);   // within 0.05 V
+        events.clear();
+        live.resetSnapshots();
+        assert(plan.apply(store, live, 100, tinybms::kAllRefreshClasses, &events, &filter) == 3);
+        assert(live.voltage > 52.01f);                        // LiveData is never filtered
+        assert(live.snapshotCount() == 3);
+        assert(events.size() == 1 && countEvents(events, 38) == 1);
+
+        store.set(40, 3301);
+        events.clear();
+        plan.apply(store, live, 200, tinybms::kAllRefreshClasses, &events, &filter);
+        assert(events.size() == 2 && countEvents(events, 40) == 1);
+
+        events.clear();
+        plan.apply(store, live, tinybms::kDefaultReportHeartbeatMs, tinybms::kAllRefreshClasses, &events, &filter);
+        assert(countEvents(events, 36) == 1 && countEvents(events, 40) == 0);
+        assert(filter.stats().reported == 8 && filter.stats().suppressed == 4);
+
+        // A recompiled plan starts over.
+        store.configure({36, 38, 40});
+        plan.ensureCompiled(bindings, store);
+        events.clear();
+        plan.apply(store, live, tinybms::kDefaultReportHeartbeatMs + 1, tinybms::kAllRefreshClasses, &events, &filter);
+        assert(events.size() == 3);
+
+        // Values that overflowed the cycle batch are not remembered as reported.
+        const uint32_t now = tinybms::kDefaultReportHeartbeatMs + 2;
+        store.set(36, 5300);
+        store.set(40, 3400);
+        tinybms::events::RegisterCycleBatch batch;
+        batch.count = static_cast<uint16_t>(tinybms::events::kRegisterCycleCapacity - 1);
+        plan.apply(store, live, now, tinybms::kAllRefreshClasses, &batch, &filter);
+        assert(batch.dropped == 2);
+        const uint16_t accepted = batch.values[tinybms::events::kRegisterCycleCapacity - 1].address;
+        batch.clear();
+        plan.apply(store, live, now + 1, tinybms::kAllRefreshClasses, &batch, &filter);
+        for (uint16_t address : {36, 40}) {
+            size_t count = 0;
+            for (const auto& entry : batch) {
+                count += entry.address == address ? 1U : 0U;
+            }
+            assert(count == (address == accepted ? 0U : 1U));
+        }
+    }
+
+    return 0;
+}
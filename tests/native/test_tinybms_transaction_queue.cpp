@@ -0,0 +1,181 @@
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <Arduino.h>
+#include "uart/tinybms_transaction_queue.h"
+
+using tinybms::TransactionJob;
+using tinybms::TransactionOutcome;
+using tinybms::TransactionPriority;
+using tinybms::TransactionQueue;
+using tinybms::TransactionResult;
+using tinybms::TransactionTicket;
+
+namespace {
+
+TransactionJob makeJob(TransactionPriority priority, std::vector<int>& order, int tag, uint32_t deadline_ms = 0) {
+    TransactionJob job{};
+    job.priority = priority;
+    job.deadline_ms = deadline_ms;
+    job.run = [&order, tag]() {
+        order.push_back(tag);
+        TransactionResult result{};
+        result.success = true;
+        result.last_status = tinybms::AttemptStatus::Success;
+        return result;
+    };
+    return job;
+}
+
+void testPriorityOrdering() {
+    arduino_stub::resetMillis(0);
+    TransactionQueue queue;
+    std::vector<int> order;
+
+    queue.submit(makeJob(TransactionPriority::ConfigRead, order, 1));
+    queue.submit(makeJob(TransactionPriority::ConfigRead, order, 2));
+    queue.submit(makeJob(TransactionPriority::ConfigWrite, order, 3));
+    queue.submit(makeJob(TransactionPriority::LivePoll, order, 4));
+    queue.submit(makeJob(TransactionPriority::Alarm, order, 5));
+    assert(queue.depth(TransactionPriority::ConfigRead) == 2);
+
+    while (queue.runNext(0)) {
+    }
+    // Highest priority first, FIFO within a priority.
+    const std::vector<int> expected{4, 5, 3, 1, 2};
+    assert(order == expected);
+    assert(queue.stats(TransactionPriority::ConfigRead).completed == 2);
+    assert(queue.stats(TransactionPriority::ConfigRead).depth == 0);
+    assert(queue.stats(TransactionPriority::ConfigRead).depth_max == 2);
+    assert(!queue.runNext(0));
+}
+
+void testDeadlineExpiry() {
+    arduino_stub::resetMillis(1000);
+    TransactionQueue queue;
+    std::vector<int> order;
+    TransactionOutcome callback_outcome = TransactionOutcome::Pending;
+
+    TransactionJob stale = makeJob(TransactionPriority::LivePoll, order, 1, 1050);
+    stale.on_complete = [&callback_outcome](TransactionOutcome outcome, const TransactionResult&) {
+        callback_outcome = outcome;
+    };
+    TransactionTicket stale_ticket = queue.submit(std::move(stale));
+    TransactionTicket fresh_ticket = queue.submit(makeJob(TransactionPriority::LivePoll, order, 2, 1500));
+
+    arduino_stub::advanceMillis(100);
+    assert(queue.runNext(0));
+    assert(queue.runNext(0));
+
+    assert(order == std::vector<int>{2});
+    assert(stale_ticket.outcome() == TransactionOutcome::Expired);
+    assert(callback_outcome == TransactionOutcome::Expired);
+    assert(fresh_ticket.outcome() == TransactionOutcome::Completed);
+    assert(fresh_ticket.result().success);
+
+    const auto stats = queue.stats(TransactionPriority::LivePoll);
+    assert(stats.expired == 1);
+    assert(stats.completed == 1);
+    assert(stats.wait_ms_last == 100);
+    assert(stats.wait_ms_max == 100);
+}
+
+void testCancellationAndRejection() {
+    arduino_stub::resetMillis(0);
+    TransactionQueue queue(2);
+    std::vector<int> order;
+
+    TransactionTicket first = queue.submit(makeJob(TransactionPriority::ConfigRead, order, 1));
+    TransactionTicket second = queue.submit(makeJob(TransactionPriority::ConfigRead, order, 2));
+    TransactionTicket overflow = queue.submit(makeJob(TransactionPriority::ConfigRead, order, 3));
+    assert(overflow.outcome() == TransactionOutcome::Rejected);
+    assert(overflow.wait(0));
+
+    // Other priorities have their own budget.
+    TransactionTicket write = queue.submit(makeJob(TransactionPriority::ConfigWrite, order, 4));
+    assert(write.outcome() == TransactionOutcome::Pending);
+
+    assert(first.cancel());
+    assert(first.outcome() == TransactionOutcome::Cancelled);
+    assert(!first.cancel());
+
+    while (queue.runNext(0)) {
+    }
+    assert((order == std::vector<int>{4, 2}));
+    assert(!second.cancel());   // already finished
+
+    const auto stats = queue.stats(TransactionPriority::ConfigRead);
+    assert(stats.submitted == 3);
+    assert(stats.rejected == 1);
+    assert(stats.cancelled == 1);
+    assert(stats.completed == 1);
+
+    queue.resetStats();
+    assert(queue.stats(TransactionPriority::ConfigRead).submitted == 0);
+}
+
+void testFailedJobCounted() {
+    TransactionQueue queue;
+    TransactionJob job{};
+    job.priority = TransactionPriority::Alarm;
+    job.run = []() { return TransactionResult{}; };
+    TransactionTicket ticket = queue.submit(std::move(job));
+    assert(queue.runNext(0));
+    assert(ticket.outcome() == TransactionOutcome::Completed);
+    assert(!ticket.result().success);
+    assert(queue.stats(TransactionPriority::Alarm).failed == 1);
+}
+
+void testWorkerThread() {
+    arduino_stub::resetMillis(0);
+    TransactionQueue queue;
+    std::atomic<bool> stop{false};
+    std::thread worker([&queue, &stop]() {
+        while (!stop.load()) {
+            queue.runNext(5);
+        }
+    });
+
+    std::atomic<int> callbacks{0};
+    std::vector<TransactionTicket> tickets;
+    for (int i = 0; i < 6; ++i) {
+        TransactionJob job{};
+        job.priority = (i % 2 == 0) ? TransactionPriority::LivePoll : TransactionPriority::ConfigRead;
+        job.run = [i]() {
+            TransactionResult result{};
+            result.success = (i != 3);
+            return result;
+        };
+        job.on_complete = [&callbacks](TransactionOutcome outcome, const TransactionResult&) {
+            assert(outcome == TransactionOutcome::Completed);
+            callbacks.fetch_add(1);
+        };
+        tickets.push_back(queue.submit(std::move(job)));
+    }
+
+    for (size_t i = 0; i < tickets.size(); ++i) {
+        assert(tickets[i].wait(2000));
+        assert(tickets[i].result().success == (i != 3));
+    }
+    stop.store(true);
+    worker.join();
+
+    assert(callbacks.load() == 6);
+    assert(queue.stats(TransactionPriority::LivePoll).completed == 3);
+    assert(queue.stats(TransactionPriority::ConfigRead).failed == 1);
+}
+
+} // namespace
+
+int main() {
+    assert(std::string(tinybms::transactionPriorityName(TransactionPriority::LivePoll)) == "live_poll");
+    testPriorityOrdering();
+    testDeadlineExpiry();
+    testCancellationAndRejection();
+    testFailedJobCounted();
+    testWorkerThread();
+    return 0;
+}
@@ -0,0 +1,215 @@
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "hal/interfaces/ihal_storage.h"
+#include "hal/replay_uart.h"
+#include "uart/tinybms_crc.h"
+#include "uart/tinybms_uart_client.h"
+#include "uart/tinybms_uart_trace.h"
+
+namespace hal {
+std::unique_ptr<IHalStorage> createMockStorage();
+}
+
+using tinybms::UartTraceDirection;
+using tinybms::UartTraceEvent;
+
+namespace {
+
+std::vector<uint8_t> withCrc(std::vector<uint8_t> frame) {
+    const uint16_t crc = tinybms::crc::compute(frame.data(), frame.size());
+    frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+    frame.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF));
+    return frame;
+}
+
+std::vector<uint8_t> blockRequest(uint16_t start, uint8_t count) {
+    return withCrc({0xAA, 0x07, count, static_cast<uint8_t>(start & 0xFF), static_cast<uint8_t>(start >> 8)});
+}
+
+std::vector<uint8_t> blockResponse(const std::vector<uint16_t>& values) {
+    std::vector<uint8_t> frame{0xAA, 0x07, static_cast<uint8_t>(values.size() * 2U)};
+    for (uint16_t v : values) {
+        frame.push_back(static_cast<uint8_t>(v & 0xFF));
+        frame.push_back(static_cast<uint8_t>(v >> 8));
+    }
+    return withCrc(frame);
+}
+
+UartTraceEvent event(uint32_t t, UartTraceDirection direction, std::vector<uint8_t> bytes) {
+    UartTraceEvent e;
+    e.timestamp_ms = t;
+    e.direction = direction;
+    e.bytes = std::move(bytes);
+    return e;
+}
+
+void advanceReplay(uint32_t delay_ms, void* context) {
+    static_cast<hal::ReplayUart*>(context)->advance(delay_ms);
+}
+
+tinybms::TransactionResult replayBlockRead(hal::ReplayUart& uart,
+                                           uint16_t* output,
+                                           uint8_t attempts) {
+    tinybms::TransactionOptions options{};
+    options.attempt_count = attempts;
+    options.response_timeout_ms = 100;
+    tinybms::DelayConfig delay{advanceReplay, &uart};
+    return tinybms::readRegisterBlock(uart, 36, 2, output, options, delay);
+}
+
+} // namespace
+
+int main() {
+    const std::vector<uint8_t> request = blockRequest(36, 2);
+    const std::vector<uint8_t> response = blockResponse({5312, 0xFF85});
+
+    // Recorder: chunks in the same millisecond and direction are merged.
+    {
+        auto storage = hal::createMockStorage();
+        assert(storage->mount(hal::StorageConfig{}) == hal::Status::Ok);
+
+        tinybms::UartTraceRecorder recorder(64);
+        recorder.record(UartTraceDirection::Tx, 990, request.data(), request.size());   // not recording yet
+        assert(recorder.start(*storage, "/traces/trace.bin", 1000));
+        assert(recorder.active());
+        recorder.record(UartTraceDirection::Tx, 1000, request.data(), request.size());
+        recorder.record(UartTraceDirection::Rx, 1018, response.data(), 4);
+        recorder.record(UartTraceDirection::Rx, 1018, response.data() + 4, response.size() - 4);
+        recorder.record(UartTraceDirection::Rx, 1250, response.data(), 1);
+        recorder.stop();
+        assert(!recorder.active());
+
+        const tinybms::UartTraceRecorderStats stats = recorder.stats();
+        assert(stats.events == 3);
+        assert(stats.tx_bytes == request.size());
+        assert(stats.rx_bytes == response.size() + 1);
+        assert(stats.write_errors == 0 && !stats.truncated);
+
+        std::vector<UartTraceEvent> events;
+        assert(tinybms::loadUartTrace(*storage, "/traces/trace.bin", events));
+        assert(events.size() == 3);
+        assert(events[0].timestamp_ms == 0 && events[0].direction == UartTraceDirection::Tx);
+        assert(events[0].bytes == request);
+        assert(events[1].timestamp_ms == 18 && events[1].bytes == response);
+        assert(events[2].timestamp_ms == 250 && events[2].bytes.size() == 1);
+        // 5 bytes of header, 3 bytes of framing per record (delta 250 needs 2).
+        assert(stats.trace_bytes == 5 + 3 * 3 + 1 + request.size() + response.size() + 1);
+
+        // record() never writes: the owner flushes between transactions,
+        // and chunks beyond the RAM buffer are dropped.
+        tinybms::UartTraceRecorder buffered(8, 4096, 64);
+        assert(buffered.start(*storage, "/traces/buffered.bin", 0));
+        uint32_t kept = 0;
+        for (uint32_t t = 0; buffered.stats().dropped_bytes == 0; ++t) {
+            buffered.record(UartTraceDirection::Rx, t, response.data(), response.size());
+            kept = buffered.stats().rx_bytes;
+        }
+        assert(buffered.stats().trace_bytes == 0 && buffered.stats().dropped_bytes == response.size());
+        assert(kept > 0 && kept <= 64);
+        assert(buffered.flushIfDue() && buffered.stats().trace_bytes > kept);
+        assert(!buffered.flushIfDue());
+        buffered.stop();
+        assert(buffered.stats().rx_bytes == kept);
+
+        // Size cap: the capture stops instead of overflowing the file.
+        tinybms::UartTraceRecorder capped(8, 24);
+        assert(capped.start(*storage, "/traces/capped.bin", 0));
+        for (uint32_t t = 0; t < 10; ++t) {
+            capped.record(UartTraceDirection::Rx, t, response.data(), response.size());
+            capped.flushIfDue();
+        }
+        assert(!capped.active());
+        assert(capped.stats().truncated);
+        assert(capped.stats().trace_bytes <= 24);
+    }
+
+    // Only capture names under /traces/, never on the NVS backend.
+    {
+        assert(tinybms::isUartTracePath("/traces/uart-1.bin"));
+        assert(!tinybms::isUartTracePath("/traces/"));
+        assert(!tinybms::isUartTracePath("/config.json"));
+        assert(!tinybms::isUartTracePath("/traces/../config.json"));
+        assert(!tinybms::isUartTracePath("/traces/a_name_much_too_long_for_spiffs.bin"));
+
+        auto storage = hal::createMockStorage();
+        storage->mount(hal::StorageConfig{});
+        tinybms::UartTraceRecorder recorder;
+        assert(!recorder.start(*storage, "/config.json", 0));
+        assert(!storage->exists("/config.json") && !recorder.active());
+
+        auto nvs = hal::createMockStorage();
+        hal::StorageConfig nvs_config{};
+        nvs_config.type = hal::StorageType::NVS;
+        nvs->mount(nvs_config);
+        assert(!recorder.start(*nvs, "/traces/uart.bin", 0));
+        assert(!nvs->exists("/traces/uart.bin"));
+    }
+
+    // Encoding round trip and corrupted input.
+    {
+        const std::vector<UartTraceEvent> events{
+            event(0, UartTraceDirection::Rx, {0x01}),
+            event(300, UartTraceDirection::Tx, request),
+            event(100000, UartTraceDirection::Rx, response),
+        };
+        const std::vector<uint8_t> encoded = tinybms::encodeUartTrace(events);
+        std::vector<UartTraceEvent> decoded;
+        assert(tinybms::decodeUartTrace(encoded.data(), encoded.size(), decoded));
+        assert(decoded.size() == 3);
+        assert(decoded[1].timestamp_ms == 300 && decoded[1].bytes == request);
+        assert(decoded[2].timestamp_ms == 100000 && decoded[2].bytes == response);
+
+        assert(!tinybms::decodeUartTrace(encoded.data(), encoded.size() - 1, decoded));
+        std::vector<uint8_t> bad_magic = encoded;
+        bad_magic[0] = 'X';
+        assert(!tinybms::decodeUartTrace(bad_magic.data(), bad_magic.size(), decoded));
+    }
+
+    // Replay at original, accelerated and instant timing.
+    const std::vector<UartTraceEvent> session{
+        event(0, UartTraceDirection::Tx, request),
+        event(20, UartTraceDirection::Rx, response),
+    };
+    for (float speed : {1.0f, 4.0f, 0.0f}) {
+        hal::ReplayUart uart(session, speed);
+        uint16_t values[2] = {};
+        const tinybms::TransactionResult result = replayBlockRead(uart, values, 1);
+        assert(result.success);
+        assert(values[0] == 5312 && values[1] == 0xFF85);
+        assert(uart.stats().tx_matched == 1 && uart.stats().tx_mismatched == 0);
+        assert(uart.finished());
+        const uint32_t expected_ms = speed == 0.0f ? 0 : static_cast<uint32_t>(20 / speed);
+        assert(uart.nowMs() == expected_ms);
+    }
+
+    // A recorded timeout replays as a timeout, then the retry gets the answer.
+    {
+        const std::vector<UartTraceEvent> flaky{
+            event(0, UartTraceDirection::Tx, request),
+            event(100, UartTraceDirection::Tx, request),
+            event(115, UartTraceDirection::Rx, response),
+        };
+        hal::ReplayUart uart(flaky, 1.0f);
+        uint16_t values[2] = {};
+        const tinybms::TransactionResult result = replayBlockRead(uart, values, 2);
+        assert(result.success);
+        assert(result.timeout_count == 1 && result.retries_performed == 1);
+        assert(uart.stats().read_timeouts == 1);
+        assert(uart.nowMs() == 115);
+        assert(uart.finished());
+
+        // Diverging code is reported, not silently accepted.
+        hal::ReplayUart other(session, 0.0f);
+        const std::vector<uint8_t> different = blockRequest(0, 2);
+        other.write(different.data(), different.size());
+        other.write(different.data(), different.size());
+        assert(other.stats().tx_mismatched == 1);
+        assert(other.stats().tx_beyond_trace == 1);
+        assert(other.stats().rx_bytes_discarded == response.size());
+    }
+
+    return 0;
+}
@@ -236,6 +236,40 @@ int main() {
         assert(stub.lastRequestMatchesExpected());
     }
 
+    {
+        // Line noise and a stray preamble ahead of the reply: resynchronised
+        // inside the same attempt instead of costing a retry.
+        TinyBmsUartStub stub;
+        std::vector<uint16_t> addresses{0x0020, 0x0021};
+        std::vector<uint16_t> values{0x00AA, 0x4321};
+        auto request = buildReadListRequest(addresses);
+        std::vector<uint8_t> response{0x00, 0xAA, 0x55};
+        auto frame = buildReadListResponse(values);
+        response.insert(response.end(), frame.begin(), frame.end());
+
+        TinyBmsUartStub::Exchange exchange{};
+        exchange.expected_request = request;
+        exchange.response = response;
+        stub.queueExchange(std::move(exchange));
+
+        uint16_t output[2] = {};
+        tinybms::TransactionOptions options{};
+        options.attempt_count = 1;
+        options.retry_delay_ms = 0;
+        options.response_timeout_ms = 50;
+
+        tinybms::TransactionResult result = tinybms::readIndividualRegisters(
+            stub, addresses.data(), addresses.size(), output, options);
+
+        assert(result.success);
+        assert(result.retries_performed == 0);
+        assert(result.crc_error_count == 0);
+        assert(result.resync_count == 1);
+        assert(result.garbage_bytes == 3);
+        assert(output[0] == values[0]);
+        assert(output[1] == values[1]);
+    }
+
     {
         TinyBmsUartStub stub;
         std::vector<uint16_t> addresses{0x0300};
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "victron_pgn_cache.h"
+
+using tinybms::PgnCacheKey;
+using tinybms::PgnCacheStats;
+using tinybms::PgnPayloadCache;
+
+namespace {
+
+PgnCacheKey nameKey(uint32_t config_version, const char* text) {
+    PgnCacheKey key;
+    key.add(config_version);
+    key.addText(text, std::strlen(text));
+    return key;
+}
+
+// Builder stand-in: counts the expensive resolutions.
+struct Builder {
+    PgnPayloadCache& cache;
+    int resolutions = 0;
+
+    void build(uint16_t pgn, const PgnCacheKey& key, const char* name, uint8_t* out) {
+        if (cache.lookup(pgn, key, out)) {
+            return;
+        }
+        ++resolutions;
+        std::memset(out, 0, 8);
+        std::memcpy(out, name, std::min<size_t>(8, std::strlen(name)));
+        cache.store(pgn, key, out);
+    }
+};
+
+} // namespace
+
+int main() {
+    // Keys compare the exact inputs.
+    {
+        assert(nameKey(1, "TinyBMS") == nameKey(1, "TinyBMS"));
+        assert(nameKey(1, "TinyBMS") != nameKey(2, "TinyBMS"));
+        assert(nameKey(1, "TinyBMS") != nameKey(1, "TinyBMs"));
+        // Length prefix: "ab"+"c" is not "a"+"bc".
+        PgnCacheKey left;
+        left.addText("ab", 2).addText("c", 1);
+        PgnCacheKey right;
+        right.addText("a", 1).addText("bc", 2);
+        assert(left != right && left.size() == right.size());
+
+        PgnCacheKey capacity;
+        capacity.add(100.0f);
+        PgnCacheKey other;
+        other.add(100.5f);
+        assert(capacity != other);
+
+        // An oversized key never matches, not even itself.
+        PgnCacheKey big;
+        const char text[80] = {};
+        big.addText(text, sizeof(text));
+        assert(big.overflowed() && !(big == big));
+    }
+
+    // Payloads are rebuilt only when an input changes.
+    {
+        PgnPayloadCache cache;
+        Builder builder{cache};
+        uint8_t payload[8];
+
+        for (int i = 0; i < 10; ++i) {
+            builder.build(0x35E, nameKey(1, "ENEPAQ"), "ENEPAQ", payload);
+        }
+        assert(builder.resolutions == 1);
+        assert(std::memcmp(payload, "ENEPAQ\0\0", 8) == 0);
+
+        builder.build(0x35E, nameKey(2, "ENEPAQ"), "Other", payload);   // config saved
+        assert(builder.resolutions == 2 && std::memcmp(payload, "Other\0\0\0", 8) == 0);
+        builder.build(0x35E, nameKey(2, "ENEPAQ2"), "ENEPAQ2", payload); // register text
+        assert(builder.resolutions == 3);
+        builder.build(0x35E, nameKey(2, "ENEPAQ2"), "ignored", payload);
+        assert(builder.resolutions == 3 && std::memcmp(payload, "ENEPAQ2\0", 8) == 0);
+
+        // Entries are per PGN.
+        builder.build(0x371, nameKey(2, "ENEPAQ2"), "Battery", payload);
+        assert(builder.resolutions == 4);
+
+        const std::vector<PgnCacheStats> stats = cache.snapshot();
+        assert(stats.size() == 2);
+        assert(stats[0].pgn == 0x35E && stats[0].hits == 10 && stats[0].misses == 3);
+        assert(stats[0].hitRatio() > 0.76f && stats[0].hitRatio() < 0.77f);
+        assert(stats[1].pgn == 0x371 && stats[1].hits == 0 && stats[1].misses == 1);
+
+        cache.resetStats();
+        assert(cache.snapshot()[0].hits == 0 && cache.snapshot()[0].hitRatio() == 0.0f);
+        builder.build(0x35E, nameKey(2, "ENEPAQ2"), "ignored", payload);   // payload kept
+        assert(builder.resolutions == 4 && cache.snapshot()[0].hits == 1);
+    }
+
+    // A result built from defaults (config unavailable) is simply not stored.
+    {
+        PgnPayloadCache cache;
+        uint8_t payload[8] = {};
+        assert(!cache.lookup(0x382, nameKey(1, ""), payload));
+        assert(!cache.lookup(0x382, nameKey(1, ""), payload));
+        assert(cache.snapshot()[0].misses == 2);
+    }
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "victron_pgn_scheduler.h"
+
+using tinybms::PgnScheduleStats;
+using tinybms::PgnScheduler;
+using tinybms::PgnSlot;
+
+namespace {
+
+// Runs the scheduler like the CAN task (10 ms loop) and returns the send order.
+std::vector<uint16_t> run(PgnScheduler& scheduler, uint32_t from_ms, uint32_t to_ms) {
+    std::vector<uint16_t> sent;
+    for (uint32_t now = from_ms; now < to_ms; now += 10) {
+        size_t index = 0;
+        while (scheduler.nextDue(now, index)) {
+            sent.push_back(scheduler.pgnAt(index));
+            scheduler.markSent(index, now);
+        }
+    }
+    return sent;
+}
+
+size_t countOf(const std::vector<uint16_t>& sent, uint16_t pgn) {
+    size_t count = 0;
+    for (uint16_t id : sent) {
+        count += id == pgn ? 1 : 0;
+    }
+    return count;
+}
+
+} // namespace
+
+int main() {
+    const std::vector<PgnSlot> slots{
+        {0x356, 1000}, {0x355, 1000}, {0x351, 1000}, {0x35A, 1000}, {0x378, 5000},
+        {0x35E, 10000}, {0x35F, 10000}, {0x371, 10000}, {0x379, 10000}, {0x382, 10000},
+    };
+
+    // Staggered phases: one frame every 100 ms, never two in the same pass.
+    {
+        PgnScheduler scheduler;
+        scheduler.configure(slots, 0, 50);
+        assert(scheduler.size() == slots.size() && scheduler.missToleranceMs() == 50);
+        const std::vector<PgnScheduleStats> stats = scheduler.snapshot();
+        for (size_t i = 0; i < stats.size(); ++i) {
+            assert(stats[i].phase_ms == i * 100);
+        }
+
+        size_t index = 0;
+        assert(scheduler.nextDue(0, index) && index == 0);
+        scheduler.markSent(index, 0);
+        assert(!scheduler.nextDue(90, index));
+        assert(scheduler.nextDue(100, index) && scheduler.pgnAt(index) == 0x355);
+
+        PgnScheduler busy;
+        busy.configure(slots, 0, 50);
+        size_t max_per_pass = 0;
+        for (uint32_t now = 0; now < 60000; now += 10) {
+            size_t in_pass = 0;
+            while (busy.nextDue(now, index)) {
+                busy.markSent(index, now);
+                ++in_pass;
+            }
+            max_per_pass = std::max(max_per_pass, in_pass);
+        }
+        assert(max_per_pass == 1);
+    }
+
+    // Per-PGN periods: dynamic frames every second, identity every 10 s.
+    {
+        PgnScheduler scheduler;
+        scheduler.configure(slots, 1000, 50);
+        const std::vector<uint16_t> sent = run(scheduler, 1000, 61000);
+        assert(countOf(sent, 0x356) == 60 && countOf(sent, 0x35A) == 60);
+        assert(countOf(sent, 0x378) == 12);
+        assert(countOf(sent, 0x35E) == 6 && countOf(sent, 0x382) == 6);
+        assert(sent.size() == 4 * 60 + 12 + 5 * 6);
+        for (const PgnScheduleStats& entry : scheduler.snapshot()) {
+            assert(entry.deadline_misses == 0 && entry.periods_skipped == 0);
+            assert(entry.lateness_ms_max == 0);
+        }
+    }
+
+    // Late sends: counted as misses past the tolerance, skipped periods are
+    // not replayed and the PGN stays on its phase grid.
+    {
+        PgnScheduler scheduler;
+        scheduler.configure({{0x351, 1000}}, 0, 50);
+        size_t index = 0;
+        assert(scheduler.nextDue(40, index) && index == 0);
+        scheduler.markSent(index, 40);   // within tolerance
+        assert(scheduler.snapshot()[0].deadline_misses == 0);
+
+        assert(scheduler.nextDue(3300, index) && index == 0);   // stalled task: 2300 ms late
+        scheduler.markSent(index, 3300);
+        PgnScheduleStats stats = scheduler.snapshot()[0];
+        assert(stats.deadline_misses == 1 && stats.periods_skipped == 2);
+        assert(stats.lateness_ms_last == 2300 && stats.lateness_ms_max == 2300);
+        assert(!scheduler.nextDue(3990, index));
+        assert(scheduler.nextDue(4000, index));   // back on the grid, not 4300
+
+        // Earliest deadline first when several are due.
+        PgnScheduler both;
+        both.configure({{0x351, 1000}, {0x35E, 10000}}, 0, 50);
+        assert(both.nextDue(5000, index) && index == 0);   // due at 0 vs 500
+        both.markSent(index, 5000);
+        assert(both.nextDue(5000, index) && index == 1);
+    }
+
+    // No live data: restart defers every deadline without counting misses.
+    {
+        PgnScheduler scheduler;
+        scheduler.configure(slots, 0, 50);
+        scheduler.restart(8000);
+        size_t index = 0;
+        assert(!scheduler.nextDue(7990, index));
+        assert(scheduler.nextDue(8000, index) && index == 0);
+        run(scheduler, 8000, 9000);
+        for (const PgnScheduleStats& entry : scheduler.snapshot()) {
+            assert(entry.sent == 1 && entry.deadline_misses == 0);
+        }
+
+        scheduler.resetStats();
+        const PgnScheduleStats cleared = scheduler.snapshot()[3];
+        assert(cleared.sent == 0 && cleared.pgn == 0x35A && cleared.phase_ms == 300);
+    }
+
+    // millis() wrap-around.
+    {
+        PgnScheduler scheduler;
+        scheduler.configure({{0x351, 1000}}, UINT32_MAX - 500, 50);
+        size_t index = 0;
+        assert(scheduler.nextDue(UINT32_MAX - 500, index));
+        scheduler.markSent(index, UINT32_MAX - 500);
+        assert(!scheduler.nextDue(UINT32_MAX, index));
+        assert(!scheduler.nextDue(400, index));
+        assert(scheduler.nextDue(499, index));
+        scheduler.markSent(index, 499);
+        assert(scheduler.snapshot()[0].deadline_misses == 0);
+    }
+
+    return 0;
+}
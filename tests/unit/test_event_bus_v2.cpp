@@ -1,15 +1,127 @@
 #include <Arduino.h>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "event/event_bus_v2.h"
+#include "event/event_registry.h"
 #include "event/event_types_v2.h"
+#include "event/inplace_function.h"
+#include "event/latest_slot.h"
+#include "event/register_value_adapter.h"
 
 using tinybms::event::EventBusV2;
 using tinybms::event::BusStatistics;
+using tinybms::event::InplaceFunction;
+using tinybms::event::LatestSlot;
 using tinybms::events::EventSource;
 using tinybms::events::LiveDataUpdate;
 
+namespace {
+
+constexpr size_t kReaders = 4;
+constexpr auto kContentionRun = std::chrono::milliseconds(200);
+constexpr size_t kLastSnapshot = TINY_LIVEDATA_MAX_REGISTERS - 1;
+
+// Voltage (first field) and the last snapshot carry the same counter: a torn
+// read shows up as a mismatch.
+void stamp(LiveDataUpdate& update, uint32_t n) {
+    update.data.voltage = static_cast<float>(n);
+    update.data.register_snapshots[kLastSnapshot].raw_value = static_cast<int32_t>(n);
+}
+
+bool consistent(const LiveDataUpdate& update) {
+    asm volatile("" : : "g"(&update) : "memory");   // keep the full copy observable
+    return update.data.voltage == static_cast<float>(update.data.register_snapshots[kLastSnapshot].raw_value);
+}
+
+// Previous cache: mutex + std::optional, copied out under the lock.
+struct MutexLatest {
+    mutable std::mutex mutex;
+    std::optional<LiveDataUpdate> latest;
+
+    void store(const LiveDataUpdate& update) {
+        std::lock_guard<std::mutex> lock(mutex);
+        latest = update;
+    }
+
+    bool load(LiveDataUpdate& out) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!latest.has_value()) {
+            return false;
+        }
+        out = *latest;
+        return true;
+    }
+};
+
+struct ContentionResult {
+    uint64_t publishes = 0;
+    uint64_t reads = 0;
+    uint64_t torn = 0;
+};
+
+// One publisher and kReaders readers hammering the same latest value.
+template <typename Publish, typename Read>
+ContentionResult runContention(Publish publish, Read read) {
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> reads{0};
+    std::atomic<uint64_t> torn{0};
+    ContentionResult result;
+
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < kReaders; ++r) {
+        readers.emplace_back([&]() {
+            uint64_t local_reads = 0;
+            uint64_t local_torn = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (read(local_torn)) {
+                    ++local_reads;
+                }
+            }
+            reads.fetch_add(local_reads);
+            torn.fetch_add(local_torn);
+        });
+    }
+
+    LiveDataUpdate update{};
+    const auto deadline = std::chrono::steady_clock::now() + kContentionRun;
+    uint32_t n = 0;
+    while (std::chrono::steady_clock::now() < deadline) {
+        stamp(update, ++n);
+        publish(update);
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    result.publishes = n;
+    result.reads = reads.load();
+    result.torn = torn.load();
+    return result;
+}
+
+void report(const char* label, const ContentionResult& result) {
+    const double seconds = std::chrono::duration<double>(kContentionRun).count();
+    std::printf("  %-22s %10.0f publish/s %12.0f reads/s (%zu readers)\n",
+                label, result.publishes / seconds, result.reads / seconds, kReaders);
+}
+
+} // namespace
+
 int main() {
     EventBusV2 bus;
     bus.resetStats();
@@ -53,5 +165,491 @@ int main() {
     assert(stats.total_published == 0);
     assert(stats.total_delivered == 0);
 
+    // Copy-on-write subscriber lists: changes made from a callback apply to the next publish.
+    {
+        using tinybms::events::MqttRegisterValue;
+        // Callbacks are stored inline: share the test state through one pointer.
+        struct State {
+            EventBusV2* bus = nullptr;
+            int first_calls = 0;
+            int late_calls = 0;
+            tinybms::event::EventSubscriber late;
+            tinybms::event::EventSubscriber first;
+        } state;
+        state.bus = &bus;
+        int& first_calls = state.first_calls;
+        int& late_calls = state.late_calls;
+        auto& late = state.late;
+        auto& first = state.first;
+        first = bus.subscribe<MqttRegisterValue>([s = &state](const MqttRegisterValue&) {
+            ++s->first_calls;
+            if (!s->late.isActive()) {
+                s->late = s->bus->subscribe<MqttRegisterValue>([s](const MqttRegisterValue&) { ++s->late_calls; });
+            }
+            s->first.unsubscribe();   // the running list keeps the subscription alive
+        });
+        auto other = bus.subscribe<MqttRegisterValue>([](const MqttRegisterValue&) {});
+        assert(bus.subscriberCount() == 2);
+
+        MqttRegisterValue value{};
+        bus.publish(value);
+        assert(first_calls == 1 && late_calls == 0);
+        assert(bus.subscriberCount() == 2);   // first left, late joined
+
+        bus.publish(value);
+        assert(first_calls == 1 && late_calls == 1);
+
+        other.unsubscribe();
+        late.unsubscribe();
+        assert(bus.subscriberCount() == 0);
+        bus.publish(value);
+        assert(late_calls == 1);
+    }
+
+    // Async subscriptions: publish only enqueues, dispatchPending() runs the callbacks.
+    {
+        using tinybms::event::AsyncSubscriptionOptions;
+        using tinybms::event::QueuePolicy;
+        using tinybms::events::MqttRegisterValue;
+        bus.resetStats();
+
+        auto registerValue = [](uint16_t address, int32_t raw) {
+            MqttRegisterValue value{};
+            value.payload.address = address;
+            value.payload.raw_value = raw;
+            return value;
+        };
+
+        // Drop oldest: the newest `capacity` events survive.
+        std::vector<int32_t> seen;
+        AsyncSubscriptionOptions drop;
+        drop.capacity = 3;
+        drop.policy = QueuePolicy::DropOldest;
+        auto dropping = bus.subscribeAsync<MqttRegisterValue>(
+            [&](const MqttRegisterValue& evt) { seen.push_back(evt.payload.raw_value); }, drop);
+        for (int32_t i = 1; i <= 5; ++i) {
+            bus.publish(registerValue(36, i));
+        }
+        assert(seen.empty());
+        assert(bus.statistics().current_queue_depth == 3);
+        assert(bus.statistics().queue_overruns == 2);
+        assert(bus.droppedCount<MqttRegisterValue>() == 2);
+        assert(bus.dispatchPending(0) == 3);
+        assert((seen == std::vector<int32_t>{3, 4, 5}));
+        assert(bus.statistics().current_queue_depth == 0);
+        dropping.unsubscribe();
+
+        // Coalesce per key: one pending value per register, in first-arrival order.
+        std::vector<std::pair<uint16_t, int32_t>> coalesced;
+        AsyncSubscriptionOptions coalesce;
+        coalesce.capacity = 4;
+        coalesce.policy = QueuePolicy::CoalesceLatest;
+        auto coalescing = bus.subscribeAsync<MqttRegisterValue>(
+            [&](const MqttRegisterValue& evt) { coalesced.emplace_back(evt.payload.address, evt.payload.raw_value); },
+            coalesce,
+            [](const MqttRegisterValue& evt) { return static_cast<uint32_t>(evt.payload.address); });
+        bus.publish(registerValue(36, 1));
+        bus.publish(registerValue(38, 1));
+        bus.publish(registerValue(36, 2));
+        bus.publish(registerValue(36, 3));
+        assert(bus.statistics().current_queue_depth == 2);
+        assert(bus.dispatchPending(0) == 2);
+        assert((coalesced == std::vector<std::pair<uint16_t, int32_t>>{{36, 3}, {38, 1}}));
+        coalescing.unsubscribe();
+
+        // Block: the publisher waits for room, then gives up and counts an overrun.
+        bus.resetStats();
+        int blocked_calls = 0;
+        AsyncSubscriptionOptions block;
+        block.capacity = 1;
+        block.policy = QueuePolicy::Block;
+        block.block_timeout_ms = 5;
+        auto blocking = bus.subscribeAsync<MqttRegisterValue>(
+            [&](const MqttRegisterValue&) { ++blocked_calls; }, block);
+        bus.publish(registerValue(36, 1));
+        bus.publish(registerValue(36, 2));   // times out: queue still full
+        assert(bus.statistics().queue_overruns == 1);
+        assert(bus.droppedCount<MqttRegisterValue>() == 1);
+
+        std::atomic<bool> running{true};
+        std::thread dispatcher([&]() {
+            while (running.load()) {
+                bus.dispatchPending(1);
+            }
+        });
+        AsyncSubscriptionOptions wide;
+        wide.capacity = 64;
+        wide.policy = QueuePolicy::Block;
+        wide.block_timeout_ms = 1000;
+        std::atomic<int> threaded_calls{0};
+        auto threaded = bus.subscribeAsync<MqttRegisterValue>(
+            [&](const MqttRegisterValue&) { threaded_calls.fetch_add(1); }, wide);
+        blocking.unsubscribe();
+        for (int i = 0; i < 500; ++i) {
+            bus.publish(registerValue(36, i));
+        }
+        while (bus.statistics().current_queue_depth > 0) {
+            std::this_thread::yield();
+        }
+        running.store(false);
+        dispatcher.join();
+        assert(threaded_calls.load() == 500);
+        threaded.unsubscribe();
+
+        // Callback errors are counted; unsubscribing discards what is still queued.
+        auto failing = bus.subscribeAsync<MqttRegisterValue>(
+            [](const MqttRegisterValue&) { throw 1; });
+        bus.publish(registerValue(36, 1));
+        assert(bus.dispatchPending(0) == 1);
+        assert(bus.statistics().dispatch_errors == 1);
+        bus.publish(registerValue(36, 2));
+        assert(bus.statistics().current_queue_depth == 1);
+        failing.unsubscribe();
+        assert(bus.statistics().current_queue_depth == 0);
+        assert(bus.dispatchPending(0) == 0);
+        assert(bus.subscriberCount() == 0);
+    }
+
+    // Register cycle batch: one publish per cycle; the adapter splits it only
+    // while single-register subscribers exist.
+    {
+        using tinybms::event::RegisterValueAdapter;
+        using tinybms::events::MqttRegisterValue;
+        using tinybms::events::RegisterCycleBatch;
+
+        RegisterCycleBatch batch;
+        for (uint16_t address : {36, 38, 46}) {
+            batch.append()->address = address;
+        }
+        batch.metadata.source = EventSource::Uart;
+
+        RegisterValueAdapter adapter(bus);
+        assert(adapter.begin() && adapter.begin() && adapter.isActive());
+        assert(!bus.hasSubscribers<MqttRegisterValue>());
+        bus.resetStats();
+        bus.publish(batch);
+        assert(bus.statistics().total_published == 1);   // nobody listens to single values
+
+        size_t batch_entries = 0;
+        uint32_t batch_sequence = 0;
+        auto batch_sub = bus.subscribe<RegisterCycleBatch>([&](const RegisterCycleBatch& evt) {
+            batch_entries += evt.size();
+            batch_sequence = evt.metadata.sequence;
+        });
+        std::vector<uint16_t> addresses;
+        auto single_sub = bus.subscribe<MqttRegisterValue>([&addresses](const MqttRegisterValue& evt) {
+            assert(evt.metadata.source == EventSource::Uart);
+            addresses.push_back(evt.payload.address);
+        });
+        assert(bus.hasSubscribers<MqttRegisterValue>());
+        bus.publish(batch);
+        assert(batch_entries == 3);
+        assert((addresses == std::vector<uint16_t>{36, 38, 46}));
+        RegisterCycleBatch latest;
+        assert(bus.getLatest(latest) && latest.metadata.sequence == batch_sequence && latest.size() == 3);
+
+        adapter.end();
+        bus.publish(batch);
+        assert(addresses.size() == 3 && batch_entries == 6);
+    }
+
+    // Per-type registry: counters, callback time histogram, slow-subscriber StatusMessage.
+    {
+        using tinybms::event::CallbackTimeHistogram;
+        using tinybms::event::EventTypeSnapshot;
+        using tinybms::events::AlarmRaised;
+        using tinybms::events::StatusMessage;
+
+        assert(CallbackTimeHistogram::bucketIndex(0) == 0);
+        assert(CallbackTimeHistogram::bucketIndex(1) == 1);
+        assert(CallbackTimeHistogram::bucketIndex(1000) == 10);   // [512, 1024)
+        assert(CallbackTimeHistogram::bucketIndex(0xFFFFFFFFu) == CallbackTimeHistogram::kBucketCount - 1);
+        CallbackTimeHistogram histogram;
+        for (int i = 0; i < 99; ++i) {
+            histogram.record(3);
+        }
+        histogram.record(700);
+        assert(histogram.count() == 100 && histogram.maxUs() == 700);
+        assert(histogram.percentileUs(50.0f) == 4 && histogram.percentileUs(100.0f) == 700);
+
+        auto findType = [&bus](const char* name) {
+            for (const EventTypeSnapshot& entry : bus.typeStatistics()) {
+                if (std::string(entry.name) == name) {
+                    return entry;
+                }
+            }
+            return EventTypeSnapshot{};
+        };
+
+        bus.resetStats();
+        assert(bus.callbackSampleEvery() == tinybms::event::EventRegistry::kDefaultCallbackSampleEvery);
+        bus.setCallbackSampleEvery(1);
+        std::vector<std::string> statuses;
+        auto status_sub = bus.subscribe<StatusMessage>([&statuses](const StatusMessage& evt) {
+            statuses.push_back(evt.message);
+        });
+        uint32_t slow_us = 0;
+        auto alarm_sub = bus.subscribe<AlarmRaised>([&slow_us](const AlarmRaised&) {
+            arduino_stub::advanceMicros(slow_us);
+        });
+        auto alarm_async = bus.subscribeAsync<AlarmRaised>([](const AlarmRaised&) {
+            arduino_stub::advanceMicros(40);
+        });
+
+        slow_us = 5;
+        bus.publish(AlarmRaised{});
+        assert(bus.dispatchPending(0) == 1);
+        EventTypeSnapshot alarms = findType("AlarmRaised");
+        assert(alarms.published == 1 && alarms.delivered == 2 && alarms.subscribers == 2);
+        assert(alarms.callback_count == 2 && alarms.callback_max_us == 40);   // the enqueue is not timed
+        assert(alarms.slow_callbacks == 0 && statuses.empty());
+        assert(findType("StatusMessage").subscribers == 1);
+
+        bus.setSlowCallbackThresholdUs(1000);
+        slow_us = 2500;
+        bus.publish(AlarmRaised{});
+        assert(statuses.size() == 1 && statuses[0] == "Slow AlarmRaised subscriber: 2500 us");
+        bus.publish(AlarmRaised{});   // throttled
+        assert(statuses.size() == 1 && findType("AlarmRaised").slow_callbacks == 2);
+        arduino_stub::advanceMillis(tinybms::event::EventRegistry::kSlowReportIntervalMs);
+        bus.publish(AlarmRaised{});
+        assert(statuses.size() == 2);
+        bus.dispatchPending(0);
+
+        alarm_async.unsubscribe();
+        assert(findType("AlarmRaised").subscribers == 1);
+        bus.resetStats();
+        alarms = findType("AlarmRaised");
+        assert(alarms.published == 0 && alarms.callback_count == 0 && alarms.subscribers == 1);
+        assert(findType("AlarmRaised").id != findType("StatusMessage").id);
+
+        // Sampled: one publish in four is timed, the first one included.
+        bus.setCallbackSampleEvery(4);
+        for (int i = 0; i < 8; ++i) {
+            bus.publish(AlarmRaised{});
+        }
+        alarms = findType("AlarmRaised");
+        assert(alarms.published == 8 && alarms.delivered == 8 && alarms.callback_count == 2);
+        assert(alarms.slow_callbacks == 2);
+
+        bus.setCallbackSampleEvery(0);
+        bus.resetStats();
+        bus.publish(AlarmRaised{});
+        alarms = findType("AlarmRaised");
+        assert(alarms.delivered == 1 && alarms.callback_count == 0 && alarms.slow_callbacks == 0);
+        bus.setSlowCallbackThresholdUs(tinybms::event::EventRegistry::kDefaultSlowCallbackUs);
+    }
+
+    // Subscribe-time filters: key index and predicate; `delivered` counts invoked callbacks only.
+    {
+        using tinybms::event::AsyncSubscriptionOptions;
+        using tinybms::event::KeyFilter;
+        using tinybms::events::AlarmRaised;
+        using tinybms::events::MqttRegisterValue;
+
+        auto registerValue = [](uint16_t address) {
+            MqttRegisterValue value{};
+            value.payload.address = address;
+            return value;
+        };
+        auto findType = [&bus](const char* name) {
+            for (const auto& entry : bus.typeStatistics()) {
+                if (std::string(entry.name) == name) {
+                    return entry;
+                }
+            }
+            return tinybms::event::EventTypeSnapshot{};
+        };
+
+        bus.setCallbackSampleEvery(1);
+        KeyFilter keys{46, 36, 36};
+        assert(keys.size() == 2 && keys.contains(36) && !keys.contains(38));
+
+        bus.resetStats();
+        std::vector<uint16_t> keyed;
+        std::vector<uint16_t> keyed_late;
+        std::vector<uint16_t> odd;
+        auto keyed_sub = bus.subscribe<MqttRegisterValue>(
+            keys, [&keyed](const MqttRegisterValue& evt) { keyed.push_back(evt.payload.address); });
+        auto keyed_late_sub = bus.subscribe<MqttRegisterValue>(
+            KeyFilter{36}, [&keyed_late](const MqttRegisterValue& evt) { keyed_late.push_back(evt.payload.address); });
+        auto odd_sub = bus.subscribe<MqttRegisterValue>(
+            [](const MqttRegisterValue& evt) { return (evt.payload.address & 1u) != 0; },
+            [&odd](const MqttRegisterValue& evt) { odd.push_back(evt.payload.address); });
+        assert(bus.subscriberCount() == 3);
+
+        for (uint16_t address : {36, 37, 38, 46}) {
+            bus.publish(registerValue(address));
+        }
+        assert((keyed == std::vector<uint16_t>{36, 46}));
+        assert((keyed_late == std::vector<uint16_t>{36}));
+        assert((odd == std::vector<uint16_t>{37}));
+        auto values = findType("MqttRegisterValue");
+        assert(values.published == 4 && values.delivered == 4 && values.callback_count == 4);
+
+        // Async: only matching events are enqueued.
+        std::vector<uint16_t> queued;
+        auto async_sub = bus.subscribeAsync<MqttRegisterValue>(
+            KeyFilter{38}, [&queued](const MqttRegisterValue& evt) { queued.push_back(evt.payload.address); },
+            AsyncSubscriptionOptions{});
+        bus.publish(registerValue(36));
+        bus.publish(registerValue(38));
+        assert(bus.statistics().current_queue_depth == 1);
+        assert(bus.dispatchPending(0) == 1 && (queued == std::vector<uint16_t>{38}));
+
+        // Unsubscribing removes every key entry of the subscription.
+        keyed_sub.unsubscribe();
+        async_sub.unsubscribe();
+        keyed.clear();
+        keyed_late.clear();
+        bus.publish(registerValue(36));
+        bus.publish(registerValue(46));
+        assert(keyed.empty() && (keyed_late == std::vector<uint16_t>{36}));
+        keyed_late_sub.unsubscribe();
+        odd_sub.unsubscribe();
+        assert(!bus.hasSubscribers<MqttRegisterValue>());
+
+        // Alarms are keyed by alarm code.
+        int overvoltage = 0;
+        auto alarm_sub = bus.subscribe<AlarmRaised>(KeyFilter{2}, [&overvoltage](const AlarmRaised&) { ++overvoltage; });
+        AlarmRaised alarm{};
+        alarm.alarm.alarm_code = 1;
+        bus.publish(alarm);
+        alarm.alarm.alarm_code = 2;
+        bus.publish(alarm);
+        assert(overvoltage == 1);
+        bus.setCallbackSampleEvery(tinybms::event::EventRegistry::kDefaultCallbackSampleEvery);
+    }
+
+    // InplaceFunction: captures live in the object, moves transfer them, empty calls throw.
+    {
+        auto token = std::make_shared<int>(3);
+        InplaceFunction<int(int)> add = [token](int x) { return x + *token; };
+        assert(add && add(4) == 7);
+        assert(token.use_count() == 2);
+
+        InplaceFunction<int(int)> moved = std::move(add);
+        assert(!add && add == nullptr);
+        assert(moved(1) == 4 && token.use_count() == 2);
+
+        moved = nullptr;
+        assert(moved == nullptr && token.use_count() == 1);
+
+        bool threw = false;
+        try {
+            moved(0);
+        } catch (const std::bad_function_call&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    // Borrowed in place: same value as getLatest(), no copy.
+    {
+        update.data.voltage = 51.5f;
+        bus.publish(update);
+        assert(bus.hasLatest<LiveDataUpdate>());
+        const LiveDataUpdate* borrowed = nullptr;
+        assert(bus.borrowLatest<LiveDataUpdate>([&](const LiveDataUpdate& evt) {
+            borrowed = &evt;
+            assert(std::fabs(evt.data.voltage - 51.5f) < 1e-6f);
+        }));
+        assert(borrowed != nullptr);
+
+        TinyBMS_LiveData data{};
+        assert(bus.getLatestLiveData(data));
+        assert(std::fabs(data.voltage - 51.5f) < 1e-6f);
+
+        LatestSlot<int> empty;
+        assert(!empty.hasValue());
+        int value = 7;
+        assert(!empty.load(value) && value == 7);
+        assert(!empty.borrow([](const int&) { assert(false); }));
+    }
+
+    // A pinned value is never overwritten: the writer uses the other buffers.
+    {
+        LatestSlot<int> slot;
+        slot.store(1);
+        bool nested_ok = false;
+        slot.borrow([&](const int& pinned) {
+            slot.store(2);
+            slot.store(3);   // both spare buffers reused, pinned one untouched
+            int latest = 0;
+            nested_ok = pinned == 1 && slot.load(latest) && latest == 3;
+        });
+        assert(nested_ok);
+        int latest = 0;
+        assert(slot.load(latest) && latest == 3);
+        assert(slot.skippedStores() == 0);
+    }
+
+    // Every spare copy pinned: the writer skips the update instead of sleeping.
+    {
+        LatestSlot<int> slot;
+        assert(slot.store(1));
+        bool skipped = false;
+        slot.borrow([&](const int&) {
+            assert(slot.store(2));
+            slot.borrow([&](const int&) {
+                assert(slot.store(3));
+                skipped = !slot.store(4);
+            });
+        });
+        assert(skipped && slot.skippedStores() == 1);
+        int latest = 0;
+        assert(slot.load(latest) && latest == 3);
+        assert(slot.store(5) && slot.load(latest) && latest == 5);
+    }
+
+    // Contention: one publisher, kReaders readers, no torn LiveData.
+    {
+        std::printf("EventBusV2 latest LiveDataUpdate contention (%zu-byte event)\n", sizeof(LiveDataUpdate));
+
+        MutexLatest locked;
+        const ContentionResult mutex_result = runContention(
+            [&](const LiveDataUpdate& u) { locked.store(u); },
+            [&](uint64_t& torn) {
+                LiveDataUpdate copy;
+                if (!locked.load(copy)) {
+                    return false;
+                }
+                torn += consistent(copy) ? 0 : 1;
+                return true;
+            });
+        report("mutex + copy", mutex_result);
+
+        const ContentionResult copy_result = runContention(
+            [&](const LiveDataUpdate& u) { bus.publish(u); },
+            [&](uint64_t& torn) {
+                LiveDataUpdate copy;
+                if (!bus.getLatest(copy)) {
+                    return false;
+                }
+                torn += consistent(copy) ? 0 : 1;
+                return true;
+            });
+        report("lock-free getLatest", copy_result);
+
+        const ContentionResult borrow_result = runContention(
+            [&](const LiveDataUpdate& u) { bus.publish(u); },
+            [&](uint64_t& torn) {
+                return bus.borrowLatest<LiveDataUpdate>([&](const LiveDataUpdate& evt) {
+                    torn += consistent(evt) ? 0 : 1;
+                });
+            });
+        report("lock-free borrowLatest", borrow_result);
+        for (const auto& type : bus.typeStatistics()) {
+            if (std::strcmp(type.name, LiveDataUpdate::kEventName) == 0) {
+                std::printf("  latest updates skipped (readers pinned both spares): %u\n", type.latest_skipped);
+            }
+        }
+
+        assert(mutex_result.torn == 0);
+        assert(copy_result.torn == 0);
+        assert(borrow_result.torn == 0);
+        assert(copy_result.reads > 0 && borrow_result.reads > 0);
+    }
+
     return 0;
 }